@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+#include <str/arena>
+#include <str/heapstr>
+#include <vector>
+
+using arenastr = str::basic_heapstr<char, std::char_traits<char>, str::arena_allocator<char>>;
+
+// a request building a few hundred short strings which die together
+static void RequestHeap(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        std::vector<str::heapstr> strings;
+        strings.reserve(256);
+        for (int i = 0; i < 256; i++)
+        {
+            strings.emplace_back("header-name: ");
+            strings.back().append_int(i);
+        }
+        benchmark::DoNotOptimize(strings.data());
+    }
+}
+
+static void RequestArena(benchmark::State &state)
+{
+    str::arena arena;
+    for (auto _ : state)
+    {
+        {
+            std::vector<arenastr> strings;
+            strings.reserve(256);
+            for (int i = 0; i < 256; i++)
+            {
+                strings.emplace_back("header-name: ", arena);
+                strings.back().append_int(i);
+            }
+            benchmark::DoNotOptimize(strings.data());
+        }
+        arena.reset();
+    }
+}
+
+BENCHMARK(RequestHeap);
+BENCHMARK(RequestArena);
@@ -0,0 +1,109 @@
+#include <benchmark/benchmark.h>
+#include <str/heapstr>
+#include <str/strutils>
+#include <string>
+#include <vector>
+
+// a chain of five parts, long enough that every step of an eager chain reallocates
+static void Concat(benchmark::State &state)
+{
+    str::heapstr scheme("https"), host("subdomain.example.com"), path("/api/v2/resources/index.html");
+    for (auto _ : state)
+    {
+        str::heapstr url = scheme + "://" + host + ':' + path;
+        benchmark::DoNotOptimize(url.data());
+    }
+}
+
+static void ConcatEager(benchmark::State &state)
+{
+    str::heapstr scheme("https"), host("subdomain.example.com"), path("/api/v2/resources/index.html");
+    for (auto _ : state)
+    {
+        str::heapstr url = scheme;
+        url = str::heapstr(url + "://");
+        url = str::heapstr(url + host);
+        url = str::heapstr(url + ':');
+        url = str::heapstr(url + path);
+        benchmark::DoNotOptimize(url.data());
+    }
+}
+
+static void ConcatStdString(benchmark::State &state)
+{
+    std::string scheme("https"), host("subdomain.example.com"), path("/api/v2/resources/index.html");
+    for (auto _ : state)
+    {
+        std::string url = scheme + "://" + host + ':' + path;
+        benchmark::DoNotOptimize(url.data());
+    }
+}
+
+static void ConcatParts(benchmark::State &state)
+{
+    str::heapstr scheme("https"), host("subdomain.example.com"), path("/api/v2/resources/index.html");
+    for (auto _ : state)
+    {
+        auto url = str::concat(scheme, "://", host, ':', 8443, path);
+        benchmark::DoNotOptimize(url.data());
+    }
+}
+
+static void ConcatAppend(benchmark::State &state)
+{
+    str::heapstr scheme("https"), host("subdomain.example.com"), path("/api/v2/resources/index.html");
+    for (auto _ : state)
+    {
+        str::heapstr url;
+        url.append(scheme).append("://").append(host).append(':').append_int(8443).append(path);
+        benchmark::DoNotOptimize(url.data());
+    }
+}
+
+// keys of a query string, joined with '&'
+static std::vector<std::string> Keys()
+{
+    std::vector<std::string> keys;
+    for (int i = 0; i < 64; i++)
+        keys.push_back("key" + std::to_string(i * 7919) + "=value");
+
+    return keys;
+}
+
+static void Join(benchmark::State &state)
+{
+    std::vector<str::strview> keys;
+    auto storage = Keys();
+    for (auto &key : storage)
+        keys.emplace_back(key.data(), key.size());
+
+    for (auto _ : state)
+    {
+        auto query = str::join(keys, '&');
+        benchmark::DoNotOptimize(query.data());
+    }
+}
+
+static void JoinStdString(benchmark::State &state)
+{
+    auto keys = Keys();
+    for (auto _ : state)
+    {
+        std::string query;
+        for (auto &key : keys)
+        {
+            if (!query.empty())
+                query += '&';
+            query += key;
+        }
+        benchmark::DoNotOptimize(query.data());
+    }
+}
+
+BENCHMARK(Concat);
+BENCHMARK(ConcatEager);
+BENCHMARK(ConcatStdString);
+BENCHMARK(ConcatParts);
+BENCHMARK(ConcatAppend);
+BENCHMARK(Join);
+BENCHMARK(JoinStdString);
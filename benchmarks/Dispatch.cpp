@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+#include <str/heapstr>
+
+// sums the characters through operator[], size() is called on every iteration
+template <typename String>
+static size_t Sum(const String &str)
+{
+    size_t sum = 0;
+    for (size_t i = 0; i < str.size(); i++)
+        sum += static_cast<unsigned char>(str[i]);
+
+    return sum;
+}
+
+static void IndexStatic(benchmark::State &state)
+{
+    str::heapstr str('x', static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Sum(str));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+static void IndexAdapter(benchmark::State &state)
+{
+    str::heapstr storage('x', static_cast<size_t>(state.range(0)));
+    auto adapter = str::adapt(storage);
+
+    // hide the dynamic type, otherwise the calls are devirtualized
+    const str::str *str = &adapter;
+    benchmark::DoNotOptimize(str);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Sum(*str));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+static void AppendStatic(benchmark::State &state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    str::heapstr str;
+    for (auto _ : state)
+    {
+        str.clear();
+        for (size_t i = 0; i < count; i++)
+            str.push_back('x');
+
+        benchmark::DoNotOptimize(str.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void AppendAdapter(benchmark::State &state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    str::heapstr storage;
+    auto adapter = str::adapt(storage);
+
+    // hide the dynamic type, otherwise the calls are devirtualized
+    str::str *str = &adapter;
+    benchmark::DoNotOptimize(str);
+
+    for (auto _ : state)
+    {
+        str->clear();
+        for (size_t i = 0; i < count; i++)
+            str->push_back('x');
+
+        benchmark::DoNotOptimize(str->data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(IndexStatic)->Range(1 << 6, 1 << 16);
+BENCHMARK(IndexAdapter)->Range(1 << 6, 1 << 16);
+BENCHMARK(AppendStatic)->Range(1 << 6, 1 << 16);
+BENCHMARK(AppendAdapter)->Range(1 << 6, 1 << 16);
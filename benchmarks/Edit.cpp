@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+#include <str/heapstr>
+#include <str/stredit>
+#include <string>
+
+// inserts in the middle of the string, then erases it again
+static void InsertErase(benchmark::State &state)
+{
+    const auto size = static_cast<size_t>(state.range(0));
+    str::heapstr str('x', size);
+    str.reserve(size + 16);
+
+    for (auto _ : state)
+    {
+        str.insert(size / 2, "0123456789", 10);
+        str.erase(size / 2, 10);
+        benchmark::DoNotOptimize(str.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+// replaces a range in the middle of the string with a longer one, then restores it
+static void Replace(benchmark::State &state)
+{
+    const auto size = static_cast<size_t>(state.range(0));
+    str::heapstr str('x', size);
+    str.reserve(size + 16);
+
+    for (auto _ : state)
+    {
+        str.replace(size / 2, 4, "0123456789", 10);
+        str.replace(size / 2, 10, "xxxx", 4);
+        benchmark::DoNotOptimize(str.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+// inserts the first half of the string into its middle
+static void InsertSelf(benchmark::State &state)
+{
+    const auto size = static_cast<size_t>(state.range(0));
+    str::heapstr str('x', size);
+    str.reserve(size + size / 2);
+
+    for (auto _ : state)
+    {
+        str.insert(size / 2, str.c_str(), size / 2);
+        str.erase(size / 2, size / 2);
+        benchmark::DoNotOptimize(str.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+// applies 32 edits spread over the string one by one
+static void ManyEdits(benchmark::State &state)
+{
+    const auto size = static_cast<size_t>(state.range(0));
+    const std::string chars(size, 'x');
+    str::heapstr str;
+
+    for (auto _ : state)
+    {
+        str.assign(chars.data(), chars.size());
+        for (size_t i = 32; i > 0; i--)
+        {
+            str.erase(i * (size / 33), 2);
+            str.insert(i * (size / 33), "abcd", 4);
+        }
+
+        benchmark::DoNotOptimize(str.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+// applies the same 32 edits as one batch
+static void ManyEditsBatch(benchmark::State &state)
+{
+    const auto size = static_cast<size_t>(state.range(0));
+    const std::string chars(size, 'x');
+    str::heapstr str;
+
+    str::stredit edits;
+    for (size_t i = 1; i <= 32; i++)
+        edits.replace(i * (size / 33), 2, "abcd", 4);
+
+    for (auto _ : state)
+    {
+        str.assign(chars.data(), chars.size());
+        str.apply(edits);
+        benchmark::DoNotOptimize(str.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(InsertErase)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 24);
+BENCHMARK(Replace)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 24);
+BENCHMARK(InsertSelf)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 24);
+BENCHMARK(ManyEdits)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 24);
+BENCHMARK(ManyEditsBatch)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 24);
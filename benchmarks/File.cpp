@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+#include <str/file>
+#include <str/heapstr>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+// a log file of 16 MB with lines of 20 to 200 characters
+static const std::string &LogPath()
+{
+    static const std::string path = []
+    {
+        std::string path = "/tmp/str_benchmark_file.log";
+        std::ofstream out(path, std::ios::binary);
+        std::string line;
+        for (size_t size = 0, i = 0; size < (16u << 20); i++)
+        {
+            line.assign(20 + (i * 7919) % 180, 'a' + i % 26);
+            out << line << '\n';
+            size += line.size() + 1;
+        }
+
+        return path;
+    }();
+
+    return path;
+}
+
+static void ReadFileStream(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        std::ifstream in(LogPath(), std::ios::binary);
+        std::ostringstream os;
+        os << in.rdbuf();
+        auto str = os.str();
+        benchmark::DoNotOptimize(str.data());
+    }
+}
+
+static void ReadFileIterator(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        std::ifstream in(LogPath(), std::ios::binary);
+        str::heapstr str{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+        benchmark::DoNotOptimize(str.data());
+    }
+}
+
+static void ReadFile(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        auto str = str::read_file(LogPath().c_str());
+        benchmark::DoNotOptimize(str.data());
+    }
+}
+
+static void GetlineStd(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        std::ifstream in(LogPath(), std::ios::binary);
+        std::string line;
+        size_t total = 0;
+        while (std::getline(in, line))
+        {
+            total += line.size();
+        }
+
+        benchmark::DoNotOptimize(total);
+    }
+}
+
+static void GetlineStream(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        std::ifstream in(LogPath(), std::ios::binary);
+        str::heapstr line;
+        size_t total = 0;
+        while (str::getline(in, line))
+        {
+            total += line.size();
+        }
+
+        benchmark::DoNotOptimize(total);
+    }
+}
+
+static void GetlineReader(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        str::file_reader reader(LogPath().c_str());
+        str::heapstr line;
+        size_t total = 0;
+        while (str::getline(reader, line))
+        {
+            total += line.size();
+        }
+
+        benchmark::DoNotOptimize(total);
+    }
+}
+
+BENCHMARK(ReadFileStream)->Unit(benchmark::kMillisecond);
+BENCHMARK(ReadFileIterator)->Unit(benchmark::kMillisecond);
+BENCHMARK(ReadFile)->Unit(benchmark::kMillisecond);
+BENCHMARK(GetlineStd)->Unit(benchmark::kMillisecond);
+BENCHMARK(GetlineStream)->Unit(benchmark::kMillisecond);
+BENCHMARK(GetlineReader)->Unit(benchmark::kMillisecond);
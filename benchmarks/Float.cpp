@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+#include <str/stackstr>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+// finite values spread over all the exponents
+static std::vector<double> Values()
+{
+    std::mt19937_64 rng(42);
+    std::vector<double> values(1024);
+    for (auto &value : values)
+    {
+        do
+        {
+            auto bits = rng();
+            std::memcpy(&value, &bits, sizeof(value));
+        } while (value != value || value - value != 0);
+    }
+
+    return values;
+}
+
+static void AppendFloat(benchmark::State &state)
+{
+    auto values = Values();
+    str::stackstr<32> str;
+    for (auto _ : state)
+    {
+        for (auto value : values)
+        {
+            str.clear();
+            str.append_float(value);
+            benchmark::DoNotOptimize(str.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void AppendFloatPrecision(benchmark::State &state)
+{
+    auto values = Values();
+    str::stackstr<32> str;
+    for (auto _ : state)
+    {
+        for (auto value : values)
+        {
+            str.clear();
+            str.append_float(value, str::float_format::general, 17);
+            benchmark::DoNotOptimize(str.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void ToChars(benchmark::State &state)
+{
+    auto values = Values();
+    char buf[32];
+    for (auto _ : state)
+    {
+        for (auto value : values)
+        {
+            auto result = std::to_chars(buf, buf + sizeof(buf), value);
+            benchmark::DoNotOptimize(result.ptr);
+            benchmark::DoNotOptimize(buf);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void Snprintf(benchmark::State &state)
+{
+    auto values = Values();
+    char buf[32];
+    for (auto _ : state)
+    {
+        for (auto value : values)
+        {
+            auto result = std::snprintf(buf, sizeof(buf), "%.17g", value);
+            benchmark::DoNotOptimize(result);
+            benchmark::DoNotOptimize(buf);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+BENCHMARK(AppendFloat);
+BENCHMARK(AppendFloatPrecision);
+BENCHMARK(ToChars);
+BENCHMARK(Snprintf);
@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+#include <str/stackstr>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// values spread over all the digit counts
+static std::vector<uint64_t> Values()
+{
+    std::mt19937_64 rng(42);
+    std::vector<uint64_t> values(1024);
+    for (auto &value : values)
+        value = rng() >> (rng() % 64);
+
+    return values;
+}
+
+static void AppendInt(benchmark::State &state)
+{
+    auto values = Values();
+    str::stackstr<32> str;
+    for (auto _ : state)
+    {
+        for (auto value : values)
+        {
+            str.clear();
+            str.append_int(value);
+            benchmark::DoNotOptimize(str.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void ToChars(benchmark::State &state)
+{
+    auto values = Values();
+    char buf[32];
+    for (auto _ : state)
+    {
+        for (auto value : values)
+        {
+            auto result = std::to_chars(buf, buf + sizeof(buf), value);
+            benchmark::DoNotOptimize(result.ptr);
+            benchmark::DoNotOptimize(buf);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void Snprintf(benchmark::State &state)
+{
+    auto values = Values();
+    char buf[32];
+    for (auto _ : state)
+    {
+        for (auto value : values)
+        {
+            auto result = std::snprintf(buf, sizeof(buf), "%llu", static_cast<unsigned long long>(value));
+            benchmark::DoNotOptimize(result);
+            benchmark::DoNotOptimize(buf);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+BENCHMARK(AppendInt);
+BENCHMARK(ToChars);
+BENCHMARK(Snprintf);
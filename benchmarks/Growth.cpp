@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+#include <str/heapstr>
+#include <str/realloc>
+#include <str/strbuf>
+#include <memory>
+
+template <typename String>
+static void AppendChar(benchmark::State &state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        String str;
+        for (size_t i = 0; i < count; i++)
+            str.push_back('x');
+
+        benchmark::DoNotOptimize(str.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// grows a string to hundreds of MB by 1 MB chunks
+template <typename String>
+static void AppendLarge(benchmark::State &state)
+{
+    const auto size = static_cast<size_t>(state.range(0));
+    String chunk('x', 1 << 20);
+    for (auto _ : state)
+    {
+        String str;
+        while (str.size() < size)
+            str.append(chunk);
+
+        benchmark::DoNotOptimize(str.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+// appends words to short strings, counting the reallocations
+template <typename String>
+static void AppendWords(benchmark::State &state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    size_t reallocations = 0;
+    for (auto _ : state)
+    {
+        String str;
+        for (size_t i = 0; i < count; i++)
+        {
+            auto capacity = str.capacity();
+            str.append("word", 1 + i % 4);
+            str.push_back(' ');
+            reallocations += str.capacity() != capacity;
+        }
+
+        benchmark::DoNotOptimize(str.data());
+    }
+
+    state.counters["reallocs"] = benchmark::Counter(static_cast<double>(reallocations) / static_cast<double>(state.iterations()));
+}
+
+using heapstr_exact = str::basic_heapstr<char, std::char_traits<char>, std::allocator<char>, str::growth_exact>;
+using heapstr_1_5x = str::basic_heapstr<char, std::char_traits<char>, std::allocator<char>, str::growth_1_5x>;
+using heapstr_2x = str::basic_heapstr<char, std::char_traits<char>, std::allocator<char>, str::growth_2x>;
+using heapstr_size_class = str::basic_heapstr<char, std::char_traits<char>, std::allocator<char>, str::growth_size_class<>>;
+using bufstr_exact = str::basic_bufstr<64, char, std::char_traits<char>, std::allocator<char>, str::growth_exact>;
+using bufstr_default = str::bufstr<64>;
+
+// exact growth copies the whole string on every append, 1M appends take seconds
+BENCHMARK_TEMPLATE(AppendChar, heapstr_exact)->RangeMultiplier(8)->Range(1 << 8, 1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(AppendChar, heapstr_1_5x)->RangeMultiplier(8)->Range(1 << 8, 1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(AppendChar, heapstr_2x)->RangeMultiplier(8)->Range(1 << 8, 1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(AppendChar, heapstr_size_class)->RangeMultiplier(8)->Range(1 << 8, 1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(AppendChar, bufstr_exact)->RangeMultiplier(8)->Range(1 << 8, 1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(AppendChar, bufstr_default)->RangeMultiplier(8)->Range(1 << 8, 1 << 20)->Unit(benchmark::kMillisecond);
+
+using heapstr_realloc_exact = str::basic_heapstr<char, std::char_traits<char>, str::realloc_allocator<char>, str::growth_exact>;
+using heapstr_realloc = str::basic_heapstr<char, std::char_traits<char>, str::realloc_allocator<char>>;
+
+// the usable size of the malloc block, reported by realloc_allocator, absorbs appends which would reallocate
+BENCHMARK_TEMPLATE(AppendWords, heapstr_exact)->Arg(16)->Arg(256);
+BENCHMARK_TEMPLATE(AppendWords, heapstr_realloc_exact)->Arg(16)->Arg(256);
+BENCHMARK_TEMPLATE(AppendWords, str::heapstr)->Arg(16)->Arg(256);
+BENCHMARK_TEMPLATE(AppendWords, heapstr_realloc)->Arg(16)->Arg(256);
+
+// mremap moves the pages of the string instead of copying them into a new block
+BENCHMARK_TEMPLATE(AppendLarge, str::heapstr)->Arg(1 << 26)->Arg(1 << 28)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(AppendLarge, heapstr_realloc)->Arg(1 << 26)->Arg(1 << 28)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+#include <str/heapstr>
+#include <str/smallstr>
+#include <str/stackstr>
+#include <str/strbuf>
+#include <string>
+#include <vector>
+
+// reports the size of the string object, the characters are not counted
+template <typename String>
+static void Sizeof(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(sizeof(String));
+    }
+
+    state.counters["sizeof"] = sizeof(String);
+}
+
+// builds many short keys, like the keys of a large index held in memory
+template <typename String>
+static void ShortKeys(benchmark::State &state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    const char *key = "user:0123456789:name";
+
+    for (auto _ : state)
+    {
+        std::vector<String> keys;
+        keys.reserve(count);
+
+        for (size_t i = 0; i < count; i++)
+            keys.emplace_back(key, 8 + i % 13);
+
+        benchmark::DoNotOptimize(keys.data());
+    }
+
+    state.counters["bytes_per_key"] = sizeof(String);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(Sizeof, str::smallstr);
+BENCHMARK_TEMPLATE(Sizeof, str::heapstr);
+BENCHMARK_TEMPLATE(Sizeof, str::bufstr<16>);
+BENCHMARK_TEMPLATE(Sizeof, str::stackstr<16>);
+BENCHMARK_TEMPLATE(Sizeof, str::str_adapter<str::heapstr>);
+BENCHMARK_TEMPLATE(Sizeof, std::string);
+BENCHMARK_TEMPLATE(Sizeof, str::u16smallstr);
+BENCHMARK_TEMPLATE(Sizeof, str::u32smallstr);
+
+BENCHMARK_TEMPLATE(ShortKeys, str::smallstr)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(ShortKeys, std::string)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+#include <str/file>
+#include <str/mmapstr>
+#include <fstream>
+#include <string>
+
+// a text file of 64 MB with a single match near the end
+static const std::string &TextPath()
+{
+    static const std::string path = []
+    {
+        std::string path = "/tmp/str_benchmark_mmap.txt";
+        std::ofstream out(path, std::ios::binary);
+        std::string block(1 << 20, 'a');
+        for (int i = 0; i < 64; i++)
+        {
+            if (i == 60)
+            {
+                block.replace(1000, 6, "needle");
+            }
+
+            out << block;
+        }
+
+        return path;
+    }();
+
+    return path;
+}
+
+// the cost of making the file searchable
+static void OpenReadFile(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        auto str = str::read_file(TextPath().c_str());
+        benchmark::DoNotOptimize(str.data());
+    }
+}
+
+static void OpenMapped(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        str::mmapstr str(TextPath().c_str());
+        benchmark::DoNotOptimize(str.data());
+    }
+}
+
+// reads a few records at random offsets
+static void LookupReadFile(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        auto str = str::read_file(TextPath().c_str());
+        for (size_t offset = 0; offset < str.size(); offset += str.size() / 16)
+        {
+            benchmark::DoNotOptimize(str.compare(offset, 6, "needle"));
+        }
+    }
+}
+
+static void LookupMapped(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        str::mmapstr str(TextPath().c_str(), str::mmap_access::random);
+        for (size_t offset = 0; offset < str.size(); offset += str.size() / 16)
+        {
+            benchmark::DoNotOptimize(str.substr(offset, 6).compare("needle"));
+        }
+    }
+}
+
+// scans the whole file
+static void SearchReadFile(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        auto str = str::read_file(TextPath().c_str());
+        benchmark::DoNotOptimize(str.find("needle"));
+    }
+}
+
+static void SearchMapped(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        str::mmapstr str(TextPath().c_str(), str::mmap_access::sequential);
+        benchmark::DoNotOptimize(str.find("needle"));
+    }
+}
+
+BENCHMARK(OpenReadFile)->Unit(benchmark::kMillisecond);
+BENCHMARK(OpenMapped)->Unit(benchmark::kMicrosecond);
+BENCHMARK(LookupReadFile)->Unit(benchmark::kMillisecond);
+BENCHMARK(LookupMapped)->Unit(benchmark::kMicrosecond);
+BENCHMARK(SearchReadFile)->Unit(benchmark::kMillisecond);
+BENCHMARK(SearchMapped)->Unit(benchmark::kMillisecond);
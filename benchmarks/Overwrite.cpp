@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+#include <str/heapstr>
+#include <cstring>
+#include <vector>
+
+// reads a payload in chunks, like from a socket into a string
+static void ReadZeroFilled(benchmark::State &state)
+{
+    const auto size = static_cast<size_t>(state.range(0));
+    std::vector<char> source(size, 'x');
+
+    for (auto _ : state)
+    {
+        str::heapstr str;
+        for (size_t offset = 0; offset < size; offset += 4096)
+        {
+            auto len = str.size();
+            str.append('\0', 4096);
+            std::memcpy(str.data() + len, source.data() + offset, 4096);
+        }
+
+        benchmark::DoNotOptimize(str.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+static void ReadUninitialized(benchmark::State &state)
+{
+    const auto size = static_cast<size_t>(state.range(0));
+    std::vector<char> source(size, 'x');
+
+    for (auto _ : state)
+    {
+        str::heapstr str;
+        for (size_t offset = 0; offset < size; offset += 4096)
+        {
+            auto span = str.append_uninitialized(4096);
+            std::memcpy(span.data(), source.data() + offset, 4096);
+            span.commit(4096);
+        }
+
+        benchmark::DoNotOptimize(str.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+// decompresses into a string sized up front
+static void OverwriteZeroFilled(benchmark::State &state)
+{
+    const auto size = static_cast<size_t>(state.range(0));
+    std::vector<char> source(size, 'x');
+
+    for (auto _ : state)
+    {
+        str::heapstr str('\0', size);
+        std::memcpy(str.data(), source.data(), size);
+        benchmark::DoNotOptimize(str.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+static void ResizeAndOverwrite(benchmark::State &state)
+{
+    const auto size = static_cast<size_t>(state.range(0));
+    std::vector<char> source(size, 'x');
+
+    for (auto _ : state)
+    {
+        str::heapstr str;
+        str.resize_and_overwrite(size, [&source](char *ptr, size_t count)
+                                 {
+                                     std::memcpy(ptr, source.data(), count);
+                                     return count; });
+        benchmark::DoNotOptimize(str.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(ReadZeroFilled)->Arg(1 << 16)->Arg(1 << 22);
+BENCHMARK(ReadUninitialized)->Arg(1 << 16)->Arg(1 << 22);
+BENCHMARK(OverwriteZeroFilled)->Arg(1 << 16)->Arg(1 << 22);
+BENCHMARK(ResizeAndOverwrite)->Arg(1 << 16)->Arg(1 << 22);
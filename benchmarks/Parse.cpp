@@ -0,0 +1,157 @@
+#include <benchmark/benchmark.h>
+#include <str/strview>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+// digits of values spread over all the digit counts, separated by ';'
+static std::string Digits()
+{
+    std::mt19937_64 rng(42);
+    std::string digits;
+    for (size_t i = 0; i < 1024; i++)
+    {
+        digits += std::to_string(rng() >> (rng() % 64));
+        digits += ';';
+    }
+
+    return digits;
+}
+
+static void Parse(benchmark::State &state)
+{
+    auto digits = Digits();
+    for (auto _ : state)
+    {
+        str::strview view(digits.data(), digits.size());
+        while (!view.empty())
+        {
+            auto result = str::parse<uint64_t>(view);
+            benchmark::DoNotOptimize(result.value);
+            view.remove_prefix(result.count + 1);
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * digits.size());
+}
+
+static void FromChars(benchmark::State &state)
+{
+    auto digits = Digits();
+    for (auto _ : state)
+    {
+        const char *it = digits.data();
+        const char *end = it + digits.size();
+        while (it < end)
+        {
+            uint64_t value = 0;
+            it = std::from_chars(it, end, value).ptr + 1;
+            benchmark::DoNotOptimize(value);
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * digits.size());
+}
+
+static void Strtoull(benchmark::State &state)
+{
+    auto digits = Digits();
+    for (auto _ : state)
+    {
+        const char *it = digits.data();
+        const char *end = it + digits.size();
+        while (it < end)
+        {
+            char *next;
+            auto value = std::strtoull(it, &next, 10);
+            benchmark::DoNotOptimize(value);
+            it = next + 1;
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * digits.size());
+}
+
+// CSV rows of coordinates, prices and measurements, separated by ';'
+static std::string Reals()
+{
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> angle(-180, 180);
+    std::uniform_real_distribution<double> price(0, 10000);
+    std::lognormal_distribution<double> measure(0, 10);
+
+    std::string reals;
+    char buffer[64];
+    for (size_t i = 0; i < 1024; i++)
+    {
+        std::snprintf(buffer, sizeof(buffer), "%.6f;%.2f;%.17g;", angle(rng), price(rng), measure(rng));
+        reals += buffer;
+    }
+
+    return reals;
+}
+
+static void ParseDouble(benchmark::State &state)
+{
+    auto reals = Reals();
+    for (auto _ : state)
+    {
+        str::strview view(reals.data(), reals.size());
+        while (!view.empty())
+        {
+            auto result = str::parse<double>(view);
+            benchmark::DoNotOptimize(result.value);
+            view.remove_prefix(result.count + 1);
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * reals.size());
+}
+
+static void FromCharsDouble(benchmark::State &state)
+{
+    auto reals = Reals();
+    for (auto _ : state)
+    {
+        const char *it = reals.data();
+        const char *end = it + reals.size();
+        while (it < end)
+        {
+            double value;
+            it = std::from_chars(it, end, value).ptr + 1;
+            benchmark::DoNotOptimize(value);
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * reals.size());
+}
+
+static void Strtod(benchmark::State &state)
+{
+    auto reals = Reals();
+    for (auto _ : state)
+    {
+        const char *it = reals.data();
+        const char *end = it + reals.size();
+        while (it < end)
+        {
+            char *next;
+            auto value = std::strtod(it, &next);
+            benchmark::DoNotOptimize(value);
+            it = next + 1;
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * reals.size());
+}
+
+BENCHMARK(Parse);
+BENCHMARK(FromChars);
+BENCHMARK(Strtoull);
+BENCHMARK(ParseDouble);
+BENCHMARK(FromCharsDouble);
+BENCHMARK(Strtod);
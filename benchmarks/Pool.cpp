@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+#include <str/heapstr>
+#include <str/pool>
+#include <array>
+#include <atomic>
+#include <vector>
+
+template <typename Allocator>
+using heapstr_t = str::basic_heapstr<char, std::char_traits<char>, Allocator>;
+
+// each thread builds short strings of mixed sizes and frees them
+template <typename Allocator>
+static void Churn(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        std::vector<heapstr_t<Allocator>> strings;
+        strings.reserve(256);
+        for (int i = 0; i < 256; i++)
+        {
+            strings.emplace_back("key-");
+            strings.back().append_int(i * 1000003);
+            strings.back().append('.', static_cast<std::size_t>(i % 200));
+        }
+        benchmark::DoNotOptimize(strings.data());
+    }
+}
+
+// threads hand strings to each other, most of them are freed by another thread
+template <typename Allocator>
+static void Handoff(benchmark::State &state)
+{
+    static std::array<std::atomic<heapstr_t<Allocator> *>, 256> slots;
+
+    std::size_t slot = static_cast<std::size_t>(state.thread_index()) * 37;
+    for (auto _ : state)
+    {
+        for (int i = 0; i < 64; i++)
+        {
+            auto str = new heapstr_t<Allocator>("message ");
+            str->append_int(i);
+            str->append('-', static_cast<std::size_t>(i * 3));
+            delete slots[slot++ % slots.size()].exchange(str);
+        }
+    }
+
+    if (state.thread_index() == 0)
+    {
+        for (auto &other : slots)
+        {
+            delete other.exchange(nullptr);
+        }
+    }
+}
+
+BENCHMARK_TEMPLATE(Churn, std::allocator<char>)->ThreadRange(1, 8);
+BENCHMARK_TEMPLATE(Churn, str::pool_allocator<char>)->ThreadRange(1, 8);
+BENCHMARK_TEMPLATE(Handoff, std::allocator<char>)->ThreadRange(1, 8);
+BENCHMARK_TEMPLATE(Handoff, str::pool_allocator<char>)->ThreadRange(1, 8);
@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+#include <str/heapstr>
+#include <memory>
+#include <new>
+
+/// heapstr hidden from is_trivially_relocatable, relocated by move and destroy.
+struct moved_heapstr : str::heapstr
+{
+    using str::heapstr::heapstr;
+};
+
+// moves the strings of a container to a new buffer, like a vector growing
+template <typename String>
+static void Reallocate(benchmark::State &state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    std::allocator<String> alloc;
+
+    auto first = alloc.allocate(count);
+    auto dest = alloc.allocate(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        ::new (static_cast<void *>(first + i)) String("a string long enough for the heap");
+    }
+
+    for (auto _ : state)
+    {
+        str::relocate(first, first + count, dest);
+        std::swap(first, dest);
+        benchmark::DoNotOptimize(first);
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        first[i].~String();
+    }
+
+    alloc.deallocate(first, count);
+    alloc.deallocate(dest, count);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(Reallocate, moved_heapstr)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(Reallocate, str::heapstr)->Arg(1 << 10)->Arg(1 << 16);
@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+#include <str/heapstr>
+
+using heapstr_t = str::heapstr;
+
+// paths like "/var/log/service/2023-01-01/part-00042.log"
+static heapstr_t make_path(size_t len)
+{
+    heapstr_t path;
+    while (path.size() + 16 < len)
+    {
+        path.append("/segment-");
+        path.append('x', 6);
+    }
+
+    path.append(".log");
+    return path;
+}
+
+// the loops basic_str used before the vectorized kernels
+static size_t naive_rfind(const heapstr_t &str, char ch)
+{
+    auto ptr = str.data();
+    for (size_t i = str.size(); i > 0; i--)
+    {
+        if (ptr[i - 1] == ch)
+            return i - 1;
+    }
+
+    return heapstr_t::npos;
+}
+
+static size_t naive_rfind(const heapstr_t &str, const char *s, size_t count)
+{
+    auto ptr = str.data();
+    for (size_t i = str.size() - count + 1; i > 0; i--)
+    {
+        if (std::char_traits<char>::compare(ptr + i - 1, s, count) == 0)
+            return i - 1;
+    }
+
+    return heapstr_t::npos;
+}
+
+static size_t naive_find_last_not_of(const heapstr_t &str, char ch)
+{
+    auto ptr = str.data();
+    for (size_t i = str.size(); i > 0; i--)
+    {
+        if (ptr[i - 1] != ch)
+            return i - 1;
+    }
+
+    return heapstr_t::npos;
+}
+
+static void RFindChar_Naive(benchmark::State &state)
+{
+    auto path = make_path(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(naive_rfind(path, '#'));
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+static void RFindChar_Str(benchmark::State &state)
+{
+    auto path = make_path(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(path.rfind('#'));
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+static void RFindString_Naive(benchmark::State &state)
+{
+    auto path = make_path(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(naive_rfind(path, "/part-", 6));
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+static void RFindString_Str(benchmark::State &state)
+{
+    auto path = make_path(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(path.rfind("/part-"));
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+static void FindLastNotOf_Naive(benchmark::State &state)
+{
+    heapstr_t str('x', static_cast<size_t>(state.range(0)));
+    str.front() = '/';
+    for (auto _ : state)
+        benchmark::DoNotOptimize(naive_find_last_not_of(str, 'x'));
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+static void FindLastNotOf_Str(benchmark::State &state)
+{
+    heapstr_t str('x', static_cast<size_t>(state.range(0)));
+    str.front() = '/';
+    for (auto _ : state)
+        benchmark::DoNotOptimize(str.find_last_not_of('x'));
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(RFindChar_Naive)->Range(64, 1 << 20);
+BENCHMARK(RFindChar_Str)->Range(64, 1 << 20);
+BENCHMARK(RFindString_Naive)->Range(64, 1 << 20);
+BENCHMARK(RFindString_Str)->Range(64, 1 << 20);
+BENCHMARK(FindLastNotOf_Naive)->Range(64, 1 << 20);
+BENCHMARK(FindLastNotOf_Str)->Range(64, 1 << 20);
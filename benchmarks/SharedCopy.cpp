@@ -0,0 +1,38 @@
+#include <benchmark/benchmark.h>
+#include <str/sharedstr>
+#include <string>
+
+// copies a string, the shared string only increments a reference count
+template <typename String>
+static void Copy(benchmark::State &state)
+{
+    const std::string chars(static_cast<size_t>(state.range(0)), 'x');
+    const String str(chars.data(), chars.size());
+    for (auto _ : state)
+    {
+        String copy(str);
+        benchmark::DoNotOptimize(&copy);
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+// takes the second half of a string, sharedstr shares slices ending with the buffer
+template <typename String>
+static void Substr(benchmark::State &state)
+{
+    const auto size = static_cast<size_t>(state.range(0));
+    const std::string chars(size, 'x');
+    const String str(chars.data(), chars.size());
+    for (auto _ : state)
+    {
+        auto sub = str.substr(size / 2);
+        benchmark::DoNotOptimize(&sub);
+    }
+}
+
+BENCHMARK_TEMPLATE(Copy, str::sharedstr)->Range(1 << 4, 1 << 16);
+BENCHMARK_TEMPLATE(Copy, std::string)->Range(1 << 4, 1 << 16);
+
+BENCHMARK_TEMPLATE(Substr, str::sharedstr)->Range(1 << 4, 1 << 16);
+BENCHMARK_TEMPLATE(Substr, std::string)->Range(1 << 4, 1 << 16);
@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+#include <str/heapstr>
+#include <str/strstream>
+#include <sstream>
+#include <string>
+
+// writes a large string to a stream
+template <typename String>
+static void Insert(benchmark::State &state)
+{
+    String str(std::string(static_cast<size_t>(state.range(0)), 'x').c_str());
+    std::ostringstream os;
+
+    for (auto _ : state)
+    {
+        os.seekp(0);
+        os << str;
+        benchmark::DoNotOptimize(os.tellp());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+// tokenizes whitespace separated words
+template <typename String>
+static void Extract(benchmark::State &state)
+{
+    std::string text;
+    for (int i = 0; i < 1000; i++)
+    {
+        text += std::string(static_cast<size_t>(state.range(0)), 'a' + i % 26) + ' ';
+    }
+
+    String word;
+    for (auto _ : state)
+    {
+        std::istringstream is(text);
+        while (is >> word)
+        {
+            benchmark::DoNotOptimize(word.data());
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+
+// formats a log line into a string
+static void FormatOStringStream(benchmark::State &state)
+{
+    str::heapstr line;
+    for (auto _ : state)
+    {
+        std::ostringstream os;
+        os << "request " << 12345 << " took " << 1.25 << " ms from " << "127.0.0.1";
+        line = os.str().c_str();
+        benchmark::DoNotOptimize(line.data());
+    }
+}
+
+static void FormatStrOStream(benchmark::State &state)
+{
+    str::heapstr line;
+    for (auto _ : state)
+    {
+        line.clear();
+        str::basic_strostream<str::heapstr> os(line);
+        os << "request " << 12345 << " took " << 1.25 << " ms from " << "127.0.0.1";
+        benchmark::DoNotOptimize(os.str().data());
+    }
+}
+
+BENCHMARK_TEMPLATE(Insert, std::string)->Arg(64)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(Insert, str::heapstr)->Arg(64)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(Extract, std::string)->Arg(8)->Arg(256);
+BENCHMARK_TEMPLATE(Extract, str::heapstr)->Arg(8)->Arg(256);
+BENCHMARK(FormatOStringStream);
+BENCHMARK(FormatStrOStream);
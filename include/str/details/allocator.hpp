@@ -0,0 +1,125 @@
+#pragma once
+#include "common.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+STR_NAMESPACE_MAIN_BEGIN
+
+/// Result of allocate_at_least(), like std::allocation_result:
+/// the allocation and the count of elements it can hold.
+template <typename Pointer, typename Size = std::size_t>
+struct allocation_result
+{
+    Pointer ptr;
+    Size count;
+};
+
+STR_NAMESPACE_DETAILS_BEGIN
+
+/// Stores an allocator together with a value.
+/// Empty allocators are kept as a base class, so they take no space.
+template <typename Allocator, typename Value,
+          bool Empty = std::is_empty_v<Allocator> && !std::is_final_v<Allocator>>
+class alloc_storage : private Allocator
+{
+public:
+    STR_CONSTEXPR alloc_storage(const Allocator &alloc) STR_NOEXCEPT
+        : Allocator(alloc), value{} {}
+
+    STR_CONSTEXPR alloc_storage(Allocator &&alloc) STR_NOEXCEPT
+        : Allocator(std::move(alloc)), value{} {}
+
+    STR_CONSTEXPR Allocator &allocator() STR_NOEXCEPT
+    {
+        return *this;
+    }
+
+    STR_CONSTEXPR const Allocator &allocator() const STR_NOEXCEPT
+    {
+        return *this;
+    }
+
+public:
+    Value value;
+};
+
+template <typename Allocator, typename Value>
+class alloc_storage<Allocator, Value, false>
+{
+public:
+    STR_CONSTEXPR alloc_storage(const Allocator &alloc) STR_NOEXCEPT
+        : alloc_(alloc), value{} {}
+
+    STR_CONSTEXPR alloc_storage(Allocator &&alloc) STR_NOEXCEPT
+        : alloc_(std::move(alloc)), value{} {}
+
+    STR_CONSTEXPR Allocator &allocator() STR_NOEXCEPT
+    {
+        return alloc_;
+    }
+
+    STR_CONSTEXPR const Allocator &allocator() const STR_NOEXCEPT
+    {
+        return alloc_;
+    }
+
+protected:
+    Allocator alloc_;
+
+public:
+    Value value;
+};
+
+template <typename Allocator, typename = void>
+struct has_allocate_at_least : std::false_type
+{
+};
+
+template <typename Allocator>
+struct has_allocate_at_least<Allocator, std::void_t<decltype(std::declval<Allocator &>().allocate_at_least(std::size_t()))>>
+    : std::true_type
+{
+};
+
+/// Checks whether Allocator can resize a block, moving its elements as bytes:
+/// reallocate(ptr, count, new_count) returning an allocation_result.
+template <typename Allocator, typename = void>
+struct has_reallocate : std::false_type
+{
+};
+
+template <typename Allocator>
+struct has_reallocate<Allocator, std::void_t<decltype(std::declval<Allocator &>().reallocate(
+                                     std::declval<typename std::allocator_traits<Allocator>::pointer>(),
+                                     std::size_t(), std::size_t()))>>
+    : std::true_type
+{
+};
+
+/// Allocates at least count elements and returns how many fit in the block.
+/// The block is freed with the returned count. Allocators providing allocate_at_least()
+/// report their size class, others, std::allocator included, get exactly count:
+/// the usable size of an operator new block cannot be passed back to sized delete.
+template <typename Allocator>
+STR_CONSTEXPR allocation_result<typename std::allocator_traits<Allocator>::pointer,
+                                typename std::allocator_traits<Allocator>::size_type>
+allocate_at_least(Allocator &alloc, typename std::allocator_traits<Allocator>::size_type count)
+{
+    using traits = std::allocator_traits<Allocator>;
+
+    if constexpr (has_allocate_at_least<Allocator>::value)
+    {
+        auto result = alloc.allocate_at_least(count);
+        return { result.ptr, result.count };
+    }
+    else
+    {
+        return { traits::allocate(alloc, count), count };
+    }
+}
+
+STR_NAMESPACE_DETAILS_END
+STR_NAMESPACE_MAIN_END
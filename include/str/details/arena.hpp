@@ -0,0 +1,232 @@
+#pragma once
+#include "common.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#ifdef STR_HAS_PMR
+#include <memory_resource>
+#endif
+
+STR_NAMESPACE_MAIN_BEGIN
+
+/// Monotonic arena, allocations bump a pointer through chunks which grow geometrically
+/// and are all freed at once by reset() or the destructor. Strings which die together,
+/// like the ones built for a request, are allocated from it through arena_allocator
+/// without a free per string. deallocate() only gives back the latest allocation,
+/// so a string growing at the top of the arena reuses its space.
+/// It is also a std::pmr::memory_resource, for polymorphic_allocator.
+/// @note it is not thread-safe.
+class arena
+#ifdef STR_HAS_PMR
+    : public std::pmr::memory_resource
+#endif
+{
+public:
+    static constexpr std::size_t min_chunk_size = 256;
+
+    explicit arena(std::size_t chunk_size = 4096) STR_NOEXCEPT
+        : next_size_{std::max(chunk_size, min_chunk_size)} {}
+
+    /// Allocates from buffer until it is full, buffer is not freed by the arena.
+    arena(void *buffer, std::size_t size) STR_NOEXCEPT
+        : ptr_{static_cast<char *>(buffer)}, end_{static_cast<char *>(buffer) + size},
+          buffer_{static_cast<char *>(buffer)}, buffer_size_{size},
+          next_size_{std::max(size * 2, min_chunk_size)} {}
+
+    arena(const arena &) = delete;
+    arena &operator=(const arena &) = delete;
+
+    ~arena()
+    {
+        release();
+    }
+
+    /// Returns bytes aligned to align, from the current chunk or a new one.
+    void *allocate(std::size_t bytes, std::size_t align = alignof(std::max_align_t))
+    {
+        void *ptr = ptr_;
+        auto space = static_cast<std::size_t>(end_ - ptr_);
+        if (ptr_ == nullptr || std::align(align, bytes, ptr, space) == nullptr)
+        {
+            ptr = grow_(bytes, align);
+        }
+
+        last_ = static_cast<char *>(ptr);
+        ptr_ = last_ + bytes;
+        return ptr;
+    }
+
+    /// Gives back ptr if it is the latest allocation, else the bytes are freed by reset().
+    void deallocate(void *ptr, std::size_t bytes, std::size_t = alignof(std::max_align_t)) STR_NOEXCEPT
+    {
+        if (ptr == last_ && last_ + bytes == ptr_)
+        {
+            ptr_ = last_;
+            last_ = nullptr;
+        }
+    }
+
+    /// Frees every allocation. The latest chunk is kept and reused,
+    /// so an arena reset after each request stops allocating once warmed up.
+    void reset() STR_NOEXCEPT
+    {
+        if (chunks_ == nullptr)
+        {
+            ptr_ = buffer_;
+            end_ = buffer_ + buffer_size_;
+            last_ = nullptr;
+            return;
+        }
+
+        free_(chunks_->next);
+        chunks_->next = nullptr;
+
+        ptr_ = reinterpret_cast<char *>(chunks_ + 1);
+        end_ = reinterpret_cast<char *>(chunks_) + chunks_->size;
+        last_ = nullptr;
+    }
+
+    /// Frees every allocation and every chunk.
+    void release() STR_NOEXCEPT
+    {
+        free_(chunks_);
+        chunks_ = nullptr;
+        reset();
+    }
+
+    /// Returns the count of bytes obtained from the heap, the initial buffer excluded.
+    std::size_t chunks_size() const STR_NOEXCEPT
+    {
+        std::size_t size = 0;
+        for (auto chunk = chunks_; chunk; chunk = chunk->next)
+        {
+            size += chunk->size;
+        }
+
+        return size;
+    }
+
+protected:
+    struct chunk_t
+    {
+        chunk_t *next;
+        std::size_t size;
+    };
+
+    void *grow_(std::size_t bytes, std::size_t align)
+    {
+        auto required = sizeof(chunk_t) + bytes + align;
+        if (required < bytes)
+            throw std::bad_alloc();
+
+        auto size = std::max(next_size_, required);
+        auto chunk = static_cast<chunk_t *>(::operator new(size));
+        chunk->next = chunks_;
+        chunk->size = size;
+        chunks_ = chunk;
+
+        if (next_size_ <= std::numeric_limits<std::size_t>::max() / 2)
+            next_size_ *= 2;
+
+        void *ptr = chunk + 1;
+        auto space = size - sizeof(chunk_t);
+        end_ = reinterpret_cast<char *>(chunk) + size;
+        return std::align(align, bytes, ptr, space);
+    }
+
+    static void free_(chunk_t *chunk) STR_NOEXCEPT
+    {
+        while (chunk)
+        {
+            auto next = chunk->next;
+            ::operator delete(chunk);
+            chunk = next;
+        }
+    }
+
+#ifdef STR_HAS_PMR
+    void *do_allocate(std::size_t bytes, std::size_t align) override
+    {
+        return allocate(bytes, align);
+    }
+
+    void do_deallocate(void *ptr, std::size_t bytes, std::size_t align) override
+    {
+        deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const STR_NOEXCEPT override
+    {
+        return this == &other;
+    }
+#endif
+
+protected:
+    char *ptr_ = nullptr;
+    char *end_ = nullptr;
+    char *last_ = nullptr;
+    char *buffer_ = nullptr;
+    std::size_t buffer_size_ = 0;
+    std::size_t next_size_;
+    chunk_t *chunks_ = nullptr;
+};
+
+/// Stateful allocator drawing from an arena, strings using it are freed with the arena.
+/// Like std::pmr::polymorphic_allocator it does not propagate, a string keeps its
+/// arena when assigned, moving between arenas copies the characters.
+template <typename T>
+class arena_allocator
+{
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+    using is_always_equal = std::false_type;
+
+    arena_allocator(arena &resource) STR_NOEXCEPT
+        : arena_{&resource} {}
+
+    template <typename U>
+    arena_allocator(const arena_allocator<U> &other) STR_NOEXCEPT
+        : arena_{other.resource()} {}
+
+    T *allocate(std::size_t count)
+    {
+        if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            throw std::bad_array_new_length();
+
+        return static_cast<T *>(arena_->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *ptr, std::size_t count) STR_NOEXCEPT
+    {
+        arena_->deallocate(ptr, count * sizeof(T), alignof(T));
+    }
+
+    arena *resource() const STR_NOEXCEPT
+    {
+        return arena_;
+    }
+
+protected:
+    arena *arena_;
+};
+
+template <typename T, typename U>
+bool operator==(const arena_allocator<T> &lhs, const arena_allocator<U> &rhs) STR_NOEXCEPT
+{
+    return lhs.resource() == rhs.resource();
+}
+
+template <typename T, typename U>
+bool operator!=(const arena_allocator<T> &lhs, const arena_allocator<U> &rhs) STR_NOEXCEPT
+{
+    return lhs.resource() != rhs.resource();
+}
+
+STR_NAMESPACE_MAIN_END
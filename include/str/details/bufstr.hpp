@@ -3,15 +3,20 @@
 
 STR_NAMESPACE_MAIN_BEGIN
 
-template <typename Size, typename Char, typename CharTraits = std::char_traits<char>, typename Allocator = std::allocator<Char>>
-class basic_bufstr : public basic_str<Char, CharTraits, Allocator>
+template <size_t Size, typename Char, typename CharTraits = std::char_traits<Char>, typename Allocator = std::allocator<Char>,
+          typename GrowthPolicy = default_growth>
+class basic_bufstr : public basic_str_core<basic_bufstr<Size, Char, CharTraits, Allocator, GrowthPolicy>,
+                                           Char, CharTraits, Allocator>
 {
-    using this_t = basic_bufstr<Size, Char, CharTraits, Allocator>;
+    using this_t = basic_bufstr<Size, Char, CharTraits, Allocator, GrowthPolicy>;
 
 public:
-    using base_t = basic_str<Char, CharTraits, Allocator>;
+    using base_t = basic_str_core<this_t, Char, CharTraits, Allocator>;
+    using growth_policy = GrowthPolicy;
     using value_type = typename base_t::value_type;
     using traits_type = typename base_t::traits_type;
+    using allocator_type = typename base_t::allocator_type;
+    using allocator_traits = typename base_t::allocator_traits;
     using size_type = typename base_t::size_type;
     using difference_type = typename base_t::difference_type;
     using reference = typename base_t::reference;
@@ -23,23 +28,56 @@ public:
     using reverse_iterator = typename base_t::reverse_iterator;
     using const_reverse_iterator = typename base_t::const_reverse_iterator;
 
+    using base_t::npos;
+    using base_t::operator=;
+    using base_t::resize;
+
+    friend base_t;
+
+    template <typename String>
+    friend class basic_str_adapter;
+
 public:
     //////////////////////////////////////////////////////////////////////
     // CONSTRUCTORS / DESTRUCTOR
     //////////////////////////////////////////////////////////////////////
 
-    STR_CONSTEXPR ~basic_bufstr() STR_NOEXCEPT = default;
-
     STR_CONSTEXPR basic_bufstr(const Allocator &alloc = Allocator())
         : alloc_{alloc} {}
 
-    template <typename OtherCharTraits, typename OtherAllocator>
-    STR_CONSTEXPR basic_bufstr(basic_bufstr<Char, OtherCharTraits, OtherAllocator> &&other,
-                               const Allocator &alloc = Allocator()) : alloc_{alloc}
+    STR_CONSTEXPR basic_bufstr(const basic_bufstr &other)
+        : alloc_{allocator_traits::select_on_container_copy_construction(other.alloc_)}
     {
-        std::swap(data_, other.data_);
-        std::swap(size_, other.size_);
-        std::swap(capacity_, other.capacity_);
+        this->append(other.data(), other.size());
+    }
+
+    STR_CONSTEXPR basic_bufstr(const basic_bufstr &other, const Allocator &alloc)
+        : alloc_{alloc}
+    {
+        this->append(other.data(), other.size());
+    }
+
+    /// Takes the heap buffer of other, characters on its stack are copied.
+    STR_CONSTEXPR basic_bufstr(basic_bufstr &&other) STR_NOEXCEPT
+        : alloc_{std::move(other.alloc_)}
+    {
+        take_(other);
+    }
+
+    /// Takes the heap buffer of other if alloc can free it, else copies the characters.
+    STR_CONSTEXPR basic_bufstr(basic_bufstr &&other, const Allocator &alloc)
+        : alloc_{alloc}
+    {
+        if constexpr (!allocator_traits::is_always_equal::value)
+        {
+            if (alloc_ != other.alloc_)
+            {
+                this->append(std::as_const(other).data(), other.size());
+                return;
+            }
+        }
+
+        take_(other);
     }
 
     STR_CONSTEXPR basic_bufstr(size_type size, const Allocator &alloc = Allocator())
@@ -51,57 +89,116 @@ public:
     STR_CONSTEXPR basic_bufstr(value_type ch, size_type count, const Allocator &alloc = Allocator())
         : alloc_{alloc}
     {
-        append(ch, count);
+        this->append(ch, count);
     }
 
     STR_CONSTEXPR basic_bufstr(const value_type *s, const Allocator &alloc = Allocator())
         : alloc_{alloc}
     {
-        append(s);
+        this->append(s);
     }
     STR_CONSTEXPR basic_bufstr(const value_type *s, size_type count, const Allocator &alloc = Allocator())
         : alloc_{alloc}
     {
-        append(s, count);
+        this->append(s, count);
     }
 
     template <typename InputIt>
     STR_CONSTEXPR basic_bufstr(InputIt first, InputIt last, const Allocator &alloc = Allocator())
         : alloc_{alloc}
     {
-        append(first, last);
+        this->append(first, last);
     }
 
     STR_CONSTEXPR basic_bufstr(std::initializer_list<value_type> ilist, const Allocator &alloc = Allocator())
         : alloc_{alloc}
     {
-        append(ilist);
+        this->append(ilist);
     }
 
     template <typename StringLike>
     STR_CONSTEXPR basic_bufstr(const StringLike &str, size_type str_index = 0, const Allocator &alloc = Allocator())
         : alloc_{alloc}
     {
-        append(str, str_index, npos);
+        this->append(str, str_index, npos);
     }
 
     template <typename StringLike>
     STR_CONSTEXPR basic_bufstr(const StringLike &str, size_type str_index, size_type str_count = npos, const Allocator &alloc = Allocator())
         : alloc_{alloc}
     {
-        append(str, str_index, str_count);
+        this->append(str, str_index, str_count);
+    }
+
+    STR_CONSTEXPR ~basic_bufstr() STR_NOEXCEPT
+    {
+        if (heap_)
+        {
+            deallocate_(heap_, capacity_);
+        }
+    }
+
+    STR_CONSTEXPR basic_bufstr &operator=(const basic_bufstr &other)
+    {
+        if (this == &other)
+            return *this;
+
+        if constexpr (allocator_traits::propagate_on_container_copy_assignment::value)
+        {
+            if constexpr (!allocator_traits::is_always_equal::value)
+            {
+                // memory of this string cannot be freed with the allocator of other
+                if (alloc_ != other.alloc_)
+                {
+                    release_();
+                }
+            }
+
+            alloc_ = other.alloc_;
+        }
+
+        this->assign(other.data(), other.size());
+        return *this;
+    }
+
+    STR_CONSTEXPR basic_bufstr &operator=(basic_bufstr &&other) STR_NOEXCEPT_IF(
+        allocator_traits::propagate_on_container_move_assignment::value || allocator_traits::is_always_equal::value)
+    {
+        if (this == &other)
+            return *this;
+
+        if constexpr (!allocator_traits::propagate_on_container_move_assignment::value &&
+                      !allocator_traits::is_always_equal::value)
+        {
+            // memory of other cannot be freed with our allocator
+            if (alloc_ != other.alloc_)
+            {
+                this->assign(std::as_const(other).data(), other.size());
+                return *this;
+            }
+        }
+
+        release_();
+
+        if constexpr (allocator_traits::propagate_on_container_move_assignment::value)
+        {
+            alloc_ = std::move(other.alloc_);
+        }
+
+        take_(other);
+        return *this;
     }
 
     //////////////////////////////////////////////////////////////////////
     // ELEMENT ACCESS
     //////////////////////////////////////////////////////////////////////
 
-    STR_CONSTEXPR pointer data() STR_NOEXCEPT override
+    STR_CONSTEXPR pointer data() STR_NOEXCEPT
     {
         return data_;
     }
 
-    STR_CONSTEXPR const_pointer data() const STR_NOEXCEPT override
+    STR_CONSTEXPR const_pointer data() const STR_NOEXCEPT
     {
         return data_;
     }
@@ -110,33 +207,62 @@ public:
     // CAPACITY
     //////////////////////////////////////////////////////////////////////
 
-    STR_CONSTEXPR size_type size() const STR_NOEXCEPT override
+    STR_CONSTEXPR size_type size() const STR_NOEXCEPT
     {
         return size_;
     }
 
-    STR_CONSTEXPR void set_size_(size_type size) STR_NOEXCEPT override
+    STR_CONSTEXPR size_type max_size() const STR_NOEXCEPT
     {
-        size_ = size;
+        return allocator_traits::max_size(alloc_);
+    }
+
+    STR_CONSTEXPR size_type capacity() const STR_NOEXCEPT
+    {
+        return std::max(Size, capacity_);
     }
 
-    STR_CONSTEXPR size_type max_size() const STR_NOEXCEPT override
+    STR_CONSTEXPR allocator_type get_allocator() const STR_NOEXCEPT
     {
-        return alloc_.max_size();
+        return alloc_;
     }
 
-    STR_CONSTEXPR size_type capacity() const STR_NOEXCEPT override
+protected:
+    STR_CONSTEXPR void set_size_(size_type size) STR_NOEXCEPT
     {
-        return std::max(Size, capacity_);
+        size_ = size;
+    }
+
+    /// The stack buffer is used as is, growth only applies once on the heap.
+    STR_CONSTEXPR size_type recommend_(size_type required) const STR_NOEXCEPT
+    {
+        if (required <= Size)
+            return required;
+
+        return growth_policy::template grow<value_type, size_type>(capacity(), required, max_size());
     }
 
+public:
     //////////////////////////////////////////////////////////////////////
     // OPERATIONS
     //////////////////////////////////////////////////////////////////////
 
-    STR_CONSTEXPR void resize(size_type cap, value_type ch) override
+    STR_CONSTEXPR void resize(size_type cap, value_type ch)
+    {
+        resize_(cap, &ch);
+    }
+
+protected:
+    /// Sets the capacity to cap without initializing the new characters.
+    STR_CONSTEXPR void reserve_(size_type cap)
+    {
+        resize_(cap, nullptr);
+    }
+
+    /// Sets the capacity to cap, the new characters are set to *fill unless it is null.
+    STR_CONSTEXPR void resize_(size_type cap, const value_type *fill)
     {
-        assert_length_(cap);
+        this->assert_length_(cap);
 
         if (capacity_ == cap)
             return;
@@ -146,10 +272,11 @@ public:
         {
             if (!is_stack())
             {
-                std::memset(stack_, heap_, cap);
+                size_ = std::min(size_, cap);
+                traits_type::copy(stack_, heap_, size_);
 
 #ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
-                stack_[cap] = '\0';
+                stack_[size_] = '\0';
 #endif
                 data_ = stack_;
 
@@ -162,7 +289,7 @@ public:
                     heap_ = nullptr;
                     capacity_ = 0;
 
-                    alloc_.deallocate(old_heap, old_capacity);
+                    deallocate_(old_heap, old_capacity);
                 }
             }
 
@@ -174,32 +301,26 @@ public:
         pointer ptr = nullptr;
         if (cap > 0)
         {
-
-#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
-            ptr = alloc_.allocate(cap + 1);
-#else
-            ptr = alloc_.allocate(cap);
-#endif
+            ptr = allocate_(cap);
             if (ptr == nullptr)
                 return;
 
-            if (cap < size_)
-            {
-                std::memcpy(ptr, data_, cap - 1);
-            }
-            else
+            auto count = std::min(size_, cap);
+            traits_type::copy(ptr, data_, count);
+
+            if (fill)
             {
-                std::memcpy(ptr, data_, size_);
-                std::memset(ptr + cap, ch, cap - size_);
+                traits_type::assign(ptr + count, cap - count, *fill);
             }
 
 #ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
+            ptr[count] = '\0';
             ptr[cap] = '\0';
 #endif
         }
 
         // cache old data for exception safety
-        auto old_ptr = data_;
+        auto old_ptr = heap_;
         auto old_cap = capacity_;
 
         // write new data, old data is cached
@@ -212,10 +333,24 @@ public:
         // an exception will have no effect now
         if (old_ptr)
         {
-            alloc_.deallocate(old_ptr, old_cap);
+            deallocate_(old_ptr, old_cap);
         }
     }
 
+public:
+    /// Exchanges the contents with other. The allocators are exchanged if they propagate
+    /// on swap, else they must compare equal.
+    STR_CONSTEXPR void swap(basic_bufstr &other) STR_NOEXCEPT
+    {
+        if constexpr (allocator_traits::propagate_on_container_swap::value)
+        {
+            using std::swap;
+            swap(alloc_, other.alloc_);
+        }
+
+        swap_(other);
+    }
+
     STR_CONSTEXPR bool is_stack() const STR_NOEXCEPT
     {
         return data_ == stack_ ? true : false;
@@ -226,6 +361,90 @@ public:
         return data_ == heap_ ? true : false;
     }
 
+protected:
+    STR_CONSTEXPR pointer allocate_(size_type cap)
+    {
+#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
+        return allocator_traits::allocate(alloc_, cap + 1);
+#else
+        return allocator_traits::allocate(alloc_, cap);
+#endif
+    }
+
+    STR_CONSTEXPR void deallocate_(pointer ptr, size_type cap) STR_NOEXCEPT
+    {
+#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
+        allocator_traits::deallocate(alloc_, ptr, cap + 1);
+#else
+        allocator_traits::deallocate(alloc_, ptr, cap);
+#endif
+    }
+
+    /// Frees the heap buffer, the string is left empty on the stack.
+    STR_CONSTEXPR void release_() STR_NOEXCEPT
+    {
+        if (heap_)
+        {
+            deallocate_(heap_, capacity_);
+        }
+
+        heap_ = nullptr;
+        data_ = stack_;
+        size_ = 0;
+        capacity_ = 0;
+        stack_[0] = '\0';
+    }
+
+    /// Takes the buffers of other into this empty string, only the characters
+    /// in use on the stack of other are copied. other is left empty.
+    STR_CONSTEXPR void take_(basic_bufstr &other) STR_NOEXCEPT
+    {
+        auto other_heap = other.is_heap();
+        if (!other_heap)
+        {
+#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
+            traits_type::copy(stack_, other.stack_, other.size_ + 1);
+#else
+            traits_type::copy(stack_, other.stack_, other.size_);
+#endif
+        }
+
+        heap_ = other.heap_;
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        data_ = other_heap ? heap_ : stack_;
+
+        other.heap_ = nullptr;
+        other.data_ = other.stack_;
+        other.size_ = 0;
+        other.capacity_ = 0;
+        other.stack_[0] = '\0';
+    }
+
+    /// Exchanges the buffers, not the allocators.
+    /// heap buffers are handed over, the characters on the stacks are exchanged.
+    STR_CONSTEXPR void swap_(basic_bufstr &other) STR_NOEXCEPT
+    {
+        auto heap = is_heap();
+        auto other_heap = other.is_heap();
+
+        auto count = std::max(heap ? 0 : size_, other_heap ? 0 : other.size_);
+#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
+        count++;
+#endif
+        for (size_type i = 0; i < count; i++)
+        {
+            std::swap(stack_[i], other.stack_[i]);
+        }
+
+        std::swap(heap_, other.heap_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+
+        data_ = other_heap ? heap_ : stack_;
+        other.data_ = heap ? other.heap_ : other.stack_;
+    }
+
 protected:
 #ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
     value_type stack_[Size + 1];
@@ -254,4 +473,27 @@ using u16bufstr = basic_bufstr<Size, char16_t>;
 template <size_t Size>
 using u32bufstr = basic_bufstr<Size, char32_t>;
 
+#ifdef STR_HAS_PMR
+namespace pmr
+{
+template <size_t Size, typename Char>
+using basic_bufstr = ::STR_NAMESPACE_MAIN::basic_bufstr<Size, Char, std::char_traits<Char>, std::pmr::polymorphic_allocator<Char>>;
+
+template <size_t Size>
+using bufstr = basic_bufstr<Size, char>;
+
+template <size_t Size>
+using wbufstr = basic_bufstr<Size, wchar_t>;
+
+template <size_t Size>
+using u8bufstr = basic_bufstr<Size, char8_t>;
+
+template <size_t Size>
+using u16bufstr = basic_bufstr<Size, char16_t>;
+
+template <size_t Size>
+using u32bufstr = basic_bufstr<Size, char32_t>;
+}
+#endif
+
 STR_NAMESPACE_MAIN_END
\ No newline at end of file
@@ -0,0 +1,324 @@
+#pragma once
+#include "common.hpp"
+#include "simd.hpp"
+#include "search.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+STR_NAMESPACE_MAIN_BEGIN
+STR_NAMESPACE_DETAILS_BEGIN
+
+/// Unsigned integer with the same size as the code unit.
+template <std::size_t UnitSize>
+struct unit_of;
+
+template <>
+struct unit_of<1>
+{
+    using type = std::uint8_t;
+};
+
+template <>
+struct unit_of<2>
+{
+    using type = std::uint16_t;
+};
+
+template <>
+struct unit_of<4>
+{
+    using type = std::uint32_t;
+};
+
+STR_NAMESPACE_DETAILS_END
+
+/// Set of characters built once and used by the find_first_of family.
+/// Code units below 256 are kept in a bitmap and in nibble lookup tables
+/// used by the ssse3/avx2 kernels, wider code units are kept in a list.
+/// Membership is decided by comparing code units, CharTraits::eq is not used.
+template <typename Char>
+class basic_charset
+{
+public:
+    using value_type = Char;
+    using size_type = std::size_t;
+    using unit_type = typename details::unit_of<sizeof(Char)>::type;
+
+public:
+    //////////////////////////////////////////////////////////////////////
+    // CONSTRUCTORS / DESTRUCTOR
+    //////////////////////////////////////////////////////////////////////
+
+    STR_CONSTEXPR basic_charset() STR_NOEXCEPT = default;
+
+    /// Builds the set from the null-terminated string s.
+    STR_CONSTEXPR basic_charset(const value_type *s)
+        : basic_charset(s, std::char_traits<value_type>::length(s)) {}
+
+    /// Builds the set from the characters in the range [s, s + count).
+    STR_CONSTEXPR basic_charset(const value_type *s, size_type count)
+    {
+        for (size_type i = 0; i < count; i++)
+        {
+            insert(s[i]);
+        }
+    }
+
+    STR_CONSTEXPR basic_charset(std::initializer_list<value_type> ilist)
+        : basic_charset(ilist.begin(), ilist.size()) {}
+
+    //////////////////////////////////////////////////////////////////////
+    // OPERATIONS
+    //////////////////////////////////////////////////////////////////////
+
+    /// Adds ch to the set.
+    STR_CONSTEXPR void insert(value_type ch)
+    {
+        auto unit = static_cast<unit_type>(ch);
+        if constexpr (sizeof(value_type) > 1)
+        {
+            if (unit >= 256)
+            {
+                if (!contains(ch))
+                    wide_.push_back(ch);
+
+                return;
+            }
+        }
+
+        bitmap_[unit >> 6] |= std::uint64_t(1) << (unit & 63);
+
+        // row of the low nibble, the bit of the high nibble
+        auto lo = unit & 0x0F;
+        auto hi = unit >> 4;
+        if (hi < 8)
+            lo_0_7_[lo] |= static_cast<std::uint8_t>(1u << hi);
+        else
+            lo_8_15_[lo] |= static_cast<std::uint8_t>(1u << (hi - 8));
+    }
+
+    /// Checks whether ch is in the set.
+    STR_CONSTEXPR bool contains(value_type ch) const STR_NOEXCEPT
+    {
+        auto unit = static_cast<unit_type>(ch);
+        if constexpr (sizeof(value_type) > 1)
+        {
+            if (unit >= 256)
+            {
+                for (auto wide : wide_)
+                {
+                    if (wide == ch)
+                        return true;
+                }
+
+                return false;
+            }
+        }
+
+        return (bitmap_[unit >> 6] >> (unit & 63)) & 1;
+    }
+
+    /// Finds the first character in [hay, hay + len) whose membership equals Member.
+    template <bool Member = true>
+    STR_CONSTEXPR size_type find_in(const value_type *hay, size_type len) const STR_NOEXCEPT
+    {
+#ifdef STR_SIMD_SSSE3
+        if constexpr (sizeof(value_type) == 1)
+        {
+#ifdef STR_SIMD_AVX2
+            if (details::cpu_has_avx2())
+                return find_avx2_<Member>(hay, len);
+#endif
+            if (details::cpu_has_ssse3())
+                return find_ssse3_<Member>(hay, len);
+        }
+#endif
+
+        return find_scalar_<Member>(hay, 0, len);
+    }
+
+    /// Finds the last character in [hay, hay + len) whose membership equals Member.
+    template <bool Member = true>
+    STR_CONSTEXPR size_type rfind_in(const value_type *hay, size_type len) const STR_NOEXCEPT
+    {
+#ifdef STR_SIMD_SSSE3
+        if constexpr (sizeof(value_type) == 1)
+        {
+#ifdef STR_SIMD_AVX2
+            if (details::cpu_has_avx2())
+                return rfind_avx2_<Member>(hay, len);
+#endif
+            if (details::cpu_has_ssse3())
+                return rfind_ssse3_<Member>(hay, len);
+        }
+#endif
+
+        return rfind_scalar_<Member>(hay, len);
+    }
+
+protected:
+    template <bool Member>
+    STR_CONSTEXPR size_type find_scalar_(const value_type *hay, size_type index, size_type len) const STR_NOEXCEPT
+    {
+        for (size_type i = index; i < len; i++)
+        {
+            if (contains(hay[i]) == Member)
+                return i;
+        }
+
+        return details::search_npos;
+    }
+
+    template <bool Member>
+    STR_CONSTEXPR size_type rfind_scalar_(const value_type *hay, size_type len) const STR_NOEXCEPT
+    {
+        for (size_type i = len; i > 0; i--)
+        {
+            if (contains(hay[i - 1]) == Member)
+                return i - 1;
+        }
+
+        return details::search_npos;
+    }
+
+#ifdef STR_SIMD_SSSE3
+
+    /// Returns a mask with a bit set for each member byte of the block.
+    /// The rows selected by the low nibble are tested with the bit of the high nibble.
+    STR_SIMD_TARGET_SSSE3 std::uint32_t classify_ssse3_(__m128i block) const STR_NOEXCEPT
+    {
+        const __m128i nibble = _mm_set1_epi8(0x0F);
+        const __m128i bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+        const __m128i rows_0_7 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lo_0_7_));
+        const __m128i rows_8_15 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lo_8_15_));
+
+        const __m128i lo = _mm_and_si128(block, nibble);
+        const __m128i hi = _mm_and_si128(_mm_srli_epi16(block, 4), nibble);
+        const __m128i hi_8_15 = _mm_cmpgt_epi8(hi, _mm_set1_epi8(7));
+
+        const __m128i row = _mm_or_si128(_mm_andnot_si128(hi_8_15, _mm_shuffle_epi8(rows_0_7, lo)),
+                                         _mm_and_si128(hi_8_15, _mm_shuffle_epi8(rows_8_15, lo)));
+        const __m128i bit = _mm_shuffle_epi8(bits, hi);
+
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(row, bit), bit)));
+    }
+
+    template <bool Member>
+    STR_SIMD_TARGET_SSSE3 size_type find_ssse3_(const value_type *hay, size_type len) const STR_NOEXCEPT
+    {
+        size_type i = 0;
+        for (; i + 16 <= len; i += 16)
+        {
+            auto mask = classify_ssse3_(_mm_loadu_si128(reinterpret_cast<const __m128i *>(hay + i)));
+            if (!Member)
+                mask ^= 0xFFFFu;
+
+            if (mask != 0)
+                return i + details::ctz32(mask);
+        }
+
+        return find_scalar_<Member>(hay, i, len);
+    }
+
+    template <bool Member>
+    STR_SIMD_TARGET_SSSE3 size_type rfind_ssse3_(const value_type *hay, size_type len) const STR_NOEXCEPT
+    {
+        size_type i = len;
+        while (i >= 16)
+        {
+            i -= 16;
+
+            auto mask = classify_ssse3_(_mm_loadu_si128(reinterpret_cast<const __m128i *>(hay + i)));
+            if (!Member)
+                mask ^= 0xFFFFu;
+
+            if (mask != 0)
+                return i + details::bsr32(mask);
+        }
+
+        return rfind_scalar_<Member>(hay, i);
+    }
+
+#ifdef STR_SIMD_AVX2
+
+    /// Same as classify_ssse3_ for 32 bytes.
+    STR_SIMD_TARGET_AVX2 std::uint32_t classify_avx2_(__m256i block) const STR_NOEXCEPT
+    {
+        const __m256i nibble = _mm256_set1_epi8(0x0F);
+        const __m256i bits = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+                                              1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+        const __m256i rows_0_7 = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(lo_0_7_)));
+        const __m256i rows_8_15 = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(lo_8_15_)));
+
+        const __m256i lo = _mm256_and_si256(block, nibble);
+        const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(block, 4), nibble);
+        const __m256i hi_8_15 = _mm256_cmpgt_epi8(hi, _mm256_set1_epi8(7));
+
+        const __m256i row = _mm256_blendv_epi8(_mm256_shuffle_epi8(rows_0_7, lo),
+                                               _mm256_shuffle_epi8(rows_8_15, lo), hi_8_15);
+        const __m256i bit = _mm256_shuffle_epi8(bits, hi);
+
+        return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit)));
+    }
+
+    template <bool Member>
+    STR_SIMD_TARGET_AVX2 size_type find_avx2_(const value_type *hay, size_type len) const STR_NOEXCEPT
+    {
+        size_type i = 0;
+        for (; i + 32 <= len; i += 32)
+        {
+            auto mask = classify_avx2_(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(hay + i)));
+            if (!Member)
+                mask = ~mask;
+
+            if (mask != 0)
+                return i + details::ctz32(mask);
+        }
+
+        return find_scalar_<Member>(hay, i, len);
+    }
+
+    template <bool Member>
+    STR_SIMD_TARGET_AVX2 size_type rfind_avx2_(const value_type *hay, size_type len) const STR_NOEXCEPT
+    {
+        size_type i = len;
+        while (i >= 32)
+        {
+            i -= 32;
+
+            auto mask = classify_avx2_(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(hay + i)));
+            if (!Member)
+                mask = ~mask;
+
+            if (mask != 0)
+                return i + details::bsr32(mask);
+        }
+
+        return rfind_scalar_<Member>(hay, i);
+    }
+
+#endif
+#endif
+
+protected:
+    std::uint64_t bitmap_[4] = {};
+    std::uint8_t lo_0_7_[16] = {};
+    std::uint8_t lo_8_15_[16] = {};
+    std::vector<value_type> wide_;
+};
+
+//////////////////////////////////////////////////////////////////////
+// TypeDefs
+//////////////////////////////////////////////////////////////////////
+
+using charset = basic_charset<char>;
+using wcharset = basic_charset<wchar_t>;
+using u8charset = basic_charset<char8_t>;
+using u16charset = basic_charset<char16_t>;
+using u32charset = basic_charset<char32_t>;
+
+STR_NAMESPACE_MAIN_END
@@ -29,6 +29,33 @@
 
 #define STR_NODISCARD [[nodiscard]]
 
+///////////////////////////////////////////////////////////////////
+// Platform
+///////////////////////////////////////////////////////////////////
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define STR_BIG_ENDIAN
+#endif
+
+#if __has_include(<memory_resource>)
+#define STR_HAS_PMR
+#endif
+
+#if !defined(STR_TWEAKS_DISABLE_MALLOC_USABLE_SIZE) && defined(__linux__) && __has_include(<malloc.h>)
+#define STR_HAS_MALLOC_USABLE_SIZE
+#endif
+
+#if defined(__linux__) && __has_include(<sys/mman.h>)
+#define STR_HAS_MREMAP
+#endif
+
+#if (defined(__unix__) || defined(__APPLE__)) && __has_include(<unistd.h>) && __has_include(<fcntl.h>)
+#define STR_HAS_POSIX_IO
+#endif
+
+#if defined(STR_HAS_POSIX_IO) && __has_include(<sys/mman.h>)
+#define STR_HAS_MMAP
+#endif
+
 enum char8_t : unsigned char
 {
 };
@@ -1,17 +1,336 @@
 #pragma once
 #include "common.hpp"
+#include "simd.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <system_error>
+#include <type_traits>
 
 STR_NAMESPACE_MAIN_BEGIN
+
+/// Result of parse(), like std::from_chars_result with the consumed count.
+/// On error value is T(), count is 0 for invalid_argument and
+/// the count of digits for result_out_of_range.
+template <typename T>
+struct parse_result
+{
+    T value;
+    std::size_t count;
+    std::errc ec;
+
+    explicit operator bool() const STR_NOEXCEPT
+    {
+        return ec == std::errc();
+    }
+};
+
 STR_NAMESPACE_DETAILS_BEGIN
 
+//////////////////////////////////////////////////////////////////////
+// Integer formatting
+//////////////////////////////////////////////////////////////////////
+
+/// Decimal pairs "00" to "99", two characters each.
+inline constexpr char digit_pairs[201] = "00010203040506070809101112131415161718192021222324252627282930313233343536373839404142434445464748495051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+/// Digits of the bases up to 36.
+inline constexpr char digit_chars[37] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+inline constexpr std::uint64_t pow10_u64[20] = {
+    1ull,
+    10ull,
+    100ull,
+    1000ull,
+    10000ull,
+    100000ull,
+    1000000ull,
+    10000000ull,
+    100000000ull,
+    1000000000ull,
+    10000000000ull,
+    100000000000ull,
+    1000000000000ull,
+    10000000000000ull,
+    100000000000000ull,
+    1000000000000000ull,
+    10000000000000000ull,
+    100000000000000000ull,
+    1000000000000000000ull,
+    10000000000000000000ull,
+};
+
+/// Maximum count of characters of Int in base 10, sign included.
+template <typename Int>
+inline constexpr std::size_t max_num_chars = std::numeric_limits<Int>::digits10 + 2;
+
+/// Unsigned type the digits of Int are computed in,
+/// narrow types are widened to unsigned int.
+template <typename Int>
+using num_unsigned_t = std::conditional_t<(sizeof(Int) < sizeof(unsigned)), unsigned, std::make_unsigned_t<Int>>;
+
+/// Returns the count of decimal digits of value.
+inline std::size_t count_digits10(std::uint64_t value) STR_NOEXCEPT
+{
+    // 0 has one digit, like 1
+    value |= 1;
+
+    // the bit length times log10(2) ~= 1233 / 4096 is the digit count or one less
+    auto t = ((bsr64(value) + 1) * 1233) >> 12;
+    return t + 1 - (value < pow10_u64[t]);
+}
+
+/// Returns the count of digits of value in base.
+template <typename UInt>
+inline std::size_t count_digits(UInt value, unsigned base) STR_NOEXCEPT
+{
+    if (base == 10)
+        return count_digits10(value);
+
+    if ((base & (base - 1)) == 0)
+        return bsr64(static_cast<std::uint64_t>(value) | 1) / ctz32(base) + 1;
+
+    std::size_t count = 1;
+    for (; value >= base; value /= base)
+        count++;
+
+    return count;
+}
+
+/// Writes the decimal digits of value backwards, ending before end.
+template <typename Char, typename UInt>
+inline void write_digits10(Char *end, UInt value) STR_NOEXCEPT
+{
+    // two digits per division
+    while (value >= 100)
+    {
+        auto pair = static_cast<std::size_t>(value % 100) * 2;
+        value /= 100;
+
+        *--end = static_cast<Char>(digit_pairs[pair + 1]);
+        *--end = static_cast<Char>(digit_pairs[pair]);
+    }
+
+    if (value >= 10)
+    {
+        auto pair = static_cast<std::size_t>(value) * 2;
+        *--end = static_cast<Char>(digit_pairs[pair + 1]);
+        *--end = static_cast<Char>(digit_pairs[pair]);
+    }
+    else
+    {
+        *--end = static_cast<Char>('0' + value);
+    }
+}
+
+/// Writes the digits of value in base backwards, ending before end.
+template <typename Char, typename UInt>
+inline void write_digits(Char *end, UInt value, unsigned base) STR_NOEXCEPT
+{
+    if (base == 10)
+    {
+        write_digits10(end, value);
+        return;
+    }
+
+    if ((base & (base - 1)) == 0)
+    {
+        auto shift = ctz32(base);
+        auto mask = static_cast<UInt>(base - 1);
+        do
+        {
+            *--end = static_cast<Char>(digit_chars[value & mask]);
+            value >>= shift;
+        } while (value != 0);
+
+        return;
+    }
+
+    do
+    {
+        *--end = static_cast<Char>(digit_chars[value % base]);
+        value /= base;
+    } while (value != 0);
+}
+
+/// Returns the count of characters of value in base, sign included.
+template <typename Int>
+inline std::size_t count_num_chars(Int value, unsigned base = 10) STR_NOEXCEPT
+{
+    static_assert(std::is_integral_v<Int> && !std::is_same_v<Int, bool>, "Int must be an integer type");
+
+    using UInt = num_unsigned_t<Int>;
+    auto abs = static_cast<UInt>(static_cast<std::make_unsigned_t<Int>>(value));
+
+    if constexpr (std::is_signed_v<Int>)
+    {
+        if (value < 0)
+            return count_digits<UInt>(static_cast<std::make_unsigned_t<Int>>(0u - abs), base) + 1;
+    }
+
+    return count_digits<UInt>(abs, base);
+}
+
+/// Writes value in base to [ptr, ptr + size), size must be count_num_chars(value, base).
 template <typename Char, typename Int>
-void convert_num_to_str(Char* ptr, size_t count, Int value)
+inline void write_num(Char *ptr, std::size_t size, Int value, unsigned base = 10) STR_NOEXCEPT
 {
+    static_assert(std::is_integral_v<Int> && !std::is_same_v<Int, bool>, "Int must be an integer type");
+
+    using UInt = num_unsigned_t<Int>;
+    auto abs = static_cast<UInt>(static_cast<std::make_unsigned_t<Int>>(value));
+
+    if constexpr (std::is_signed_v<Int>)
+    {
+        if (value < 0)
+        {
+            *ptr = static_cast<Char>('-');
+            abs = static_cast<std::make_unsigned_t<Int>>(0u - abs);
+        }
+    }
+
+    write_digits(ptr + size, abs, base);
 }
 
+/// Writes value in base to [ptr, ptr + count) if it fits, digits above 9 are lowercase letters.
+/// @return the count of characters of value, nothing is written if it is greater than count.
 template <typename Char, typename Int>
-Int convert_str_to_num(Char* ptr, size_t count)
+inline std::size_t convert_num_to_str(Char *ptr, std::size_t count, Int value, unsigned base = 10) STR_NOEXCEPT
+{
+    auto size = count_num_chars(value, base);
+    if (size <= count)
+    {
+        write_num(ptr, size, value, base);
+    }
+
+    return size;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Integer parsing
+//////////////////////////////////////////////////////////////////////
+
+/// Returns the value of the digit ch in bases up to 36, 36 or more if it is none.
+template <typename Char>
+inline unsigned digit_value(Char ch) STR_NOEXCEPT
+{
+    auto unit = static_cast<std::uint32_t>(ch);
+
+    if (unit - '0' < 10)
+        return unit - '0';
+
+    // lowercase
+    unit |= 0x20;
+    if (unit - 'a' < 26)
+        return unit - 'a' + 10;
+
+    return 36;
+}
+
+/// Checks whether the 8 bytes of chunk are all decimal digits.
+inline bool is_eight_digits(std::uint64_t chunk) STR_NOEXCEPT
+{
+    // the high nibbles are 3 and adding 6 does not carry into them
+    return ((chunk & 0xF0F0F0F0F0F0F0F0ull) |
+            (((chunk + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) == 0x3333333333333333ull;
+}
+
+/// Returns the value of 8 decimal digits, the first one in the lowest byte.
+inline std::uint32_t parse_eight_digits(std::uint64_t chunk) STR_NOEXCEPT
 {
+    // combine neighbour digits, then pairs, then quads
+    chunk -= 0x3030303030303030ull;
+    chunk = (chunk * 10) + (chunk >> 8);
+    chunk = (((chunk & 0x000000FF000000FFull) * 0x000F424000000064ull) +
+             (((chunk >> 16) & 0x000000FF000000FFull) * 0x0000271000000001ull)) >> 32;
+
+    return static_cast<std::uint32_t>(chunk);
+}
+
+/// Parses an integer in base from [ptr, ptr + count), without sign prefix
+/// other than '-' for signed types, whitespace or base prefix.
+/// Does not depend on the locale or on a null terminator.
+template <typename Int, typename Char>
+inline parse_result<Int> convert_str_to_num(const Char *ptr, std::size_t count, unsigned base = 10) STR_NOEXCEPT
+{
+    static_assert(std::is_integral_v<Int> && !std::is_same_v<Int, bool>, "Int must be an integer type");
+
+    parse_result<Int> result{ Int(), 0, std::errc::invalid_argument };
+    if (base < 2 || base > 36)
+        return result;
+
+    auto it = ptr;
+    auto end = ptr + count;
+
+    bool negative = false;
+    if constexpr (std::is_signed_v<Int>)
+    {
+        if (it != end && *it == static_cast<Char>('-'))
+        {
+            negative = true;
+            ++it;
+        }
+    }
+
+    // the magnitude of the minimum is one more than the maximum
+    auto limit = static_cast<std::uint64_t>(std::numeric_limits<Int>::max()) + negative;
+    auto first = it;
+    std::uint64_t value = 0;
+
+#ifndef STR_BIG_ENDIAN
+    if constexpr (sizeof(Char) == 1)
+    {
+        if (base == 10)
+        {
+            // leading zeros do not count towards the 16 digits which cannot overflow
+            while (it != end && *it == static_cast<Char>('0'))
+                ++it;
+
+            for (int i = 0; i < 2 && end - it >= 8; i++)
+            {
+                std::uint64_t chunk;
+                std::memcpy(&chunk, it, sizeof(chunk));
+                if (!is_eight_digits(chunk))
+                    break;
+
+                value = value * 100000000 + parse_eight_digits(chunk);
+                it += 8;
+            }
+        }
+    }
+#endif
+
+    bool overflow = value > limit;
+    auto cutoff = limit / base;
+    auto cutlim = limit % base;
+
+    for (; it != end; ++it)
+    {
+        auto digit = digit_value(*it);
+        if (digit >= base)
+            break;
+
+        if (overflow || value > cutoff || (value == cutoff && digit > cutlim))
+            overflow = true;
+        else
+            value = value * base + digit;
+    }
+
+    if (it == first)
+        return result;
+
+    result.count = static_cast<std::size_t>(it - ptr);
+    if (overflow)
+    {
+        result.ec = std::errc::result_out_of_range;
+        return result;
+    }
+
+    using UInt = std::make_unsigned_t<Int>;
+    result.value = static_cast<Int>(static_cast<UInt>(negative ? 0 - value : value));
+    result.ec = std::errc();
+    return result;
 }
 
 STR_NAMESPACE_DETAILS_END
@@ -0,0 +1,261 @@
+#pragma once
+#include "common.hpp"
+#include "heapstr.hpp"
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <system_error>
+
+#ifdef STR_HAS_POSIX_IO
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+STR_NAMESPACE_MAIN_BEGIN
+STR_NAMESPACE_DETAILS_BEGIN
+
+/// Bytes requested by each read() once the known size of a file is exhausted.
+inline constexpr std::size_t file_read_block = 64 * 1024;
+
+[[noreturn]] inline void throw_file_error(const char *what)
+{
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+#ifdef STR_HAS_POSIX_IO
+
+/// Reads up to count bytes, retried when interrupted, returns 0 at the end of the file.
+inline std::size_t file_read(int fd, char *ptr, std::size_t count)
+{
+    while (true)
+    {
+        auto result = ::read(fd, ptr, count);
+        if (result >= 0)
+            return static_cast<std::size_t>(result);
+
+        if (errno != EINTR)
+            throw_file_error("read");
+    }
+}
+
+/// Closes fd when leaving the scope.
+struct file_handle
+{
+    int fd;
+
+    explicit file_handle(const char *path)
+        : fd{::open(path, O_RDONLY | O_CLOEXEC)}
+    {
+        if (fd < 0)
+            throw_file_error(path);
+    }
+
+    file_handle(const file_handle &) = delete;
+    file_handle &operator=(const file_handle &) = delete;
+
+    ~file_handle()
+    {
+        ::close(fd);
+    }
+};
+
+#endif
+
+STR_NAMESPACE_DETAILS_END
+
+#ifdef STR_HAS_POSIX_IO
+
+/// Appends the remaining content of fd to str. The size of a regular file is
+/// taken from fstat(), so the string is allocated once and filled by a single
+/// read() without zeroing; pipes and files without a size grow in large blocks.
+/// Throws std::system_error on failure.
+template <typename String>
+void read_file(int fd, String &str)
+{
+    struct stat st;
+    if (::fstat(fd, &st) != 0)
+        details::throw_file_error("fstat");
+
+    auto size = str.size();
+    auto offset = ::lseek(fd, 0, SEEK_CUR);
+    if (offset < 0)
+    {
+        offset = 0;
+    }
+
+    if (S_ISREG(st.st_mode) && st.st_size > offset)
+    {
+        auto remaining = static_cast<std::size_t>(st.st_size - offset);
+
+        // bypasses the growth policy, one spare byte so reaching the end
+        // of a file which did not grow costs no reallocation
+        str.reserve_exact(size + remaining + 1);
+    }
+
+    while (true)
+    {
+        auto free = str.capacity() - str.size();
+        if (free == 0)
+        {
+            str.reserve(str.size() + details::file_read_block);
+            free = str.capacity() - str.size();
+        }
+
+        auto span = str.append_uninitialized(free);
+        auto count = details::file_read(fd, span.data(), free);
+        span.commit(count);
+
+        if (count == 0)
+            break;
+    }
+}
+
+/// Returns the content of the file at path.
+/// Throws std::system_error when it cannot be opened or read.
+template <typename String = heapstr>
+String read_file(const char *path)
+{
+    details::file_handle file(path);
+
+    String str;
+    read_file(file.fd, str);
+    return str;
+}
+
+#else
+
+/// Returns the content of the file at path, read in large blocks with std::fread.
+/// Throws std::system_error when it cannot be opened or read.
+template <typename String = heapstr>
+String read_file(const char *path)
+{
+    auto file = std::fopen(path, "rb");
+    if (file == nullptr)
+        details::throw_file_error(path);
+
+    String str;
+    std::size_t count;
+    do
+    {
+        auto span = str.append_uninitialized(details::file_read_block);
+        count = std::fread(span.data(), 1, details::file_read_block, file);
+        span.commit(count);
+    } while (count == details::file_read_block);
+
+    auto failed = std::ferror(file);
+    std::fclose(file);
+    if (failed)
+        details::throw_file_error("fread");
+
+    return str;
+}
+
+#endif
+
+#ifdef STR_HAS_POSIX_IO
+
+/// Buffered reader of the lines of a file descriptor. Bytes past a delimiter
+/// cannot be given back to the descriptor, so they are kept in the buffer
+/// of the reader for the next call to getline().
+/// The descriptor is closed by the destructor only when the reader opened it.
+class file_reader
+{
+public:
+    static constexpr std::size_t default_buffer_size = 64 * 1024;
+
+    /// Reads from fd, which stays open.
+    explicit file_reader(int fd, std::size_t buffer_size = default_buffer_size)
+        : fd_{fd}, owned_{false}
+    {
+        buffer_.reserve(buffer_size);
+    }
+
+    /// Opens the file at path, throws std::system_error on failure.
+    explicit file_reader(const char *path, std::size_t buffer_size = default_buffer_size)
+        : fd_{::open(path, O_RDONLY | O_CLOEXEC)}, owned_{true}
+    {
+        if (fd_ < 0)
+            details::throw_file_error(path);
+
+#ifdef POSIX_FADV_SEQUENTIAL
+        ::posix_fadvise(fd_, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+        buffer_.reserve(buffer_size);
+    }
+
+    file_reader(const file_reader &) = delete;
+    file_reader &operator=(const file_reader &) = delete;
+
+    ~file_reader()
+    {
+        if (owned_)
+        {
+            ::close(fd_);
+        }
+    }
+
+    /// Reads characters until delim into str, which keeps its capacity.
+    /// Returns false once the end of the file is reached without a character.
+    template <typename String>
+    bool getline(String &str, char delim = '\n')
+    {
+        str.clear();
+        bool extracted = false;
+
+        while (true)
+        {
+            if (pos_ == buffer_.size() && !refill_())
+                return extracted;
+
+            extracted = true;
+            auto first = buffer_.data() + pos_;
+            auto avail = buffer_.size() - pos_;
+            auto index = details::find_char<char, std::char_traits<char>>(first, avail, delim);
+
+            if (index != details::search_npos)
+            {
+                str.append(static_cast<const char *>(first), index);
+                pos_ += index + 1;
+                return true;
+            }
+
+            str.append(static_cast<const char *>(first), avail);
+            pos_ += avail;
+        }
+    }
+
+    int fd() const STR_NOEXCEPT
+    {
+        return fd_;
+    }
+
+protected:
+    bool refill_()
+    {
+        buffer_.clear();
+        pos_ = 0;
+
+        auto span = buffer_.append_uninitialized(buffer_.capacity());
+        auto count = details::file_read(fd_, span.data(), span.size());
+        span.commit(count);
+        return count != 0;
+    }
+
+protected:
+    int fd_;
+    bool owned_;
+    heapstr buffer_;
+    std::size_t pos_ = 0;
+};
+
+/// Reads the next line of reader into str, like std::getline.
+template <typename String>
+bool getline(file_reader &reader, String &str, char delim = '\n')
+{
+    return reader.getline(str, delim);
+}
+
+#endif
+
+STR_NAMESPACE_MAIN_END
@@ -0,0 +1,2507 @@
+#pragma once
+#include "common.hpp"
+#include "details.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+STR_NAMESPACE_MAIN_BEGIN
+
+/// Layout of formatted floating point values, like std::chars_format.
+/// general picks the shorter of fixed and scientific without a precision,
+/// and follows printf's %g with one.
+enum class float_format
+{
+    general,
+    fixed,
+    scientific,
+};
+
+STR_NAMESPACE_DETAILS_BEGIN
+
+//////////////////////////////////////////////////////////////////////
+// 128 bit arithmetic
+//////////////////////////////////////////////////////////////////////
+
+/// Returns the high 64 bits of the product of a and b.
+inline std::uint64_t umulh64(std::uint64_t a, std::uint64_t b) STR_NOEXCEPT
+{
+#if defined(__SIZEOF_INT128__)
+    return static_cast<std::uint64_t>((static_cast<unsigned __int128>(a) * b) >> 64);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    return __umulh(a, b);
+#else
+    auto a0 = a & 0xFFFFFFFFu, a1 = a >> 32;
+    auto b0 = b & 0xFFFFFFFFu, b1 = b >> 32;
+    auto p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    auto mid = (p00 >> 32) + (p01 & 0xFFFFFFFFu) + (p10 & 0xFFFFFFFFu);
+    return p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+#endif
+}
+
+/// Full 128 bit product of two 64 bit integers.
+struct uint128
+{
+    std::uint64_t high;
+    std::uint64_t low;
+};
+
+inline uint128 umul128(std::uint64_t a, std::uint64_t b) STR_NOEXCEPT
+{
+#if defined(__SIZEOF_INT128__)
+    auto product = static_cast<unsigned __int128>(a) * b;
+    return { static_cast<std::uint64_t>(product >> 64), static_cast<std::uint64_t>(product) };
+#elif defined(_MSC_VER) && defined(_M_X64)
+    std::uint64_t high;
+    auto low = _umul128(a, b, &high);
+    return { high, low };
+#else
+    return { umulh64(a, b), a * b };
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////
+// Shortest decimal (Schubfach)
+//////////////////////////////////////////////////////////////////////
+
+/// floor(q * log10(2)), for |q| <= 5456721
+inline int flog10pow2(int q) STR_NOEXCEPT
+{
+    return static_cast<int>((static_cast<std::int64_t>(q) * 661971961083) >> 41);
+}
+
+/// floor(log10(3/4 * 2^q)), for |q| <= 5456721
+inline int flog10threequarterspow2(int q) STR_NOEXCEPT
+{
+    return static_cast<int>((static_cast<std::int64_t>(q) * 661971961083 - 274743187321) >> 41);
+}
+
+/// floor(e * log2(10)), for |e| <= 1838394
+inline int flog2pow10(int e) STR_NOEXCEPT
+{
+    return static_cast<int>((static_cast<std::int64_t>(e) * 913124641741) >> 38);
+}
+
+/// g = g1 2^63 + g0 = floor(10^-k 2^(125 - flog2pow10(-k))) + 1, for k in [-324, 292].
+inline constexpr int pow10_g_min = -324;
+inline constexpr std::uint64_t pow10_g[617][2] = {
+    { 0x4F0CEDC95A718DD4ull, 0x5B01E8B09AA0D1B5ull },
+    { 0x7E7B160EF71C1621ull, 0x119CA780F767B5EEull },
+    { 0x652F44D8C5B011B4ull, 0x0E16EC672C52F7F2ull },
+    { 0x50F29D7A37C00E29ull, 0x581256B8F0425FF5ull },
+    { 0x40C21794F96671BAull, 0x79A84560C0351991ull },
+    { 0x679CF287F570B5F7ull, 0x75DA089ACD21C281ull },
+    { 0x52E3F5399126F7F9ull, 0x44AE6D48A41B0201ull },
+    { 0x424FF76140EBF994ull, 0x36F1F106E9AF34CDull },
+    { 0x6A198BCECE465C20ull, 0x57E981A4A918547Bull },
+    { 0x54E13CA571D1E34Dull, 0x2CBACE1D541376C9ull },
+    { 0x43E763B78E4182A4ull, 0x23C8A4E44342C56Eull },
+    { 0x6CA56C58E39C043Aull, 0x060DD4A06B9E08B0ull },
+    { 0x56EABD13E9499CFBull, 0x1E7176E6BC7E6D59ull },
+    { 0x458897432107B0C8ull, 0x7EC12BEBC9FEBDE1ull },
+    { 0x6F40F20501A5E7A7ull, 0x7E01DFDFA9979635ull },
+    { 0x5900C19D9AEB1FB9ull, 0x4B34B319547944F7ull },
+    { 0x4733CE17AF227FC7ull, 0x55C3C27AA9FA9D93ull },
+    { 0x71EC7CF2B1D0CC72ull, 0x560603F7765DC8EAull },
+    { 0x5B2397288E40A38Eull, 0x7804CFF92B7E3A55ull },
+    { 0x48E945BA0B66E93Full, 0x13370CC755FE9511ull },
+    { 0x74A86F90123E41FEull, 0x51F1AE0BBCCA881Bull },
+    { 0x5D538C7341CB67FEull, 0x74C1580963D539AFull },
+    { 0x4AA93D29016F8665ull, 0x43CDE0078310FAF3ull },
+    { 0x77752EA8024C0A3Cull, 0x0616333F381B2B1Eull },
+    { 0x5F90F22001D66E96ull, 0x3811C298F9AF55B1ull },
+    { 0x4C73F4E667DEBEDEull, 0x600E35472E25DE28ull },
+    { 0x7A532170A6313164ull, 0x3349EED849D6303Full },
+    { 0x61DC1AC084F42783ull, 0x42A18BE03B11C033ull },
+    { 0x4E49AF006A5CEC69ull, 0x1BB46FE695A7CCF5ull },
+    { 0x7D42B19A43C7E0A8ull, 0x2C53E63DBC3FAE55ull },
+    { 0x64355AE1CFD31A20ull, 0x237651CAFCFFBEAAull },
+    { 0x502AAF1B0CA8E1B3ull, 0x35F8416F30CC9888ull },
+    { 0x402225AF3D53E7C2ull, 0x5E603458F3D6E06Dull },
+    { 0x669D0918621FD937ull, 0x4A3386F4B957CD7Bull },
+    { 0x52173A79E8197A92ull, 0x6E8F9F2A2DDFD796ull },
+    { 0x41AC2EC7ECE12EDBull, 0x720C7F54F17FDFABull },
+    { 0x69137E0CAE3517C6ull, 0x1CE0CBBB1BFFCC45ull },
+    { 0x540F980A24F74638ull, 0x171A3C95AFFFD69Eull },
+    { 0x433FACD4EA5F6B60ull, 0x127B63AAF3331218ull },
+    { 0x6B991487DD657899ull, 0x6A5F05DE51EB5026ull },
+    { 0x5614106CB11DFA14ull, 0x5518D17EA7EF7352ull },
+    { 0x44DCD9F08DB194DDull, 0x2A7A41321FF2C2A8ull },
+    { 0x6E2E2980E2B5BAFBull, 0x5D906850331E043Full },
+    { 0x5824EE00B55E2F2Full, 0x647386A68F4B3699ull },
+    { 0x4683F19A2AB1BF59ull, 0x36C2D21ED908F87Bull },
+    { 0x70D31C29DDE93228ull, 0x579E1CFE280E5A5Dull },
+    { 0x5A427CEE4B20F4EDull, 0x2C7E7D98200B7B7Eull },
+    { 0x483530BEA280C3F1ull, 0x09FECAE019A2C932ull },
+    { 0x73884DFDD0CE064Eull, 0x43314499C29E0EB6ull },
+    { 0x5C6D0B3173D8050Bull, 0x4F5A9D47CEE4D891ull },
+    { 0x49F0D5C129799DA2ull, 0x72AEE4397250AD41ull },
+    { 0x764E22CEA8C295D1ull, 0x377E39F583B44868ull },
+    { 0x5EA4E8A553CEDE41ull, 0x12CB61913629D387ull },
+    { 0x4BB72084430BE500ull, 0x756F8140F8217605ull },
+    { 0x792500D39E796E67ull, 0x6F18CECE59CF233Cull },
+    { 0x60EA670FB1FABEB9ull, 0x3F470BD847D8E8FDull },
+    { 0x4D885272F4C89894ull, 0x329F3CAD064720CAull },
+    { 0x7C0D50B7EE0DC0EDull, 0x37652DE1A3A50143ull },
+    { 0x633DDA2CBE716724ull, 0x2C50F1814FB73436ull },
+    { 0x4F64AE8A31F45283ull, 0x3D0D8E010C92902Bull },
+    { 0x7F077DA9E986EA6Bull, 0x7B48E334E0EA8045ull },
+    { 0x659F97BB2138BB89ull, 0x49071C2A4D88669Dull },
+    { 0x514C796280FA2FA1ull, 0x20D27CEEA46D1EE4ull },
+    { 0x4109FAB533FB594Dull, 0x670ECA58838A7F1Dull },
+    { 0x680FF788532BC216ull, 0x0B4ADD5A6C10CB62ull },
+    { 0x533FF939DC2301ABull, 0x22A24AAEBCDA3C4Eull },
+    { 0x4299942E49B59AEFull, 0x354EA22563E1C9D8ull },
+    { 0x6A8F537D42BC2B18ull, 0x554A9D089FCFA95Aull },
+    { 0x553F75FDCEFCEF46ull, 0x776EE406E63FBAAEull },
+    { 0x4432C4CB0BFD8C38ull, 0x5F8BE99F1E996225ull },
+    { 0x6D1E07AB466279F4ull, 0x327975CB64289D08ull },
+    { 0x574B3955D1E86190ull, 0x28612B091CED4A6Dull },
+    { 0x45D5C777DB204E0Dull, 0x06B4226DB0BDD524ull },
+    { 0x6FBC72595E9A167Bull, 0x24536A491AC95506ull },
+    { 0x59638EADE54811FCull, 0x1D0F883A7BD44405ull },
+    { 0x4782D88B1DD34196ull, 0x4A72D361FCA9D004ull },
+    { 0x726AF411C952028Aull, 0x43EAEBCFFAA94CD3ull },
+    { 0x5B88C3416DDB353Bull, 0x4FEF230CC88770A9ull },
+    { 0x493A35CDF17C2A96ull, 0x0CBF4F3D6D3926EEull },
+    { 0x7529EFAFE8C6AA89ull, 0x61321862485B717Cull },
+    { 0x5DBB262653D22207ull, 0x675B46B506AF8DFDull },
+    { 0x4AFC1E850FDB4E6Cull, 0x52AF6BC405593E64ull },
+    { 0x77F9CA6E7FC54A47ull, 0x377F12D33BC1FD6Dull },
+    { 0x5FFB085866376E9Full, 0x45FF42429634CABDull },
+    { 0x4CC8D379EB5F8BB2ull, 0x6B329B68782A3BCBull },
+    { 0x7ADAEBF64565AC51ull, 0x2B842BDA59DD2C77ull },
+    { 0x6248BCC5045156A7ull, 0x3C69BCAEAE4A89F9ull },
+    { 0x4EA0970403744552ull, 0x6387CA25583BA194ull },
+    { 0x7DCDBE6CD253A21Eull, 0x05A6103BC05F68EDull },
+    { 0x64A498570EA94E7Eull, 0x37B80CFC99E5ED8Aull },
+    { 0x5083AD1272210B98ull, 0x2C933D96E184BE08ull },
+    { 0x40695741F4E73C79ull, 0x7075CADF1AD09807ull },
+    { 0x670EF2032171FA5Cull, 0x4D8944982AE759A4ull },
+    { 0x52725B35B45B2EB0ull, 0x3E076A135585E150ull },
+    { 0x41F515C49048F226ull, 0x64D2BB42AAD1810Dull },
+    { 0x698822D41A0E503Eull, 0x07B7920444826815ull },
+    { 0x546CE8A9AE71D9CBull, 0x1FC60E69D0685344ull },
+    { 0x438A53BAF1F4AE3Cull, 0x196B3EBB0D20429Dull },
+    { 0x6C1085F7E9877D2Dull, 0x0F11FDF815006A94ull },
+    { 0x56739E5FEE05FDBDull, 0x58DB319344005543ull },
+    { 0x45294B7FF19E6497ull, 0x60AF5ADC3666AA9Cull },
+    { 0x6EA878CCB5CA3A8Cull, 0x344BC4938A3DDDC7ull },
+    { 0x5886C70A2B082ED6ull, 0x5D096A0FA1CB17D2ull },
+    { 0x46D238D4EF39BF12ull, 0x173ABB3FB4A27975ull },
+    { 0x71505AEE4B8F981Dull, 0x0B912B992103F588ull },
+    { 0x5AA6AF25093FACE4ull, 0x0940EFADB4032AD3ull },
+    { 0x488558EA6DCC8A50ull, 0x07672624900288A9ull },
+    { 0x74088E43E2E0DD4Cull, 0x723EA36DB337410Eull },
+    { 0x5CD3A5031BE71770ull, 0x5B654F8AF5C5CDA5ull },
+    { 0x4A42EA68E31F45F3ull, 0x62B772D5916B0AEBull },
+    { 0x76D1770E38320986ull, 0x0458B7BC1BDE77DDull },
+    { 0x5F0DF8D82CF4D46Bull, 0x1D13C630164B9318ull },
+    { 0x4C0B2D79BD90A9EFull, 0x30DC9E8CDEA2DC13ull },
+    { 0x79AB7BF5FC1AA97Full, 0x0160FDAE31049351ull },
+    { 0x6155FCC4C9AEEDFFull, 0x1AB3FE24F403A90Eull },
+    { 0x4DDE63D0A158BE65ull, 0x6229981D9002EDA5ull },
+    { 0x7C97061A9BC130A2ull, 0x69DC2695B337E2A1ull },
+    { 0x63AC04E2163426E8ull, 0x54B01EDE28F9821Bull },
+    { 0x4FBCD0B4DE901F20ull, 0x43C018B1BA6134E2ull },
+    { 0x7F9481216419CB67ull, 0x1F99C11C5D68549Dull },
+    { 0x6610674DE9AE3C52ull, 0x4C7B00E37DED107Eull },
+    { 0x51A6B90B21583042ull, 0x09FC00B5FE574065ull },
+    { 0x41522DA2811359CEull, 0x3B3000919845CD1Dull },
+    { 0x68837C3734EBC2E3ull, 0x784CCDB5C06FAE95ull },
+    { 0x539C635F5D8968B6ull, 0x2D0A3E2B00595877ull },
+    { 0x42E382B2B13ABA2Bull, 0x3DA1CB5599E11393ull },
+    { 0x6B059DEAB52AC378ull, 0x629C7888F634EC1Eull },
+    { 0x559E17EEF755692Dull, 0x3549FA072B5D89B1ull },
+    { 0x447E798BF91120F1ull, 0x1107FB38EF7E07C1ull },
+    { 0x6D9728DFF4E834B5ull, 0x01A65EC17F300C68ull },
+    { 0x57AC20B32A535D5Dull, 0x4E1EB23465C009EDull },
+    { 0x46234D5C21DC4AB1ull, 0x24E55B5D1E333B24ull },
+    { 0x70387BC69C93AAB5ull, 0x216EF894FD1EC506ull },
+    { 0x59C6C96BB076222Aull, 0x4DF2607730E56A6Cull },
+    { 0x47D23ABC8D2B4E88ull, 0x3E5B805F5A5121F0ull },
+    { 0x72E9F79415121740ull, 0x63C59A322A1B697Full },
+    { 0x5BEE5FA9AA74DF67ull, 0x03047B5B54E2BACCull },
+    { 0x498B7FBAEEC3E5ECull, 0x0269FC4910B5623Dull },
+    { 0x75ABFF917E063CACull, 0x6A432D41B45569FBull },
+    { 0x5E2332DACB38308Aull, 0x21CF5767C37787FCull },
+    { 0x4B4F5BE23C2CF3A1ull, 0x67D912B9692C6CCAull },
+    { 0x787EF969F9E185CFull, 0x595B5128A8471476ull },
+    { 0x60659454C7E79E3Full, 0x6115DA86ED05A9F8ull },
+    { 0x4D1E1043D31FB1CCull, 0x4DAB1538BD9E2193ull },
+    { 0x7B634D3951CC4FADull, 0x62AB552795C9CF52ull },
+    { 0x62B5D7610E3D0C8Bull, 0x0222AA86116E3F75ull },
+    { 0x4EF7DF80D830D6D5ull, 0x4E822204DABE992Aull },
+    { 0x7E59659AF38157BCull, 0x17369CD49130F510ull },
+    { 0x65145148C2CDDFC9ull, 0x5F5EE3DD40F3F740ull },
+    { 0x50DD0DD3CF0B196Eull, 0x1918B64A9A5CC5CDull },
+    { 0x40B0D7DCA5A27ABEull, 0x4746F83BAEB09E3Eull },
+    { 0x678159610903F797ull, 0x253E59F91780FD2Full },
+    { 0x52CDE11A6D9CC612ull, 0x50FEAE60DF9A6426ull },
+    { 0x423E4DAEBE1704DBull, 0x5A65584D7FAEB685ull },
+    { 0x69FD4917968B3AF9ull, 0x10A226E265E4573Bull },
+    { 0x54CAA0DFABA29594ull, 0x0D4E8581EB1D1295ull },
+    { 0x43D54D7FBC821143ull, 0x243ED134BC174211ull },
+    { 0x6C887BFF94034ED2ull, 0x06CAE85460253682ull },
+    { 0x56D396661002A574ull, 0x6BD586A9E6842B9Bull },
+    { 0x457611EB40021DF7ull, 0x09779EEE52035616ull },
+    { 0x6F234FDECCD02FF1ull, 0x5BF297E3B66BBCEFull },
+    { 0x58E90CB23D73598Eull, 0x165BACB62B8963F3ull },
+    { 0x4720D6F4FDF5E13Eull, 0x451623C4EFA11CC2ull },
+    { 0x71CE24BB2FEFCECAull, 0x3B569FA17F682E03ull },
+    { 0x5B0B5095BFF30BD5ull, 0x15DEE61ACC535803ull },
+    { 0x48D5DA11665C0977ull, 0x2B18B8157042ACCFull },
+    { 0x74895CE8A3C6758Bull, 0x5E8DF355806AAE18ull },
+    { 0x5D3AB0BA1C9EC46Full, 0x653E5C4466BBBE7Aull },
+    { 0x4A955A2E7D4BD059ull, 0x3765169D1EFC9861ull },
+    { 0x77555D172EDFB3C2ull, 0x256E8A94FE60F3CFull },
+    { 0x5F777DAC257FC301ull, 0x6ABED543FEB3F63Full },
+    { 0x4C5F97BCEACC9C01ull, 0x3BCBDDCFFEF65E99ull },
+    { 0x7A328C6177ADC668ull, 0x5FAC961997F0975Bull },
+    { 0x61C209E792F16B86ull, 0x7FBD44E1465A12AFull },
+    { 0x4E34D4B9425ABC6Bull, 0x7FCA9D810514DBBFull },
+    { 0x7D21545B9D5DFA46ull, 0x32DDC8CE6E87C5FFull },
+    { 0x641AA9E2E44B2E9Eull, 0x5BE4A0A525396B32ull },
+    { 0x501554B5836F587Eull, 0x7CB6E6EA842DEF5Cull },
+    { 0x4011109135F2AD32ull, 0x30925255368B25E3ull },
+    { 0x6681B41B89844850ull, 0x4DB6EA21F0DEA304ull },
+    { 0x52015CE2D469D373ull, 0x57C5881B2718826Aull },
+    { 0x419AB0B576BB0F8Full, 0x5FD139AF527A01EFull },
+    { 0x68F781225791B27Full, 0x4C81F5E550C3364Aull },
+    { 0x53F9341B79415B99ull, 0x239B2B1DDA35C508ull },
+    { 0x432DC3492DCDE2E1ull, 0x02E288E4AE916A6Dull },
+    { 0x6B7C6BA849496B01ull, 0x516A74A1174F10AEull },
+    { 0x55FD22ED076DEF34ull, 0x4121F6E745D8DA25ull },
+    { 0x44CA82573924BF5Dull, 0x1A8192529E4714EBull },
+    { 0x6E10D08B8EA1322Eull, 0x5D9C1D50FD3E87DDull },
+    { 0x580D73A2D880F4F2ull, 0x17B01773FDCB9FE4ull },
+    { 0x4671294F139A5D8Eull, 0x4626792997D61984ull },
+    { 0x70B50EE4EC2A2F4Aull, 0x3D0A5B75BFBCF59Full },
+    { 0x5A2A7250BCEE8C3Bull, 0x4A6EAF916630C47Full },
+    { 0x4821F50D63F209C9ull, 0x21F2260DEB5A36CCull },
+    { 0x736988156CB6760Eull, 0x69837016455D247Aull },
+    { 0x5C546CDDF091F80Bull, 0x6E02C011D1175062ull },
+    { 0x49DD23E4C074C66Full, 0x719BCCDB0DAC404Eull },
+    { 0x762E9FD467213D7Full, 0x68F947C4E2AD33B0ull },
+    { 0x5E8BB3105280FDFFull, 0x6D94396A4EF0F627ull },
+    { 0x4BA2F5A6A8673199ull, 0x3E102DEEA58D91B9ull },
+    { 0x7904BC3DDA3EB5C2ull, 0x3019E3176F48E927ull },
+    { 0x60D09697E1CBC49Bull, 0x4014B5AC590720ECull },
+    { 0x4D73ABACB4A303AFull, 0x4CDD5E237A6C1A57ull },
+    { 0x7BEC45E12104D2B2ull, 0x47C8969F2A46908Aull },
+    { 0x63236B1A80D0A88Eull, 0x6CA0787F5505406Full },
+    { 0x4F4F88E200A6ED3Full, 0x0A19F9FF773766BFull },
+    { 0x7EE5A7D0010B1531ull, 0x5CF65CCBF1F23DFEull },
+    { 0x6584864000D5AA8Eull, 0x172B7D6FF4C1CB32ull },
+    { 0x5136D1CCCD77BBA4ull, 0x78EF978CC3CE3C28ull },
+    { 0x40F8A7D70AC62FB7ull, 0x13F2DFA3CFD83020ull },
+    { 0x67F43FBE77A37F8Bull, 0x398499061959E699ull },
+    { 0x5329CC985FB5FFA2ull, 0x6136E0D1ADE18548ull },
+    { 0x4287D6E04C91994Full, 0x00F8B3DAF181376Dull },
+    { 0x6A72F166E0E8F54Bull, 0x1B27862B1C01F247ull },
+    { 0x5528C11F1A53F76Full, 0x2F52D1BC1667F506ull },
+    { 0x44209A7F48432C59ull, 0x0C424163451FF738ull },
+    { 0x6D00F7320D3846F4ull, 0x7A039BD208332526ull },
+    { 0x5733F8F4D76038C3ull, 0x7B361641A028EA85ull },
+    { 0x45C32D90AC4CFA36ull, 0x2F5E78348020BB9Eull },
+    { 0x6F9EAF4DE07B29F0ull, 0x4BCA59ED99CDF8FCull },
+    { 0x594BBF71806287F3ull, 0x563B7B247B0B2D96ull },
+    { 0x476FCC5ACD1B9FF6ull, 0x11C92F50626F57ACull },
+    { 0x724C7A2AE1C5CCBDull, 0x02DB7EE703E55912ull },
+    { 0x5B7061BBE7D17097ull, 0x1BE2CBEC031DE0DCull },
+    { 0x4926B496530DF3ACull, 0x164F09899C17E716ull },
+    { 0x750ABA8A1E7CB913ull, 0x3D4B4275C68CA4F0ull },
+    { 0x5DA22ED4E530940Full, 0x4AA29B916BA3B726ull },
+    { 0x4AE825771DC07672ull, 0x6EE87C74561C9285ull },
+    { 0x77D9D58B62CD8A51ull, 0x3173FA53BCFA8408ull },
+    { 0x5FE177A2B5713B74ull, 0x278FFB7630C869A0ull },
+    { 0x4CB45FB55DF42F90ull, 0x1FA662C4F3D387B3ull },
+    { 0x7ABA32BBC986B280ull, 0x32A3D13B1FB8D91Full },
+    { 0x622E8EFCA1388ECDull, 0x0EE9742F4C93E0E6ull },
+    { 0x4E8BA596E760723Dull, 0x58BAC3590A0FE71Eull },
+    { 0x7DAC3C24A5671D2Full, 0x412AD228101971C9ull },
+    { 0x6489C9B6EAB8E426ull, 0x00EF0E8673478E3Bull },
+    { 0x506E3AF8BBC71CEBull, 0x1A58D86B8F6C71C9ull },
+    { 0x40582F2D6305B0BCull, 0x1513E0560C56C16Eull },
+    { 0x66F37EAF04D5E793ull, 0x3B530089AD579BE2ull },
+    { 0x525C6558D0AB1FA9ull, 0x15DC006E2446164Full },
+    { 0x41E384470D55B2EDull, 0x5E4999F1B69E783Full },
+    { 0x696C06D81555EB15ull, 0x7D428FE92430C065ull },
+    { 0x54566BE0111188DEull, 0x31020CBA835A3384ull },
+    { 0x4378564CDA746D7Eull, 0x5A680A2ECF7B5C69ull },
+    { 0x6BF3BD47C3ED7BFDull, 0x770CDD17B25EFA42ull },
+    { 0x565C976C9CBDFCCBull, 0x1270B0DFC1E59502ull },
+    { 0x4516DF8A16FE63D5ull, 0x5B8D5A4C9B1E10CEull },
+    { 0x6E8AFF4357FD6C89ull, 0x127BC3ADC4FCE7B0ull },
+    { 0x586F329C466456D4ull, 0x0EC96957D0CA52F3ull },
+    { 0x46BF5BB038504576ull, 0x3F07877973D50F29ull },
+    { 0x71322C4D26E6D58Aull, 0x31A5A58F1FBB4B75ull },
+    { 0x5A8E89D75252446Eull, 0x5AEAEAD8E62F6F91ull },
+    { 0x487207DF750E9D25ull, 0x2F22557A51BF8C74ull },
+    { 0x73E9A63254E42EA2ull, 0x1836EF2A1C65AD86ull },
+    { 0x5CBAEB5B771CF21Bull, 0x2CF8BF54E3848AD2ull },
+    { 0x4A2F22AF927D8E7Cull, 0x23FA32AA4F9D3BDBull },
+    { 0x76B1D118EA627D93ull, 0x5329EAAA18FB92F8ull },
+    { 0x5EF4A74721E86476ull, 0x0F54BBBB472FA8C6ull },
+    { 0x4BF6EC38E7ED1D2Bull, 0x25DD62FC38F2ED6Cull },
+    { 0x798B138E3FE1C845ull, 0x22FBD1938E517BDFull },
+    { 0x613C0FA4FFE7D36Aull, 0x4F2FDADC71DAC97Full },
+    { 0x4DC9A61D998642BBull, 0x58F3157D27E23ACCull },
+    { 0x7C75D695C2706AC5ull, 0x74B82261D969F7ADull },
+    { 0x63917877CEC0556Bull, 0x10934EB4ADEE5FBEull },
+    { 0x4FA793930BCD1122ull, 0x4075D8908B251965ull },
+    { 0x7F7285B812E1B504ull, 0x00BC8DB411D4F56Eull },
+    { 0x65F537C675815D9Cull, 0x66FD3E29A7DD9125ull },
+    { 0x5190F96B91344AE3ull, 0x6BFDCB54864ADA84ull },
+    { 0x4140C78940F6A24Full, 0x6FFE3C439EA2486Aull },
+    { 0x6867A5A867F103B2ull, 0x7FFD2D38FDD073DCull },
+    { 0x53861E2053273628ull, 0x6664242D97D9F64Aull },
+    { 0x42D1B1B375B8F820ull, 0x51E9B68ADFE191D5ull },
+    { 0x6AE91C5255F4C034ull, 0x1CA924116635B621ull },
+    { 0x558749DB77F70029ull, 0x63BA83411E915E81ull },
+    { 0x446C3B15F9926687ull, 0x6962029A7EDAB201ull },
+    { 0x6D79F82328EA3DA6ull, 0x0F03375D97C45001ull },
+    { 0x5794C6828721CAEBull, 0x259C2C4ADFD04001ull },
+    { 0x46109ECED2816F22ull, 0x5149BD08B30D0001ull },
+    { 0x701A97B150CF1837ull, 0x3542C80DEB480001ull },
+    { 0x59AEDFC10D7279C5ull, 0x7768A00B22A00001ull },
+    { 0x47BF19673DF52E37ull, 0x79208008E8800001ull },
+    { 0x72CB5BD86321E38Cull, 0x5B67334174000001ull },
+    { 0x5BD5E313828182D6ull, 0x7C528F6790000001ull },
+    { 0x4977E8DC68679BDFull, 0x16A872B940000001ull },
+    { 0x758CA7C70D7292FEull, 0x5773EAC200000001ull },
+    { 0x5E0A1FD271287598ull, 0x45F6556800000001ull },
+    { 0x4B3B4CA85A86C47Aull, 0x04C5112000000001ull },
+    { 0x785EE10D5DA46D90ull, 0x07A1B50000000001ull },
+    { 0x604BE73DE4838AD9ull, 0x52E7C40000000001ull },
+    { 0x4D0985CB1D3608AEull, 0x0F1FD00000000001ull },
+    { 0x7B426FAB61F00DE3ull, 0x31CC800000000001ull },
+    { 0x629B8C891B267182ull, 0x5B0A000000000001ull },
+    { 0x4EE2D6D415B85ACEull, 0x7C08000000000001ull },
+    { 0x7E37BE2022C0914Bull, 0x1340000000000001ull },
+    { 0x64F964E68233A76Full, 0x2900000000000001ull },
+    { 0x50C783EB9B5C85F2ull, 0x5400000000000001ull },
+    { 0x409F9CBC7C4A04C2ull, 0x1000000000000001ull },
+    { 0x6765C793FA10079Dull, 0x0000000000000001ull },
+    { 0x52B7D2DCC80CD2E4ull, 0x0000000000000001ull },
+    { 0x422CA8B0A00A4250ull, 0x0000000000000001ull },
+    { 0x69E10DE76676D080ull, 0x0000000000000001ull },
+    { 0x54B40B1F852BDA00ull, 0x0000000000000001ull },
+    { 0x43C33C1937564800ull, 0x0000000000000001ull },
+    { 0x6C6B935B8BBD4000ull, 0x0000000000000001ull },
+    { 0x56BC75E2D6310000ull, 0x0000000000000001ull },
+    { 0x4563918244F40000ull, 0x0000000000000001ull },
+    { 0x6F05B59D3B200000ull, 0x0000000000000001ull },
+    { 0x58D15E1762800000ull, 0x0000000000000001ull },
+    { 0x470DE4DF82000000ull, 0x0000000000000001ull },
+    { 0x71AFD498D0000000ull, 0x0000000000000001ull },
+    { 0x5AF3107A40000000ull, 0x0000000000000001ull },
+    { 0x48C2739500000000ull, 0x0000000000000001ull },
+    { 0x746A528800000000ull, 0x0000000000000001ull },
+    { 0x5D21DBA000000000ull, 0x0000000000000001ull },
+    { 0x4A817C8000000000ull, 0x0000000000000001ull },
+    { 0x7735940000000000ull, 0x0000000000000001ull },
+    { 0x5F5E100000000000ull, 0x0000000000000001ull },
+    { 0x4C4B400000000000ull, 0x0000000000000001ull },
+    { 0x7A12000000000000ull, 0x0000000000000001ull },
+    { 0x61A8000000000000ull, 0x0000000000000001ull },
+    { 0x4E20000000000000ull, 0x0000000000000001ull },
+    { 0x7D00000000000000ull, 0x0000000000000001ull },
+    { 0x6400000000000000ull, 0x0000000000000001ull },
+    { 0x5000000000000000ull, 0x0000000000000001ull },
+    { 0x4000000000000000ull, 0x0000000000000001ull },
+    { 0x6666666666666666ull, 0x3333333333333334ull },
+    { 0x51EB851EB851EB85ull, 0x0F5C28F5C28F5C29ull },
+    { 0x4189374BC6A7EF9Dull, 0x5916872B020C49BBull },
+    { 0x68DB8BAC710CB295ull, 0x74F0D844D013A92Bull },
+    { 0x53E2D6238DA3C211ull, 0x43F3E0370CDC8755ull },
+    { 0x431BDE82D7B634DAull, 0x698FE69270B06C44ull },
+    { 0x6B5FCA6AF2BD215Eull, 0x0F4CA41D811A46D4ull },
+    { 0x55E63B88C230E77Eull, 0x3F70834ACDAE9F10ull },
+    { 0x44B82FA09B5A52CBull, 0x4C5A02A23E254C0Dull },
+    { 0x6DF37F675EF6EADFull, 0x2D5CD10396A21347ull },
+    { 0x57F5FF85E592557Full, 0x3DE3DA69454E75D3ull },
+    { 0x465E6604B7A84465ull, 0x7E4FE1EDD10B9175ull },
+    { 0x709709A125DA0709ull, 0x4A19697C81AC1BEFull },
+    { 0x5A126E1A84AE6C07ull, 0x54E1213067BCE326ull },
+    { 0x480EBE7B9D58566Cull, 0x43E74DC052FD8285ull },
+    { 0x734ACA5F6226F0ADull, 0x530BAF9A1E626A6Dull },
+    { 0x5C3BD5191B525A24ull, 0x426FBFAE7EB521F1ull },
+    { 0x49C97747490EAE83ull, 0x4EBFCC8B9890E7F4ull },
+    { 0x760F253EDB4AB0D2ull, 0x4ACC7A78F41B0CBAull },
+    { 0x5E72843249088D75ull, 0x223D2EC729AF3D62ull },
+    { 0x4B8ED0283A6D3DF7ull, 0x34FDBF05BAF29781ull },
+    { 0x78E480405D7B9658ull, 0x54C931A2C4B758CFull },
+    { 0x60B6CD004AC94513ull, 0x5D6DC14F03C5E0A5ull },
+    { 0x4D5F0A66A23A9DA9ull, 0x31249AA59C9E4D51ull },
+    { 0x7BCB43D769F762A8ull, 0x4EA0F76F60FD4882ull },
+    { 0x63090312BB2C4EEDull, 0x254D92BF80CAA068ull },
+    { 0x4F3A68DBC8F03F24ull, 0x1DD7A89933D54D20ull },
+    { 0x7EC3DAF941806506ull, 0x62F2A75B86221500ull },
+    { 0x65697BFA9ACD1D9Full, 0x025BB91604E810CDull },
+    { 0x51212FFBAF0A7E18ull, 0x684960DE6A5340A4ull },
+    { 0x40E7599625A1FE7Aull, 0x203AB3E521DC33B6ull },
+    { 0x67D88F56A29CCA5Dull, 0x19F7863B696052BDull },
+    { 0x5313A5DEE87D6EB0ull, 0x7B2C6B62BAB37564ull },
+    { 0x42761E4BED31255Aull, 0x2F56BC4EFBC2C450ull },
+    { 0x6A5696DFE1E83BC3ull, 0x655793B192D13A1Aull },
+    { 0x5512124CB4B9C969ull, 0x377942F475742E7Bull },
+    { 0x440E750A2A2E3ABAull, 0x5F9435905DF68B96ull },
+    { 0x6CE3EE76A9E3912Aull, 0x65B9EF4D63241289ull },
+    { 0x571CBEC554B60DBBull, 0x6AFB25D782834207ull },
+    { 0x45B0989DDD5E7163ull, 0x08C8EB12CECF6806ull },
+    { 0x6F80F42FC8971BD1ull, 0x5ADB11B7B14BD9A3ull },
+    { 0x5933F68CA078E30Eull, 0x157C0E2C8DD647B5ull },
+    { 0x475CC53D4D2D8271ull, 0x5DFCD823A4AB6C91ull },
+    { 0x722E086215159D82ull, 0x632E269F6DDF141Bull },
+    { 0x5B5806B4DDAAE468ull, 0x4F581EE5F17F4349ull },
+    { 0x49133890B1558386ull, 0x72ACE584C1329C3Bull },
+    { 0x74EB8DB44EEF38D7ull, 0x6AAE3C079B842D2Aull },
+    { 0x5D893E29D8BF60ACull, 0x5558300616035755ull },
+    { 0x4AD431BB13CC4D56ull, 0x7779C004DE6912ABull },
+    { 0x77B9E92B52E07BBEull, 0x258F99A163DB5111ull },
+    { 0x5FC7EDBC424D2FCBull, 0x37A614811CAF740Dull },
+    { 0x4C9FF163683DBFD5ull, 0x7951AA00E3BF900Bull },
+    { 0x7A998238A6C932EFull, 0x754F7667D2CC19ABull },
+    { 0x6214682D523A8F26ull, 0x2AA5F8530F09AE22ull },
+    { 0x4E76B9BDDB620C1Eull, 0x55519375A5A1581Bull },
+    { 0x7D8AC2C95F034697ull, 0x3BB5B8BC3C3559C5ull },
+    { 0x646F023AB2690545ull, 0x7C9160969691149Eull },
+    { 0x5058CE955B87376Bull, 0x16DAB3ABABA743B2ull },
+    { 0x40470BAAAF9F5F88ull, 0x78AEF622EFB902F5ull },
+    { 0x66D812AAB29898DBull, 0x0DE4BD04B2C19E54ull },
+    { 0x524675555BAD4715ull, 0x57EA30D08F014B76ull },
+    { 0x41D1F7777C8A9F44ull, 0x4654F3DA0C01092Cull },
+    { 0x694FF258C7443207ull, 0x23BB1FC346680EACull },
+    { 0x543FF513D29CF4D2ull, 0x4FC8E635D1ECD88Aull },
+    { 0x43665DA9754A5D75ull, 0x263A51C4A7F0AD3Bull },
+    { 0x6BD6FC425543C8BBull, 0x56C3B607731AAEC4ull },
+    { 0x5645969B77696D62ull, 0x789C919F8F488BD0ull },
+    { 0x4504787C5F878AB5ull, 0x46E3A7B2D906D640ull },
+    { 0x6E6D8D93CC0C1122ull, 0x3E390C515B3E239Aull },
+    { 0x5857A4763CD6741Bull, 0x4B60D6A77C31B615ull },
+    { 0x46AC8391CA4529AFull, 0x55E7121F968E2B44ull },
+    { 0x711405B6106EA919ull, 0x0971B698F0E3786Dull },
+    { 0x5A766AF80D255414ull, 0x078E2BAD8D82C6BDull },
+    { 0x485EBBF9A41DDCDCull, 0x6C71BC8AD79BD231ull },
+    { 0x73CAC65C39C96161ull, 0x2D82C7448C2C8382ull },
+    { 0x5CA23849C7D44DE7ull, 0x3E023903A356CF9Bull },
+    { 0x4A1B603B06437185ull, 0x7E682D9C82ABD949ull },
+    { 0x76923391A39F1C09ull, 0x4A4048FA6AAC8EDBull },
+    { 0x5EDB5C7482E5B007ull, 0x55003A61EEF07249ull },
+    { 0x4BE2B05D35848CD2ull, 0x773361E7F259F507ull },
+    { 0x796AB3C855A0E151ull, 0x3EB89CA6508FEE71ull },
+    { 0x6122296D114D810Dull, 0x7EFA16EB73A6585Bull },
+    { 0x4DB4EDF0DAA4673Eull, 0x3261ABEF8FB846AFull },
+    { 0x7C54AFE7C43A3ECAull, 0x1D691318E5F3A44Bull },
+    { 0x6376F31FD02E98A1ull, 0x64540F471E5C836Full },
+    { 0x4F925C1973587A1Bull, 0x0376729F4B7D35F3ull },
+    { 0x7F50935BEBC0C35Eull, 0x38BD84321261EFEBull },
+    { 0x65DA0F7CBC9A35E5ull, 0x13CAD0280EB4BFEFull },
+    { 0x517B3F96FD482B1Dull, 0x5CA240200BC3CCBFull },
+    { 0x412F66126439BC17ull, 0x63B50019A3030A33ull },
+    { 0x684BD683D38F9359ull, 0x1F88002904D1A9EAull },
+    { 0x536FDECFDC72DC47ull, 0x32D3335403DAEE55ull },
+    { 0x42BFE57316C249D2ull, 0x5BDC291003158B77ull },
+    { 0x6ACCA251BE03A951ull, 0x12F9DB4CD1BC1258ull },
+    { 0x557081DAFE695440ull, 0x7594AF70A7C9A847ull },
+    { 0x445A017BFEBAA9CDull, 0x4476F2C0863AED06ull },
+    { 0x6D5CCF2CCAC442E2ull, 0x3A57EACDA3917B3Cull },
+    { 0x577D728A3BD03581ull, 0x7B7988A482DAC8FDull },
+    { 0x45FDF53B630CF79Bull, 0x15FAD3B6CF156D97ull },
+    { 0x6FFCBB923814BF5Eull, 0x565E1F8AE4EF15BEull },
+    { 0x5996FC74F9AA32B2ull, 0x11E4E608B725AAFFull },
+    { 0x47ABFD2A6154F55Bull, 0x27EA51A0928488CCull },
+    { 0x72ACC843CEEE555Eull, 0x7310829A84074146ull },
+    { 0x5BBD6D030BF1DDE5ull, 0x42739BAED005CDD2ull },
+    { 0x49645735A327E4B7ull, 0x4EC2E2F24004A4A8ull },
+    { 0x756D5855D1D96DF2ull, 0x4AD16B1D333AA10Cull },
+    { 0x5DF11377DB1457F5ull, 0x2241227DC2954DA3ull },
+    { 0x4B2742C648DD132Aull, 0x4E9A81FE35443E1Cull },
+    { 0x783ED13D4161B844ull, 0x175D9CC9EED39694ull },
+    { 0x603240FDCDE7C69Cull, 0x7917B0A18BDC7876ull },
+    { 0x4CF500CB0B1FD217ull, 0x1412F3B46FE39392ull },
+    { 0x7B219ADE7832E9BEull, 0x535185ED7FD285B6ull },
+    { 0x628148B1F9C25498ull, 0x42A79E57997537C5ull },
+    { 0x4ECDD3C1949B76E0ull, 0x3552E512E12A9304ull },
+    { 0x7E161F9C20F8BE33ull, 0x6EEB081E3510EB39ull },
+    { 0x64DE7FB01A609829ull, 0x3F226CE4F740BC2Eull },
+    { 0x50B1FFC0151A1354ull, 0x3281F0B72C33C9BEull },
+    { 0x408E66334414DC43ull, 0x42018D5F568FD498ull },
+    { 0x674A3D1ED354939Full, 0x1CCF48988A7FBA8Dull },
+    { 0x52A1CA7F0F76DC7Full, 0x30A5D3AD3B99620Bull },
+    { 0x421B0865A5F8B065ull, 0x73B7DC8A96144E6Full },
+    { 0x69C4DA3C3CC11A3Cull, 0x52BFC7442353B0B1ull },
+    { 0x549D7B6363CDAE96ull, 0x756639034F7626F4ull },
+    { 0x43B12F82B63E2545ull, 0x4451C735D92B525Dull },
+    { 0x6C4EB26ABD303BA2ull, 0x3A1C71EFC1DEEA2Eull },
+    { 0x56A55B889759C94Eull, 0x61B05B2634B254F2ull },
+    { 0x45511606DF7B0772ull, 0x1AF37C1E908EAA5Bull },
+    { 0x6EE8233E325E7250ull, 0x2B1F2CFDB41776F8ull },
+    { 0x58B9B5CB5B7EC1D9ull, 0x6F4C23FE29AC5F2Dull },
+    { 0x46FAF7D5E2CBCE47ull, 0x72A34FFE87BD18F1ull },
+    { 0x71918C896ADFB073ull, 0x04387FFDA5FB5B1Bull },
+    { 0x5ADAD6D4557FC05Cull, 0x0360666484C915AFull },
+    { 0x48AF1243779966B0ull, 0x02B3851D3707448Cull },
+    { 0x744B506BF28F0AB3ull, 0x1DEC082EBE720746ull },
+    { 0x5D090D2328726EF5ull, 0x64BCD358985B3905ull },
+    { 0x4A6DA41C205B8BF7ull, 0x6A30A913AD15C738ull },
+    { 0x7715D36033C5ACBFull, 0x5D1AA81F7B560B8Cull },
+    { 0x5F44A919C3048A32ull, 0x7DAEECE5FC44D609ull },
+    { 0x4C36EDAE359D3B5Bull, 0x7E258A51969D7808ull },
+    { 0x79F17C49EF61F893ull, 0x16A276E8F0FBF33Full },
+    { 0x618DFD07F2B4C6DCull, 0x121B9253F3FCC299ull },
+    { 0x4E0B30D328909F16ull, 0x41AFA84329970214ull },
+    { 0x7CDEB4850DB431BDull, 0x4F7F739EA8F19CEDull },
+    { 0x63E55D373E29C164ull, 0x3F99294BBA5AE3F1ull },
+    { 0x4FEAB0F8FE87CDE9ull, 0x7FADBAA2FB7BE98Dull },
+    { 0x7FDDE7F4CA72E30Full, 0x7F7C5DD1925FDC15ull },
+    { 0x664B1FF7085BE8D9ull, 0x4C637E4141E649ABull },
+    { 0x51D5B32C06AFED7Aull, 0x704F983434B83AEFull },
+    { 0x4177C2899EF32462ull, 0x26A6135CF6F9C8BFull },
+    { 0x68BF9DA8FE51D3D0ull, 0x3DD685618B294132ull },
+    { 0x53CC7E20CB74A973ull, 0x4B12044E08EDCDC2ull },
+    { 0x4309FE80A2C3BAC2ull, 0x6F419D0B3A57D7CEull },
+    { 0x6B4330CDD1392AD1ull, 0x320294DEC3BFBFB0ull },
+    { 0x55CF5A3E40FA88A7ull, 0x419BAA4BCFCC995Aull },
+    { 0x44A5E1CB672ED3B9ull, 0x1AE2EEA30CA3ADE1ull },
+    { 0x6DD636123EB152C1ull, 0x77D17DD1ADD2AFCFull },
+    { 0x57DE91A832277567ull, 0x797464A7BE42263Full },
+    { 0x464BA7B9C1B92AB9ull, 0x4790508631CE84FFull },
+    { 0x70790C5C6928445Cull, 0x0C1A1A704FB0D4CCull },
+    { 0x59FA7049EDB9D049ull, 0x567B4859D95A43D6ull },
+    { 0x47FB8D07F161736Eull, 0x11FC39E17AAE9CABull },
+    { 0x732C14D98235857Dull, 0x032D2968C44A9445ull },
+    { 0x5C2343E134F79DFDull, 0x4F575453D03BA9D1ull },
+    { 0x49B5CFE75D92E4CAull, 0x72AC4376402FBB0Eull },
+    { 0x75EFB30BC8EB07ABull, 0x0446D256CD192B49ull },
+    { 0x5E595C096D88D2EFull, 0x1D0575123DADBC3Aull },
+    { 0x4B7AB0078AD3DBF2ull, 0x4A6AC40E97BE302Full },
+    { 0x78C44CD8DE1FC650ull, 0x771139B0F2C9E6B1ull },
+    { 0x609D0A4718196B73ull, 0x78DA948D8F07EBC1ull },
+    { 0x4D4A6E9F467ABC5Cull, 0x60AEDD3E0C065634ull },
+    { 0x7BAA4A9870C46094ull, 0x344AFB9679A3BD20ull },
+    { 0x62EEA2138D69E6DDull, 0x103BFC78614FCA80ull },
+    { 0x4F254E760ABB1F17ull, 0x26966393810CA200ull },
+    { 0x7EA21723445E9825ull, 0x2423D2859B476999ull },
+    { 0x654E78E9037EE01Dull, 0x69B642047C392148ull },
+    { 0x510B93ED9C658017ull, 0x6E2B680396941AA0ull },
+    { 0x40D60FF149EACCDFull, 0x71BC53361210154Dull },
+    { 0x67BCE64EDCAAE166ull, 0x1C6085235019BBAEull },
+    { 0x52FD850BE3BBE784ull, 0x7D1A041C40149625ull },
+    { 0x42646A6FE9631F9Dull, 0x4A7B367D0010781Dull },
+    { 0x6A3A43E642383295ull, 0x5D91F0C8001A59C8ull },
+    { 0x54FB698501C68EDEull, 0x17A7F3D3334847D4ull },
+    { 0x43FC546A67D20BE4ull, 0x79532975C2A03976ull },
+    { 0x6CC6ED770C83463Bull, 0x0EEB75893766C256ull },
+    { 0x57058AC5A39C382Full, 0x25892AD42C523512ull },
+    { 0x459E089E1C7CF9BFull, 0x37A0EF102374F742ull },
+    { 0x6F6340FCFA618F98ull, 0x59017E8038BB2536ull },
+    { 0x591C33FD951AD946ull, 0x7A67986693C8EA91ull },
+    { 0x4749C33144157A9Full, 0x151FAD1EDCA0BBA8ull },
+    { 0x720F9EB539BBF765ull, 0x0832AE97C76792A5ull },
+    { 0x5B3FB22A94965F84ull, 0x068EF21305EC7551ull },
+    { 0x48FFC1BBAA11E603ull, 0x1ED8C1A8D189F774ull },
+    { 0x74CC692C434FD66Bull, 0x4AF4690E1C0FF253ull },
+    { 0x5D705423690CAB89ull, 0x225D20D816732843ull },
+    { 0x4AC0434F873D5607ull, 0x35174D79AB8F5369ull },
+    { 0x779A054C0B955672ull, 0x21BEE25C45B21F0Eull },
+    { 0x5FAE6AA33C77785Bull, 0x3498B5169E2818D8ull },
+    { 0x4C8B888296C5F9E2ull, 0x5D46F7454B534713ull },
+    { 0x7A78DA6A8AD65C9Dull, 0x7BA4BED545520B52ull },
+    { 0x61FA48553BDEB07Eull, 0x2FB6FF110441A2A8ull },
+    { 0x4E61D37763188D31ull, 0x72F8CC0D9D014EEDull },
+    { 0x7D6952589E8DAEB6ull, 0x1E5AE015C80217E1ull },
+    { 0x645441E07ED7BEF8ull, 0x1848B344A001ACB4ull },
+    { 0x504367E6CBDFCBF9ull, 0x603A2903B3348A2Aull },
+    { 0x4035ECB8A3196FFBull, 0x002E873628F6D4EEull },
+    { 0x66BCADF43828B32Bull, 0x19E40B89DB2487E3ull },
+    { 0x52308B29C686F5BCull, 0x14B66FA17C1D3983ull },
+    { 0x41C06F549ED25E30ull, 0x1091F2E7967DC79Cull },
+    { 0x6933E554315096B3ull, 0x341CB7D8F0C93F5Full },
+    { 0x542984435AA6DEF5ull, 0x767D5FE0C0A0FF80ull },
+    { 0x435469CF7BB8B25Eull, 0x2B977FE70080CC66ull },
+    { 0x6BBA42E592C11D63ull, 0x5F58CCA4CD9AE0A3ull },
+    { 0x562E9BEADBCDB11Cull, 0x4C470A1D7148B3B6ull },
+    { 0x44F216557CA48DB0ull, 0x3D05A1B1276D5C92ull },
+    { 0x6E5023BBFAA0E2B3ull, 0x7B3C35E83F1560E9ull },
+    { 0x58401C96621A4EF6ull, 0x2F635E5365AAB3EDull },
+    { 0x4699B0784E7B725Eull, 0x591C4B75EAEEF658ull },
+    { 0x70F5E726E3F8B6FDull, 0x74FA125644B18A26ull },
+    { 0x5A5E5285832D5F31ull, 0x43FB41DE9D5AD4EBull },
+    { 0x484B75379C244C27ull, 0x4FFC34B2177BDD89ull },
+    { 0x73ABEEBF603A1372ull, 0x4CC6BAB68BF96274ull },
+    { 0x5C898BCC4CFB42C2ull, 0x0A38955ED6611B90ull },
+    { 0x4A07A309D72F689Bull, 0x21C6DDE5784DAFA7ull },
+    { 0x76729E762518A75Eull, 0x693E2FD58D49190Bull },
+    { 0x5EC2185E8413B918ull, 0x5431BFDE0AA0E0D5ull },
+    { 0x4BCE79E536762DADull, 0x29C1664B3BB3E711ull },
+    { 0x794A5CA1F0BD15E2ull, 0x0F9BD6DEC5ECA4E8ull },
+    { 0x61084A1B26FDAB1Bull, 0x2616457F04BD50BAull },
+    { 0x4DA03B48EBFE227Cull, 0x1E783798D09773C8ull },
+    { 0x7C33920E46636A60ull, 0x30C058F480F252D9ull },
+    { 0x635C74D8384F884Dull, 0x0D66AD9067284247ull },
+    { 0x4F7D2A469372D370ull, 0x711EF14052869B6Cull },
+    { 0x7F2EAA0A85848581ull, 0x34FE4ECD50D75F14ull },
+    { 0x65BEEE6ED136D134ull, 0x2A650BD773DF7F43ull },
+    { 0x51658B8BDA9240F6ull, 0x551DA312C319329Cull },
+    { 0x411E093CAEDB672Bull, 0x5DB14F4235ADC217ull },
+    { 0x68300EC77E2BD845ull, 0x7C4EE536BC49368Aull },
+    { 0x5359A56C64EFE037ull, 0x7D0BEA92303A9208ull },
+    { 0x42AE1DF050BFE693ull, 0x173CBBA8269541A0ull },
+    { 0x6AB02FE6E79970EBull, 0x3EC792A6A422029Aull },
+    { 0x5559BFEBEC7AC0BCull, 0x3239421EE9B4CEE1ull },
+    { 0x4447CCBCBD2F0096ull, 0x5B6101B25490A581ull },
+    { 0x6D3FADFAC84B3424ull, 0x2BCE691D541AA268ull },
+    { 0x576624C8A03C29B6ull, 0x563EBA7DDCE21B87ull },
+    { 0x45EB50A08030215Eull, 0x78322ECB171B4939ull },
+    { 0x6FDEE76733803564ull, 0x59E9E47824F87527ull },
+    { 0x597F1F85C2CCF783ull, 0x6187E9F9B72D2A86ull },
+    { 0x4798E6049BD72C69ull, 0x346CBB2E2C242205ull },
+    { 0x728E3CD42C8B7A42ull, 0x20ADF849E039D007ull },
+    { 0x5BA4FD768A092E9Bull, 0x33BE603B19C7D99Full },
+    { 0x4950CAC53B3A8BAFull, 0x42FEB3627B0647B3ull },
+    { 0x754E113B91F745E5ull, 0x5197856A5E7072B8ull },
+    { 0x5DD80DC941929E51ull, 0x27AC6ABB7EC05BC6ull },
+    { 0x4B133E3A9ADBB1DAull, 0x52F05562CBCD1638ull },
+    { 0x781EC9F75E2C4FC4ull, 0x1E4D556ADFAE89F3ull },
+    { 0x6018A192B1BD0C9Cull, 0x7EA444557FBED4C3ull },
+    { 0x4CE0814227CA707Dull, 0x4BB69D1132FF109Cull },
+    { 0x7B00CED03FAA4D95ull, 0x5F8A94E851981A93ull },
+    { 0x62670BD9CC883E11ull, 0x32D543ED0E134875ull },
+    { 0x4EB8D647D6D364DAull, 0x5BDDCFF0D80F6D2Bull },
+    { 0x7DF48A0C8AEBD491ull, 0x12FC7FE7C018AEABull },
+    { 0x64C3A1A3A25643A7ull, 0x28C9FFEC99AD5889ull },
+    { 0x509C814FB511CFB9ull, 0x0707FFF07AF113A1ull },
+    { 0x407D343FC40E3FC7ull, 0x1F39998D2F2742E7ull },
+    { 0x672EB9FFA016CC71ull, 0x7EC28F484B7204A4ull },
+    { 0x528BC7FFB345705Bull, 0x189BA5D36F8E6A1Dull },
+    { 0x42096CCC8F6AC048ull, 0x7A161E42BFA521B1ull },
+    { 0x69A8AE1418AACD41ull, 0x435696D132A1CF81ull },
+    { 0x5486F1A9AD557101ull, 0x1C454574288172CEull },
+    { 0x439F27BAF1112734ull, 0x169DD129BA0128A5ull },
+    { 0x6C31D92B1B4EA520ull, 0x242FB50F9001DAA1ull },
+    { 0x568E4755AF721DB3ull, 0x368C90D940017BB4ull },
+    { 0x453E9F77BF8E7E29ull, 0x120A0D7A999AC95Dull },
+    { 0x6ECA98BF98E3FD0Eull, 0x50101590F5C47561ull },
+    { 0x58A213CC7A4FFDA5ull, 0x26734473F7D05DE8ull },
+    { 0x46E80FD6C83FFE1Dull, 0x6B8F69F65FD9E4B9ull },
+    { 0x71734C8AD9FFFCFCull, 0x45B24323CC8FD45Cull },
+    { 0x5AC2A3A247FFFD96ull, 0x6AF502830A0CA9E3ull },
+    { 0x489BB61B6CCCCADFull, 0x08C402026E7087E9ull },
+    { 0x742C569247AE1164ull, 0x746CD003E3E73FDBull },
+    { 0x5CF04541D2F1A783ull, 0x76BD73364FEC3315ull },
+    { 0x4A59D101758E1F9Cull, 0x5EFDF5C50CBCF5ABull },
+    { 0x76F61B3588E365C7ull, 0x4B2FEFA1ADFB22ABull },
+    { 0x5F2B48F7A0B5EB06ull, 0x08F3261AF195B555ull },
+    { 0x4C22A0C61A2B226Bull, 0x20C284E25ADE2AABull },
+    { 0x79D1013CF6AB6A45ull, 0x1AD0D49D5E304444ull },
+    { 0x617400FD9222BB6Aull, 0x48A7107DE4F369D0ull },
+    { 0x4DF6673141B562BBull, 0x53B8D9FE50C2BB0Dull },
+    { 0x7CBD71E869223792ull, 0x52C15CCA1AD12B48ull },
+    { 0x63CAC186BA81C60Eull, 0x75677D6E7BDA8906ull },
+    { 0x4FD5679EFB9B04D8ull, 0x5DEC645863153A6Cull },
+    { 0x7FBBD8FE5F5E6E27ull, 0x497A3A2704EEC3DFull },};
+
+/// Schubfach rounding of g * cp / 2^128, the lowest bit is sticky.
+inline std::uint64_t schubfach_rop(std::uint64_t g1, std::uint64_t g0, std::uint64_t cp) STR_NOEXCEPT
+{
+    constexpr std::uint64_t mask63 = (std::uint64_t(1) << 63) - 1;
+
+    auto x1 = umulh64(g0, cp);
+    auto y0 = g1 * cp;
+    auto y1 = umulh64(g1, cp);
+    auto z = (y0 >> 1) + x1;
+    auto vbp = y1 + (z >> 63);
+    return vbp | (((z & mask63) + mask63) >> 63);
+}
+
+/// Schubfach rounding of g * cp / 2^96 for float, the lowest bit is sticky.
+inline std::uint32_t schubfach_rop(std::uint64_t g, std::uint64_t cp) STR_NOEXCEPT
+{
+    constexpr std::uint64_t mask32 = 0xFFFFFFFFu;
+
+    auto x1 = umulh64(g, cp);
+    auto vbp = x1 >> 31;
+    return static_cast<std::uint32_t>(vbp | (((x1 & mask32) + mask32) >> 32));
+}
+
+/// Shortest decimal significand and exponent, value = significand * 10^exponent.
+template <typename UInt>
+struct shortest_decimal
+{
+    UInt significand;
+    int exponent;
+};
+
+/// Finds the shortest decimal in the rounding interval of c * 2^q, closest to it,
+/// with Raffaello Giulietti's Schubfach algorithm. dk corrects k for scaled tiny c.
+template <typename Float>
+inline auto schubfach(int q, std::uint64_t c, int dk) STR_NOEXCEPT
+{
+    constexpr bool is_double = std::is_same_v<Float, double>;
+    constexpr int q_min = is_double ? -1074 : -149;
+    constexpr std::uint64_t c_min = std::uint64_t(1) << (is_double ? 52 : 23);
+
+    using UInt = std::conditional_t<is_double, std::uint64_t, std::uint32_t>;
+    using Int = std::make_signed_t<UInt>;
+
+    auto out = static_cast<UInt>(c & 1);
+    auto cb = c << 2;
+    auto cbr = cb + 2;
+    std::uint64_t cbl;
+    int k;
+
+    // the interval is asymmetric at the powers of two
+    if (c != c_min || q == q_min)
+    {
+        cbl = cb - 2;
+        k = flog10pow2(q);
+    }
+    else
+    {
+        cbl = cb - 1;
+        k = flog10threequarterspow2(q);
+    }
+
+    auto &g = pow10_g[k - pow10_g_min];
+    UInt vb, vbl, vbr;
+    if constexpr (is_double)
+    {
+        auto h = q + flog2pow10(-k) + 2;
+        vb = schubfach_rop(g[0], g[1], cb << h);
+        vbl = schubfach_rop(g[0], g[1], cbl << h);
+        vbr = schubfach_rop(g[0], g[1], cbr << h);
+    }
+    else
+    {
+        auto h = q + flog2pow10(-k) + 33;
+        vb = schubfach_rop(g[0] + 1, cb << h);
+        vbl = schubfach_rop(g[0] + 1, cbl << h);
+        vbr = schubfach_rop(g[0] + 1, cbr << h);
+    }
+
+    // one digit less when a multiple of ten is in the interval,
+    // it is the only one as the interval is narrower than ten
+    UInt s = vb >> 2;
+    if (s >= 10)
+    {
+        UInt sp10 = 10 * (s / 10);
+        UInt tp10 = sp10 + 10;
+        bool upin = vbl + out <= sp10 << 2;
+        bool wpin = (tp10 << 2) + out <= vbr;
+        if (upin != wpin)
+            return shortest_decimal<UInt>{ upin ? sp10 : tp10, k };
+    }
+
+    // else the closest of s and s + 1 in the interval, ties to even
+    UInt t = s + 1;
+    bool uin = vbl + out <= s << 2;
+    bool win = (t << 2) + out <= vbr;
+    if (uin != win)
+        return shortest_decimal<UInt>{ uin ? s : t, k + dk };
+
+    auto cmp = static_cast<Int>(vb - ((s + t) << 1));
+    return shortest_decimal<UInt>{ (cmp < 0 || (cmp == 0 && (s & 1) == 0)) ? s : t, k + dk };
+}
+
+/// Returns the shortest decimal that rounds to the finite nonzero value, without its sign.
+template <typename Float>
+inline auto to_shortest_decimal(Float value) STR_NOEXCEPT
+{
+    constexpr bool is_double = std::is_same_v<Float, double>;
+    constexpr int p = is_double ? 53 : 24;
+    constexpr int q_min = is_double ? -1074 : -149;
+    constexpr std::uint64_t c_min = std::uint64_t(1) << (p - 1);
+
+    using UInt = std::conditional_t<is_double, std::uint64_t, std::uint32_t>;
+
+    UInt bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    auto t = static_cast<std::uint64_t>(bits & (c_min - 1));
+    auto bq = static_cast<int>(bits >> (p - 1)) & ((1 << (sizeof(UInt) * 8 - p)) - 1);
+
+    if (bq != 0)
+    {
+        auto mq = -q_min + 1 - bq;
+        auto c = c_min | t;
+
+        // integers are exact
+        if (0 < mq && mq < p)
+        {
+            auto f = c >> mq;
+            if (f << mq == c)
+                return shortest_decimal<UInt>{ static_cast<UInt>(f), 0 };
+        }
+
+        return schubfach<Float>(-mq, c, 0);
+    }
+
+    return schubfach<Float>(q_min, t, 0);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Exact decimal
+//////////////////////////////////////////////////////////////////////
+
+/// Decimal digits of a floating point value, d0.d1d2... * 10^exponent,
+/// without trailing zeros. Zero has no digits.
+struct float_decimal
+{
+    // a double has at most 767 significant digits, the last 9 digit
+    // chunk of its expansion may add 8 zeros
+    char digits[800];
+    int count;
+    int exponent;
+};
+
+/// Appends the 9 digits of chunk, leading zeros of the value are skipped.
+inline void push_nine_digits(float_decimal &dec, std::uint32_t chunk) STR_NOEXCEPT
+{
+    char buffer[9];
+    for (int i = 8; i >= 0; i--, chunk /= 10)
+        buffer[i] = static_cast<char>('0' + chunk % 10);
+
+    for (auto ch : buffer)
+    {
+        if (dec.count == 0 && ch == '0')
+            dec.exponent--;
+        else
+            dec.digits[dec.count++] = ch;
+    }
+}
+
+/// Writes the digits of the finite value without its sign, computed exactly
+/// in fixed size 32 bit limbs on the stack. The expansion stops past limit digits,
+/// a cut one ends with a sticky 1 so that rounding still sees the digits left.
+inline void to_exact_decimal(float_decimal &dec, double value, long long limit = 800) STR_NOEXCEPT
+{
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    auto bq = static_cast<int>(bits >> 52) & 0x7FF;
+    auto m = bits & ((std::uint64_t(1) << 52) - 1);
+    auto e = (bq ? bq : 1) - 1075;
+    if (bq)
+        m |= std::uint64_t(1) << 52;
+
+    dec.count = 0;
+    dec.exponent = -1;
+
+    std::uint32_t limbs[40] = {};
+    if (e >= 0)
+    {
+        // m * 2^e is an integer of up to 1024 bits, split in 9 digit chunks
+        auto word = static_cast<std::size_t>(e / 32);
+        auto shift = e % 32;
+        auto lo = (m & 0xFFFFFFFFu) << shift;
+        auto hi = (m >> 32 << shift) + (lo >> 32);
+        limbs[word] = static_cast<std::uint32_t>(lo);
+        limbs[word + 1] = static_cast<std::uint32_t>(hi);
+        limbs[word + 2] = static_cast<std::uint32_t>(hi >> 32);
+
+        std::uint32_t chunks[40];
+        std::size_t nchunks = 0;
+        for (auto size = word + 3; size > 0;)
+        {
+            std::uint64_t rem = 0;
+            for (auto i = size; i-- > 0;)
+            {
+                auto cur = (rem << 32) | limbs[i];
+                limbs[i] = static_cast<std::uint32_t>(cur / 1000000000u);
+                rem = cur % 1000000000u;
+            }
+
+            chunks[nchunks++] = static_cast<std::uint32_t>(rem);
+            while (size > 0 && limbs[size - 1] == 0)
+                size--;
+        }
+
+        auto exponent = static_cast<int>(count_digits10(chunks[nchunks - 1]) + 9 * (nchunks - 1)) - 1;
+        while (nchunks > 0 && dec.count < limit)
+            push_nine_digits(dec, chunks[--nchunks]);
+
+        dec.exponent = exponent;
+
+        while (nchunks > 0)
+        {
+            if (chunks[--nchunks] != 0)
+            {
+                dec.digits[dec.count++] = '1';
+                break;
+            }
+        }
+    }
+    else
+    {
+        // integer part, then the fraction below bit s times 10^9 at a time
+        auto s = static_cast<std::size_t>(-e);
+        if (s < 64)
+        {
+            auto ip = m >> s;
+            if (ip)
+            {
+                auto size = count_digits10(ip);
+                write_digits10(dec.digits + size, ip);
+                dec.count = static_cast<int>(size);
+                dec.exponent = dec.count - 1;
+            }
+
+            m &= (std::uint64_t(1) << s) - 1;
+        }
+
+        limbs[0] = static_cast<std::uint32_t>(m);
+        limbs[1] = static_cast<std::uint32_t>(m >> 32);
+
+        auto word = s / 32;
+        auto shift = s % 32;
+        std::size_t low = 0;
+        while (low <= word)
+        {
+            if (limbs[low] == 0)
+            {
+                low++;
+                continue;
+            }
+
+            std::uint64_t carry = 0;
+            for (auto i = low; i <= word; i++)
+            {
+                auto cur = std::uint64_t(limbs[i]) * 1000000000u + carry;
+                limbs[i] = static_cast<std::uint32_t>(cur);
+                carry = cur >> 32;
+            }
+            limbs[word + 1] = static_cast<std::uint32_t>(carry);
+
+            auto top = (std::uint64_t(limbs[word + 1]) << 32 | limbs[word]) >> shift;
+            limbs[word] &= static_cast<std::uint32_t>((std::uint64_t(1) << shift) - 1);
+            limbs[word + 1] = 0;
+
+            push_nine_digits(dec, static_cast<std::uint32_t>(top));
+            if (dec.count >= limit)
+            {
+                if (std::any_of(limbs + low, limbs + word + 1, [](std::uint32_t limb) { return limb != 0; }))
+                    dec.digits[dec.count++] = '1';
+                break;
+            }
+        }
+    }
+
+    while (dec.count > 0 && dec.digits[dec.count - 1] == '0')
+        dec.count--;
+}
+
+/// Rounds to the first keep digits, half to even.
+inline void round_decimal(float_decimal &dec, long long keep) STR_NOEXCEPT
+{
+    if (keep >= dec.count)
+        return;
+
+    if (keep < 0)
+    {
+        dec.count = 0;
+        return;
+    }
+
+    auto index = static_cast<int>(keep);
+    auto digit = dec.digits[index];
+    bool up = digit > '5' || (digit == '5' && (index + 1 < dec.count || (index > 0 && (dec.digits[index - 1] - '0') % 2)));
+
+    dec.count = index;
+    if (up)
+    {
+        while (dec.count > 0 && dec.digits[dec.count - 1] == '9')
+            dec.count--;
+
+        if (dec.count == 0)
+        {
+            dec.digits[dec.count++] = '1';
+            dec.exponent++;
+        }
+        else
+        {
+            dec.digits[dec.count - 1]++;
+        }
+    }
+
+    while (dec.count > 0 && dec.digits[dec.count - 1] == '0')
+        dec.count--;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Floating point formatting
+//////////////////////////////////////////////////////////////////////
+
+/// Digits and layout of a formatted floating point value.
+struct float_chars : float_decimal
+{
+    const char *special; // "inf" or "nan", or nullptr
+    bool negative;
+    bool scientific;
+    std::size_t precision; // digits after the decimal point
+};
+
+/// Writes the characters of chars to out, or only counts them if out is nullptr.
+/// @return the count of characters.
+template <typename Char>
+inline std::size_t write_float_chars(Char *out, const float_chars &chars) STR_NOEXCEPT
+{
+    std::size_t size = 0;
+    auto put = [&](char ch, std::size_t count = 1)
+    {
+        if (out)
+        {
+            for (std::size_t i = 0; i < count; i++)
+                out[size + i] = static_cast<Char>(ch);
+        }
+        size += count;
+    };
+    auto put_digits = [&](int first, int last)
+    {
+        if (out)
+        {
+            for (int i = first; i < last; i++)
+                out[size + static_cast<std::size_t>(i - first)] = static_cast<Char>(chars.digits[i]);
+        }
+        size += static_cast<std::size_t>(last - first);
+    };
+
+    if (chars.negative)
+        put('-');
+
+    if (chars.special)
+    {
+        for (auto s = chars.special; *s; s++)
+            put(*s);
+
+        return size;
+    }
+
+    auto count = chars.count;
+    auto exponent = count ? chars.exponent : 0;
+    if (chars.scientific)
+    {
+        put(count ? chars.digits[0] : '0');
+        if (chars.precision)
+        {
+            put('.');
+            auto frac = std::min<std::size_t>(chars.precision, static_cast<std::size_t>(std::max(count - 1, 0)));
+            put_digits(1, 1 + static_cast<int>(frac));
+            put('0', chars.precision - frac);
+        }
+
+        put('e');
+        put(exponent < 0 ? '-' : '+');
+
+        auto abs = static_cast<unsigned>(exponent < 0 ? -exponent : exponent);
+        auto digits = abs < 10 ? 2 : count_digits10(abs);
+        if (out)
+        {
+            out[size] = static_cast<Char>('0');
+            write_digits10(out + size + digits, abs);
+        }
+        size += digits;
+    }
+    else
+    {
+        // integer part, padded with zeros up to the point
+        if (exponent < 0 || count == 0)
+        {
+            put('0');
+        }
+        else
+        {
+            auto whole = std::min(count, exponent + 1);
+            put_digits(0, whole);
+            put('0', static_cast<std::size_t>(exponent + 1 - whole));
+        }
+
+        if (chars.precision)
+        {
+            put('.');
+
+            // zeros after the point, the digits left, then zeros again
+            auto remaining = chars.precision;
+            auto zeros = std::min<std::size_t>(remaining, static_cast<std::size_t>(count && exponent < -1 ? -exponent - 1 : 0));
+            put('0', zeros);
+            remaining -= zeros;
+
+            auto first = std::max(exponent + 1, 0);
+            auto frac = std::min<std::size_t>(remaining, static_cast<std::size_t>(std::max(count - first, 0)));
+            put_digits(first, first + static_cast<int>(frac));
+            put('0', remaining - frac);
+        }
+    }
+
+    return size;
+}
+
+/// Computes the digits and layout of value in fmt. Without a precision the digits
+/// are the shortest ones that read back to value, else like printf's %f, %e and %g.
+template <typename Float>
+inline void to_float_chars(float_chars &chars, Float value, float_format fmt, int precision) STR_NOEXCEPT
+{
+    static_assert(std::is_same_v<Float, float> || std::is_same_v<Float, double>, "Float must be float or double");
+
+    using UInt = std::conditional_t<std::is_same_v<Float, double>, std::uint64_t, std::uint32_t>;
+    constexpr int bits_size = sizeof(UInt) * 8;
+    constexpr int mantissa_size = std::numeric_limits<Float>::digits - 1;
+
+    UInt bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    chars.negative = (bits >> (bits_size - 1)) != 0;
+    chars.special = nullptr;
+    chars.scientific = false;
+    chars.precision = 0;
+    chars.count = 0;
+    chars.exponent = 0;
+
+    bits &= ~(UInt(1) << (bits_size - 1));
+    if ((bits >> mantissa_size) == (UInt(1) << (bits_size - 1 - mantissa_size)) - 1)
+    {
+        chars.special = (bits & ((UInt(1) << mantissa_size) - 1)) ? "nan" : "inf";
+        return;
+    }
+
+    if (precision < 0)
+    {
+        if (bits != 0)
+        {
+            auto shortest = to_shortest_decimal(value);
+            auto size = static_cast<int>(count_digits10(shortest.significand));
+            write_digits10(chars.digits + size, shortest.significand);
+
+            chars.count = size;
+            while (chars.count > 0 && chars.digits[chars.count - 1] == '0')
+                chars.count--;
+            chars.exponent = shortest.exponent + size - 1;
+        }
+
+        auto fixed = static_cast<std::size_t>(std::max(chars.count - 1 - chars.exponent, 0));
+        auto scientific = static_cast<std::size_t>(std::max(chars.count - 1, 0));
+
+        if (fmt == float_format::general)
+        {
+            // the shorter one, ties go to fixed
+            chars.precision = fixed;
+            auto fixed_size = write_float_chars<char>(nullptr, chars);
+            chars.scientific = true;
+            chars.precision = scientific;
+            if (fixed_size <= write_float_chars<char>(nullptr, chars))
+            {
+                chars.scientific = false;
+                chars.precision = fixed;
+            }
+        }
+        else
+        {
+            chars.scientific = fmt == float_format::scientific;
+            chars.precision = chars.scientific ? scientific : fixed;
+        }
+
+        // like printf's %.0f, the integer digits past the shortest ones are exact, not zeros
+        if (!chars.scientific && chars.count && chars.exponent >= chars.count)
+            to_exact_decimal(chars, static_cast<double>(value));
+
+        return;
+    }
+
+    if (bits != 0)
+    {
+        // the digits up to the rounding one, fixed uses an upper bound of the exponent
+        auto wide = static_cast<double>(value);
+        std::uint64_t wide_bits;
+        std::memcpy(&wide_bits, &wide, sizeof(wide_bits));
+
+        auto exponent = flog10pow2(static_cast<int>(wide_bits >> 52) - 1022);
+        auto digits = fmt == float_format::fixed        ? exponent + 1LL + precision
+                      : fmt == float_format::scientific ? precision + 1LL
+                                                        : std::max(precision, 1) + 0LL;
+        to_exact_decimal(chars, wide, std::max(digits + 1, 1LL));
+    }
+
+    switch (fmt)
+    {
+    case float_format::fixed:
+        if (chars.count)
+            round_decimal(chars, chars.exponent + 1LL + precision);
+        chars.precision = static_cast<std::size_t>(precision);
+        break;
+
+    case float_format::scientific:
+        round_decimal(chars, precision + 1LL);
+        chars.scientific = true;
+        chars.precision = static_cast<std::size_t>(precision);
+        break;
+
+    case float_format::general:
+    {
+        // P significant digits, fixed for exponents in [-4, P), without trailing zeros
+        auto p = precision ? precision : 1;
+        round_decimal(chars, p);
+
+        auto exponent = chars.count ? chars.exponent : 0;
+        chars.scientific = exponent < -4 || exponent >= p;
+        chars.precision = static_cast<std::size_t>(std::max(chars.scientific ? chars.count - 1 : chars.count - 1 - exponent, 0));
+        break;
+    }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// Floating point parsing
+//////////////////////////////////////////////////////////////////////
+
+/// 5^q normalized to 128 bits, truncated for q >= 0 and rounded up for q < 0,
+/// for q in [-342, 308], as in Daniel Lemire's fast_float.
+inline constexpr int pow5_128_min = -342;
+inline constexpr std::uint64_t pow5_128[651][2] = {
+    { 0xEEF453D6923BD65Aull, 0x113FAA2906A13B3Full },
+    { 0x9558B4661B6565F8ull, 0x4AC7CA59A424C507ull },
+    { 0xBAAEE17FA23EBF76ull, 0x5D79BCF00D2DF649ull },
+    { 0xE95A99DF8ACE6F53ull, 0xF4D82C2C107973DCull },
+    { 0x91D8A02BB6C10594ull, 0x79071B9B8A4BE869ull },
+    { 0xB64EC836A47146F9ull, 0x9748E2826CDEE284ull },
+    { 0xE3E27A444D8D98B7ull, 0xFD1B1B2308169B25ull },
+    { 0x8E6D8C6AB0787F72ull, 0xFE30F0F5E50E20F7ull },
+    { 0xB208EF855C969F4Full, 0xBDBD2D335E51A935ull },
+    { 0xDE8B2B66B3BC4723ull, 0xAD2C788035E61382ull },
+    { 0x8B16FB203055AC76ull, 0x4C3BCB5021AFCC31ull },
+    { 0xADDCB9E83C6B1793ull, 0xDF4ABE242A1BBF3Dull },
+    { 0xD953E8624B85DD78ull, 0xD71D6DAD34A2AF0Dull },
+    { 0x87D4713D6F33AA6Bull, 0x8672648C40E5AD68ull },
+    { 0xA9C98D8CCB009506ull, 0x680EFDAF511F18C2ull },
+    { 0xD43BF0EFFDC0BA48ull, 0x0212BD1B2566DEF2ull },
+    { 0x84A57695FE98746Dull, 0x014BB630F7604B57ull },
+    { 0xA5CED43B7E3E9188ull, 0x419EA3BD35385E2Dull },
+    { 0xCF42894A5DCE35EAull, 0x52064CAC828675B9ull },
+    { 0x818995CE7AA0E1B2ull, 0x7343EFEBD1940993ull },
+    { 0xA1EBFB4219491A1Full, 0x1014EBE6C5F90BF8ull },
+    { 0xCA66FA129F9B60A6ull, 0xD41A26E077774EF6ull },
+    { 0xFD00B897478238D0ull, 0x8920B098955522B4ull },
+    { 0x9E20735E8CB16382ull, 0x55B46E5F5D5535B0ull },
+    { 0xC5A890362FDDBC62ull, 0xEB2189F734AA831Dull },
+    { 0xF712B443BBD52B7Bull, 0xA5E9EC7501D523E4ull },
+    { 0x9A6BB0AA55653B2Dull, 0x47B233C92125366Eull },
+    { 0xC1069CD4EABE89F8ull, 0x999EC0BB696E840Aull },
+    { 0xF148440A256E2C76ull, 0xC00670EA43CA250Dull },
+    { 0x96CD2A865764DBCAull, 0x380406926A5E5728ull },
+    { 0xBC807527ED3E12BCull, 0xC605083704F5ECF2ull },
+    { 0xEBA09271E88D976Bull, 0xF7864A44C633682Eull },
+    { 0x93445B8731587EA3ull, 0x7AB3EE6AFBE0211Dull },
+    { 0xB8157268FDAE9E4Cull, 0x5960EA05BAD82964ull },
+    { 0xE61ACF033D1A45DFull, 0x6FB92487298E33BDull },
+    { 0x8FD0C16206306BABull, 0xA5D3B6D479F8E056ull },
+    { 0xB3C4F1BA87BC8696ull, 0x8F48A4899877186Cull },
+    { 0xE0B62E2929ABA83Cull, 0x331ACDABFE94DE87ull },
+    { 0x8C71DCD9BA0B4925ull, 0x9FF0C08B7F1D0B14ull },
+    { 0xAF8E5410288E1B6Full, 0x07ECF0AE5EE44DD9ull },
+    { 0xDB71E91432B1A24Aull, 0xC9E82CD9F69D6150ull },
+    { 0x892731AC9FAF056Eull, 0xBE311C083A225CD2ull },
+    { 0xAB70FE17C79AC6CAull, 0x6DBD630A48AAF406ull },
+    { 0xD64D3D9DB981787Dull, 0x092CBBCCDAD5B108ull },
+    { 0x85F0468293F0EB4Eull, 0x25BBF56008C58EA5ull },
+    { 0xA76C582338ED2621ull, 0xAF2AF2B80AF6F24Eull },
+    { 0xD1476E2C07286FAAull, 0x1AF5AF660DB4AEE1ull },
+    { 0x82CCA4DB847945CAull, 0x50D98D9FC890ED4Dull },
+    { 0xA37FCE126597973Cull, 0xE50FF107BAB528A0ull },
+    { 0xCC5FC196FEFD7D0Cull, 0x1E53ED49A96272C8ull },
+    { 0xFF77B1FCBEBCDC4Full, 0x25E8E89C13BB0F7Aull },
+    { 0x9FAACF3DF73609B1ull, 0x77B191618C54E9ACull },
+    { 0xC795830D75038C1Dull, 0xD59DF5B9EF6A2417ull },
+    { 0xF97AE3D0D2446F25ull, 0x4B0573286B44AD1Dull },
+    { 0x9BECCE62836AC577ull, 0x4EE367F9430AEC32ull },
+    { 0xC2E801FB244576D5ull, 0x229C41F793CDA73Full },
+    { 0xF3A20279ED56D48Aull, 0x6B43527578C1110Full },
+    { 0x9845418C345644D6ull, 0x830A13896B78AAA9ull },
+    { 0xBE5691EF416BD60Cull, 0x23CC986BC656D553ull },
+    { 0xEDEC366B11C6CB8Full, 0x2CBFBE86B7EC8AA8ull },
+    { 0x94B3A202EB1C3F39ull, 0x7BF7D71432F3D6A9ull },
+    { 0xB9E08A83A5E34F07ull, 0xDAF5CCD93FB0CC53ull },
+    { 0xE858AD248F5C22C9ull, 0xD1B3400F8F9CFF68ull },
+    { 0x91376C36D99995BEull, 0x23100809B9C21FA1ull },
+    { 0xB58547448FFFFB2Dull, 0xABD40A0C2832A78Aull },
+    { 0xE2E69915B3FFF9F9ull, 0x16C90C8F323F516Cull },
+    { 0x8DD01FAD907FFC3Bull, 0xAE3DA7D97F6792E3ull },
+    { 0xB1442798F49FFB4Aull, 0x99CD11CFDF41779Cull },
+    { 0xDD95317F31C7FA1Dull, 0x40405643D711D583ull },
+    { 0x8A7D3EEF7F1CFC52ull, 0x482835EA666B2572ull },
+    { 0xAD1C8EAB5EE43B66ull, 0xDA3243650005EECFull },
+    { 0xD863B256369D4A40ull, 0x90BED43E40076A82ull },
+    { 0x873E4F75E2224E68ull, 0x5A7744A6E804A291ull },
+    { 0xA90DE3535AAAE202ull, 0x711515D0A205CB36ull },
+    { 0xD3515C2831559A83ull, 0x0D5A5B44CA873E03ull },
+    { 0x8412D9991ED58091ull, 0xE858790AFE9486C2ull },
+    { 0xA5178FFF668AE0B6ull, 0x626E974DBE39A872ull },
+    { 0xCE5D73FF402D98E3ull, 0xFB0A3D212DC8128Full },
+    { 0x80FA687F881C7F8Eull, 0x7CE66634BC9D0B99ull },
+    { 0xA139029F6A239F72ull, 0x1C1FFFC1EBC44E80ull },
+    { 0xC987434744AC874Eull, 0xA327FFB266B56220ull },
+    { 0xFBE9141915D7A922ull, 0x4BF1FF9F0062BAA8ull },
+    { 0x9D71AC8FADA6C9B5ull, 0x6F773FC3603DB4A9ull },
+    { 0xC4CE17B399107C22ull, 0xCB550FB4384D21D3ull },
+    { 0xF6019DA07F549B2Bull, 0x7E2A53A146606A48ull },
+    { 0x99C102844F94E0FBull, 0x2EDA7444CBFC426Dull },
+    { 0xC0314325637A1939ull, 0xFA911155FEFB5308ull },
+    { 0xF03D93EEBC589F88ull, 0x793555AB7EBA27CAull },
+    { 0x96267C7535B763B5ull, 0x4BC1558B2F3458DEull },
+    { 0xBBB01B9283253CA2ull, 0x9EB1AAEDFB016F16ull },
+    { 0xEA9C227723EE8BCBull, 0x465E15A979C1CADCull },
+    { 0x92A1958A7675175Full, 0x0BFACD89EC191EC9ull },
+    { 0xB749FAED14125D36ull, 0xCEF980EC671F667Bull },
+    { 0xE51C79A85916F484ull, 0x82B7E12780E7401Aull },
+    { 0x8F31CC0937AE58D2ull, 0xD1B2ECB8B0908810ull },
+    { 0xB2FE3F0B8599EF07ull, 0x861FA7E6DCB4AA15ull },
+    { 0xDFBDCECE67006AC9ull, 0x67A791E093E1D49Aull },
+    { 0x8BD6A141006042BDull, 0xE0C8BB2C5C6D24E0ull },
+    { 0xAECC49914078536Dull, 0x58FAE9F773886E18ull },
+    { 0xDA7F5BF590966848ull, 0xAF39A475506A899Eull },
+    { 0x888F99797A5E012Dull, 0x6D8406C952429603ull },
+    { 0xAAB37FD7D8F58178ull, 0xC8E5087BA6D33B83ull },
+    { 0xD5605FCDCF32E1D6ull, 0xFB1E4A9A90880A64ull },
+    { 0x855C3BE0A17FCD26ull, 0x5CF2EEA09A55067Full },
+    { 0xA6B34AD8C9DFC06Full, 0xF42FAA48C0EA481Eull },
+    { 0xD0601D8EFC57B08Bull, 0xF13B94DAF124DA26ull },
+    { 0x823C12795DB6CE57ull, 0x76C53D08D6B70858ull },
+    { 0xA2CB1717B52481EDull, 0x54768C4B0C64CA6Eull },
+    { 0xCB7DDCDDA26DA268ull, 0xA9942F5DCF7DFD09ull },
+    { 0xFE5D54150B090B02ull, 0xD3F93B35435D7C4Cull },
+    { 0x9EFA548D26E5A6E1ull, 0xC47BC5014A1A6DAFull },
+    { 0xC6B8E9B0709F109Aull, 0x359AB6419CA1091Bull },
+    { 0xF867241C8CC6D4C0ull, 0xC30163D203C94B62ull },
+    { 0x9B407691D7FC44F8ull, 0x79E0DE63425DCF1Dull },
+    { 0xC21094364DFB5636ull, 0x985915FC12F542E4ull },
+    { 0xF294B943E17A2BC4ull, 0x3E6F5B7B17B2939Dull },
+    { 0x979CF3CA6CEC5B5Aull, 0xA705992CEECF9C42ull },
+    { 0xBD8430BD08277231ull, 0x50C6FF782A838353ull },
+    { 0xECE53CEC4A314EBDull, 0xA4F8BF5635246428ull },
+    { 0x940F4613AE5ED136ull, 0x871B7795E136BE99ull },
+    { 0xB913179899F68584ull, 0x28E2557B59846E3Full },
+    { 0xE757DD7EC07426E5ull, 0x331AEADA2FE589CFull },
+    { 0x9096EA6F3848984Full, 0x3FF0D2C85DEF7621ull },
+    { 0xB4BCA50B065ABE63ull, 0x0FED077A756B53A9ull },
+    { 0xE1EBCE4DC7F16DFBull, 0xD3E8495912C62894ull },
+    { 0x8D3360F09CF6E4BDull, 0x64712DD7ABBBD95Cull },
+    { 0xB080392CC4349DECull, 0xBD8D794D96AACFB3ull },
+    { 0xDCA04777F541C567ull, 0xECF0D7A0FC5583A0ull },
+    { 0x89E42CAAF9491B60ull, 0xF41686C49DB57244ull },
+    { 0xAC5D37D5B79B6239ull, 0x311C2875C522CED5ull },
+    { 0xD77485CB25823AC7ull, 0x7D633293366B828Bull },
+    { 0x86A8D39EF77164BCull, 0xAE5DFF9C02033197ull },
+    { 0xA8530886B54DBDEBull, 0xD9F57F830283FDFCull },
+    { 0xD267CAA862A12D66ull, 0xD072DF63C324FD7Bull },
+    { 0x8380DEA93DA4BC60ull, 0x4247CB9E59F71E6Dull },
+    { 0xA46116538D0DEB78ull, 0x52D9BE85F074E608ull },
+    { 0xCD795BE870516656ull, 0x67902E276C921F8Bull },
+    { 0x806BD9714632DFF6ull, 0x00BA1CD8A3DB53B6ull },
+    { 0xA086CFCD97BF97F3ull, 0x80E8A40ECCD228A4ull },
+    { 0xC8A883C0FDAF7DF0ull, 0x6122CD128006B2CDull },
+    { 0xFAD2A4B13D1B5D6Cull, 0x796B805720085F81ull },
+    { 0x9CC3A6EEC6311A63ull, 0xCBE3303674053BB0ull },
+    { 0xC3F490AA77BD60FCull, 0xBEDBFC4411068A9Cull },
+    { 0xF4F1B4D515ACB93Bull, 0xEE92FB5515482D44ull },
+    { 0x991711052D8BF3C5ull, 0x751BDD152D4D1C4Aull },
+    { 0xBF5CD54678EEF0B6ull, 0xD262D45A78A0635Dull },
+    { 0xEF340A98172AACE4ull, 0x86FB897116C87C34ull },
+    { 0x9580869F0E7AAC0Eull, 0xD45D35E6AE3D4DA0ull },
+    { 0xBAE0A846D2195712ull, 0x8974836059CCA109ull },
+    { 0xE998D258869FACD7ull, 0x2BD1A438703FC94Bull },
+    { 0x91FF83775423CC06ull, 0x7B6306A34627DDCFull },
+    { 0xB67F6455292CBF08ull, 0x1A3BC84C17B1D542ull },
+    { 0xE41F3D6A7377EECAull, 0x20CABA5F1D9E4A93ull },
+    { 0x8E938662882AF53Eull, 0x547EB47B7282EE9Cull },
+    { 0xB23867FB2A35B28Dull, 0xE99E619A4F23AA43ull },
+    { 0xDEC681F9F4C31F31ull, 0x6405FA00E2EC94D4ull },
+    { 0x8B3C113C38F9F37Eull, 0xDE83BC408DD3DD04ull },
+    { 0xAE0B158B4738705Eull, 0x9624AB50B148D445ull },
+    { 0xD98DDAEE19068C76ull, 0x3BADD624DD9B0957ull },
+    { 0x87F8A8D4CFA417C9ull, 0xE54CA5D70A80E5D6ull },
+    { 0xA9F6D30A038D1DBCull, 0x5E9FCF4CCD211F4Cull },
+    { 0xD47487CC8470652Bull, 0x7647C3200069671Full },
+    { 0x84C8D4DFD2C63F3Bull, 0x29ECD9F40041E073ull },
+    { 0xA5FB0A17C777CF09ull, 0xF468107100525890ull },
+    { 0xCF79CC9DB955C2CCull, 0x7182148D4066EEB4ull },
+    { 0x81AC1FE293D599BFull, 0xC6F14CD848405530ull },
+    { 0xA21727DB38CB002Full, 0xB8ADA00E5A506A7Cull },
+    { 0xCA9CF1D206FDC03Bull, 0xA6D90811F0E4851Cull },
+    { 0xFD442E4688BD304Aull, 0x908F4A166D1DA663ull },
+    { 0x9E4A9CEC15763E2Eull, 0x9A598E4E043287FEull },
+    { 0xC5DD44271AD3CDBAull, 0x40EFF1E1853F29FDull },
+    { 0xF7549530E188C128ull, 0xD12BEE59E68EF47Cull },
+    { 0x9A94DD3E8CF578B9ull, 0x82BB74F8301958CEull },
+    { 0xC13A148E3032D6E7ull, 0xE36A52363C1FAF01ull },
+    { 0xF18899B1BC3F8CA1ull, 0xDC44E6C3CB279AC1ull },
+    { 0x96F5600F15A7B7E5ull, 0x29AB103A5EF8C0B9ull },
+    { 0xBCB2B812DB11A5DEull, 0x7415D448F6B6F0E7ull },
+    { 0xEBDF661791D60F56ull, 0x111B495B3464AD21ull },
+    { 0x936B9FCEBB25C995ull, 0xCAB10DD900BEEC34ull },
+    { 0xB84687C269EF3BFBull, 0x3D5D514F40EEA742ull },
+    { 0xE65829B3046B0AFAull, 0x0CB4A5A3112A5112ull },
+    { 0x8FF71A0FE2C2E6DCull, 0x47F0E785EABA72ABull },
+    { 0xB3F4E093DB73A093ull, 0x59ED216765690F56ull },
+    { 0xE0F218B8D25088B8ull, 0x306869C13EC3532Cull },
+    { 0x8C974F7383725573ull, 0x1E414218C73A13FBull },
+    { 0xAFBD2350644EEACFull, 0xE5D1929EF90898FAull },
+    { 0xDBAC6C247D62A583ull, 0xDF45F746B74ABF39ull },
+    { 0x894BC396CE5DA772ull, 0x6B8BBA8C328EB783ull },
+    { 0xAB9EB47C81F5114Full, 0x066EA92F3F326564ull },
+    { 0xD686619BA27255A2ull, 0xC80A537B0EFEFEBDull },
+    { 0x8613FD0145877585ull, 0xBD06742CE95F5F36ull },
+    { 0xA798FC4196E952E7ull, 0x2C48113823B73704ull },
+    { 0xD17F3B51FCA3A7A0ull, 0xF75A15862CA504C5ull },
+    { 0x82EF85133DE648C4ull, 0x9A984D73DBE722FBull },
+    { 0xA3AB66580D5FDAF5ull, 0xC13E60D0D2E0EBBAull },
+    { 0xCC963FEE10B7D1B3ull, 0x318DF905079926A8ull },
+    { 0xFFBBCFE994E5C61Full, 0xFDF17746497F7052ull },
+    { 0x9FD561F1FD0F9BD3ull, 0xFEB6EA8BEDEFA633ull },
+    { 0xC7CABA6E7C5382C8ull, 0xFE64A52EE96B8FC0ull },
+    { 0xF9BD690A1B68637Bull, 0x3DFDCE7AA3C673B0ull },
+    { 0x9C1661A651213E2Dull, 0x06BEA10CA65C084Eull },
+    { 0xC31BFA0FE5698DB8ull, 0x486E494FCFF30A62ull },
+    { 0xF3E2F893DEC3F126ull, 0x5A89DBA3C3EFCCFAull },
+    { 0x986DDB5C6B3A76B7ull, 0xF89629465A75E01Cull },
+    { 0xBE89523386091465ull, 0xF6BBB397F1135823ull },
+    { 0xEE2BA6C0678B597Full, 0x746AA07DED582E2Cull },
+    { 0x94DB483840B717EFull, 0xA8C2A44EB4571CDCull },
+    { 0xBA121A4650E4DDEBull, 0x92F34D62616CE413ull },
+    { 0xE896A0D7E51E1566ull, 0x77B020BAF9C81D17ull },
+    { 0x915E2486EF32CD60ull, 0x0ACE1474DC1D122Eull },
+    { 0xB5B5ADA8AAFF80B8ull, 0x0D819992132456BAull },
+    { 0xE3231912D5BF60E6ull, 0x10E1FFF697ED6C69ull },
+    { 0x8DF5EFABC5979C8Full, 0xCA8D3FFA1EF463C1ull },
+    { 0xB1736B96B6FD83B3ull, 0xBD308FF8A6B17CB2ull },
+    { 0xDDD0467C64BCE4A0ull, 0xAC7CB3F6D05DDBDEull },
+    { 0x8AA22C0DBEF60EE4ull, 0x6BCDF07A423AA96Bull },
+    { 0xAD4AB7112EB3929Dull, 0x86C16C98D2C953C6ull },
+    { 0xD89D64D57A607744ull, 0xE871C7BF077BA8B7ull },
+    { 0x87625F056C7C4A8Bull, 0x11471CD764AD4972ull },
+    { 0xA93AF6C6C79B5D2Dull, 0xD598E40D3DD89BCFull },
+    { 0xD389B47879823479ull, 0x4AFF1D108D4EC2C3ull },
+    { 0x843610CB4BF160CBull, 0xCEDF722A585139BAull },
+    { 0xA54394FE1EEDB8FEull, 0xC2974EB4EE658828ull },
+    { 0xCE947A3DA6A9273Eull, 0x733D226229FEEA32ull },
+    { 0x811CCC668829B887ull, 0x0806357D5A3F525Full },
+    { 0xA163FF802A3426A8ull, 0xCA07C2DCB0CF26F7ull },
+    { 0xC9BCFF6034C13052ull, 0xFC89B393DD02F0B5ull },
+    { 0xFC2C3F3841F17C67ull, 0xBBAC2078D443ACE2ull },
+    { 0x9D9BA7832936EDC0ull, 0xD54B944B84AA4C0Dull },
+    { 0xC5029163F384A931ull, 0x0A9E795E65D4DF11ull },
+    { 0xF64335BCF065D37Dull, 0x4D4617B5FF4A16D5ull },
+    { 0x99EA0196163FA42Eull, 0x504BCED1BF8E4E45ull },
+    { 0xC06481FB9BCF8D39ull, 0xE45EC2862F71E1D6ull },
+    { 0xF07DA27A82C37088ull, 0x5D767327BB4E5A4Cull },
+    { 0x964E858C91BA2655ull, 0x3A6A07F8D510F86Full },
+    { 0xBBE226EFB628AFEAull, 0x890489F70A55368Bull },
+    { 0xEADAB0ABA3B2DBE5ull, 0x2B45AC74CCEA842Eull },
+    { 0x92C8AE6B464FC96Full, 0x3B0B8BC90012929Dull },
+    { 0xB77ADA0617E3BBCBull, 0x09CE6EBB40173744ull },
+    { 0xE55990879DDCAABDull, 0xCC420A6A101D0515ull },
+    { 0x8F57FA54C2A9EAB6ull, 0x9FA946824A12232Dull },
+    { 0xB32DF8E9F3546564ull, 0x47939822DC96ABF9ull },
+    { 0xDFF9772470297EBDull, 0x59787E2B93BC56F7ull },
+    { 0x8BFBEA76C619EF36ull, 0x57EB4EDB3C55B65Aull },
+    { 0xAEFAE51477A06B03ull, 0xEDE622920B6B23F1ull },
+    { 0xDAB99E59958885C4ull, 0xE95FAB368E45ECEDull },
+    { 0x88B402F7FD75539Bull, 0x11DBCB0218EBB414ull },
+    { 0xAAE103B5FCD2A881ull, 0xD652BDC29F26A119ull },
+    { 0xD59944A37C0752A2ull, 0x4BE76D3346F0495Full },
+    { 0x857FCAE62D8493A5ull, 0x6F70A4400C562DDBull },
+    { 0xA6DFBD9FB8E5B88Eull, 0xCB4CCD500F6BB952ull },
+    { 0xD097AD07A71F26B2ull, 0x7E2000A41346A7A7ull },
+    { 0x825ECC24C873782Full, 0x8ED400668C0C28C8ull },
+    { 0xA2F67F2DFA90563Bull, 0x728900802F0F32FAull },
+    { 0xCBB41EF979346BCAull, 0x4F2B40A03AD2FFB9ull },
+    { 0xFEA126B7D78186BCull, 0xE2F610C84987BFA8ull },
+    { 0x9F24B832E6B0F436ull, 0x0DD9CA7D2DF4D7C9ull },
+    { 0xC6EDE63FA05D3143ull, 0x91503D1C79720DBBull },
+    { 0xF8A95FCF88747D94ull, 0x75A44C6397CE912Aull },
+    { 0x9B69DBE1B548CE7Cull, 0xC986AFBE3EE11ABAull },
+    { 0xC24452DA229B021Bull, 0xFBE85BADCE996168ull },
+    { 0xF2D56790AB41C2A2ull, 0xFAE27299423FB9C3ull },
+    { 0x97C560BA6B0919A5ull, 0xDCCD879FC967D41Aull },
+    { 0xBDB6B8E905CB600Full, 0x5400E987BBC1C920ull },
+    { 0xED246723473E3813ull, 0x290123E9AAB23B68ull },
+    { 0x9436C0760C86E30Bull, 0xF9A0B6720AAF6521ull },
+    { 0xB94470938FA89BCEull, 0xF808E40E8D5B3E69ull },
+    { 0xE7958CB87392C2C2ull, 0xB60B1D1230B20E04ull },
+    { 0x90BD77F3483BB9B9ull, 0xB1C6F22B5E6F48C2ull },
+    { 0xB4ECD5F01A4AA828ull, 0x1E38AEB6360B1AF3ull },
+    { 0xE2280B6C20DD5232ull, 0x25C6DA63C38DE1B0ull },
+    { 0x8D590723948A535Full, 0x579C487E5A38AD0Eull },
+    { 0xB0AF48EC79ACE837ull, 0x2D835A9DF0C6D851ull },
+    { 0xDCDB1B2798182244ull, 0xF8E431456CF88E65ull },
+    { 0x8A08F0F8BF0F156Bull, 0x1B8E9ECB641B58FFull },
+    { 0xAC8B2D36EED2DAC5ull, 0xE272467E3D222F3Full },
+    { 0xD7ADF884AA879177ull, 0x5B0ED81DCC6ABB0Full },
+    { 0x86CCBB52EA94BAEAull, 0x98E947129FC2B4E9ull },
+    { 0xA87FEA27A539E9A5ull, 0x3F2398D747B36224ull },
+    { 0xD29FE4B18E88640Eull, 0x8EEC7F0D19A03AADull },
+    { 0x83A3EEEEF9153E89ull, 0x1953CF68300424ACull },
+    { 0xA48CEAAAB75A8E2Bull, 0x5FA8C3423C052DD7ull },
+    { 0xCDB02555653131B6ull, 0x3792F412CB06794Dull },
+    { 0x808E17555F3EBF11ull, 0xE2BBD88BBEE40BD0ull },
+    { 0xA0B19D2AB70E6ED6ull, 0x5B6ACEAEAE9D0EC4ull },
+    { 0xC8DE047564D20A8Bull, 0xF245825A5A445275ull },
+    { 0xFB158592BE068D2Eull, 0xEED6E2F0F0D56712ull },
+    { 0x9CED737BB6C4183Dull, 0x55464DD69685606Bull },
+    { 0xC428D05AA4751E4Cull, 0xAA97E14C3C26B886ull },
+    { 0xF53304714D9265DFull, 0xD53DD99F4B3066A8ull },
+    { 0x993FE2C6D07B7FABull, 0xE546A8038EFE4029ull },
+    { 0xBF8FDB78849A5F96ull, 0xDE98520472BDD033ull },
+    { 0xEF73D256A5C0F77Cull, 0x963E66858F6D4440ull },
+    { 0x95A8637627989AADull, 0xDDE7001379A44AA8ull },
+    { 0xBB127C53B17EC159ull, 0x5560C018580D5D52ull },
+    { 0xE9D71B689DDE71AFull, 0xAAB8F01E6E10B4A6ull },
+    { 0x9226712162AB070Dull, 0xCAB3961304CA70E8ull },
+    { 0xB6B00D69BB55C8D1ull, 0x3D607B97C5FD0D22ull },
+    { 0xE45C10C42A2B3B05ull, 0x8CB89A7DB77C506Aull },
+    { 0x8EB98A7A9A5B04E3ull, 0x77F3608E92ADB242ull },
+    { 0xB267ED1940F1C61Cull, 0x55F038B237591ED3ull },
+    { 0xDF01E85F912E37A3ull, 0x6B6C46DEC52F6688ull },
+    { 0x8B61313BBABCE2C6ull, 0x2323AC4B3B3DA015ull },
+    { 0xAE397D8AA96C1B77ull, 0xABEC975E0A0D081Aull },
+    { 0xD9C7DCED53C72255ull, 0x96E7BD358C904A21ull },
+    { 0x881CEA14545C7575ull, 0x7E50D64177DA2E54ull },
+    { 0xAA242499697392D2ull, 0xDDE50BD1D5D0B9E9ull },
+    { 0xD4AD2DBFC3D07787ull, 0x955E4EC64B44E864ull },
+    { 0x84EC3C97DA624AB4ull, 0xBD5AF13BEF0B113Eull },
+    { 0xA6274BBDD0FADD61ull, 0xECB1AD8AEACDD58Eull },
+    { 0xCFB11EAD453994BAull, 0x67DE18EDA5814AF2ull },
+    { 0x81CEB32C4B43FCF4ull, 0x80EACF948770CED7ull },
+    { 0xA2425FF75E14FC31ull, 0xA1258379A94D028Dull },
+    { 0xCAD2F7F5359A3B3Eull, 0x096EE45813A04330ull },
+    { 0xFD87B5F28300CA0Dull, 0x8BCA9D6E188853FCull },
+    { 0x9E74D1B791E07E48ull, 0x775EA264CF55347Eull },
+    { 0xC612062576589DDAull, 0x95364AFE032A819Eull },
+    { 0xF79687AED3EEC551ull, 0x3A83DDBD83F52205ull },
+    { 0x9ABE14CD44753B52ull, 0xC4926A9672793543ull },
+    { 0xC16D9A0095928A27ull, 0x75B7053C0F178294ull },
+    { 0xF1C90080BAF72CB1ull, 0x5324C68B12DD6339ull },
+    { 0x971DA05074DA7BEEull, 0xD3F6FC16EBCA5E04ull },
+    { 0xBCE5086492111AEAull, 0x88F4BB1CA6BCF585ull },
+    { 0xEC1E4A7DB69561A5ull, 0x2B31E9E3D06C32E6ull },
+    { 0x9392EE8E921D5D07ull, 0x3AFF322E62439FD0ull },
+    { 0xB877AA3236A4B449ull, 0x09BEFEB9FAD487C3ull },
+    { 0xE69594BEC44DE15Bull, 0x4C2EBE687989A9B4ull },
+    { 0x901D7CF73AB0ACD9ull, 0x0F9D37014BF60A11ull },
+    { 0xB424DC35095CD80Full, 0x538484C19EF38C95ull },
+    { 0xE12E13424BB40E13ull, 0x2865A5F206B06FBAull },
+    { 0x8CBCCC096F5088CBull, 0xF93F87B7442E45D4ull },
+    { 0xAFEBFF0BCB24AAFEull, 0xF78F69A51539D749ull },
+    { 0xDBE6FECEBDEDD5BEull, 0xB573440E5A884D1Cull },
+    { 0x89705F4136B4A597ull, 0x31680A88F8953031ull },
+    { 0xABCC77118461CEFCull, 0xFDC20D2B36BA7C3Eull },
+    { 0xD6BF94D5E57A42BCull, 0x3D32907604691B4Dull },
+    { 0x8637BD05AF6C69B5ull, 0xA63F9A49C2C1B110ull },
+    { 0xA7C5AC471B478423ull, 0x0FCF80DC33721D54ull },
+    { 0xD1B71758E219652Bull, 0xD3C36113404EA4A9ull },
+    { 0x83126E978D4FDF3Bull, 0x645A1CAC083126EAull },
+    { 0xA3D70A3D70A3D70Aull, 0x3D70A3D70A3D70A4ull },
+    { 0xCCCCCCCCCCCCCCCCull, 0xCCCCCCCCCCCCCCCDull },
+    { 0x8000000000000000ull, 0x0000000000000000ull },
+    { 0xA000000000000000ull, 0x0000000000000000ull },
+    { 0xC800000000000000ull, 0x0000000000000000ull },
+    { 0xFA00000000000000ull, 0x0000000000000000ull },
+    { 0x9C40000000000000ull, 0x0000000000000000ull },
+    { 0xC350000000000000ull, 0x0000000000000000ull },
+    { 0xF424000000000000ull, 0x0000000000000000ull },
+    { 0x9896800000000000ull, 0x0000000000000000ull },
+    { 0xBEBC200000000000ull, 0x0000000000000000ull },
+    { 0xEE6B280000000000ull, 0x0000000000000000ull },
+    { 0x9502F90000000000ull, 0x0000000000000000ull },
+    { 0xBA43B74000000000ull, 0x0000000000000000ull },
+    { 0xE8D4A51000000000ull, 0x0000000000000000ull },
+    { 0x9184E72A00000000ull, 0x0000000000000000ull },
+    { 0xB5E620F480000000ull, 0x0000000000000000ull },
+    { 0xE35FA931A0000000ull, 0x0000000000000000ull },
+    { 0x8E1BC9BF04000000ull, 0x0000000000000000ull },
+    { 0xB1A2BC2EC5000000ull, 0x0000000000000000ull },
+    { 0xDE0B6B3A76400000ull, 0x0000000000000000ull },
+    { 0x8AC7230489E80000ull, 0x0000000000000000ull },
+    { 0xAD78EBC5AC620000ull, 0x0000000000000000ull },
+    { 0xD8D726B7177A8000ull, 0x0000000000000000ull },
+    { 0x878678326EAC9000ull, 0x0000000000000000ull },
+    { 0xA968163F0A57B400ull, 0x0000000000000000ull },
+    { 0xD3C21BCECCEDA100ull, 0x0000000000000000ull },
+    { 0x84595161401484A0ull, 0x0000000000000000ull },
+    { 0xA56FA5B99019A5C8ull, 0x0000000000000000ull },
+    { 0xCECB8F27F4200F3Aull, 0x0000000000000000ull },
+    { 0x813F3978F8940984ull, 0x4000000000000000ull },
+    { 0xA18F07D736B90BE5ull, 0x5000000000000000ull },
+    { 0xC9F2C9CD04674EDEull, 0xA400000000000000ull },
+    { 0xFC6F7C4045812296ull, 0x4D00000000000000ull },
+    { 0x9DC5ADA82B70B59Dull, 0xF020000000000000ull },
+    { 0xC5371912364CE305ull, 0x6C28000000000000ull },
+    { 0xF684DF56C3E01BC6ull, 0xC732000000000000ull },
+    { 0x9A130B963A6C115Cull, 0x3C7F400000000000ull },
+    { 0xC097CE7BC90715B3ull, 0x4B9F100000000000ull },
+    { 0xF0BDC21ABB48DB20ull, 0x1E86D40000000000ull },
+    { 0x96769950B50D88F4ull, 0x1314448000000000ull },
+    { 0xBC143FA4E250EB31ull, 0x17D955A000000000ull },
+    { 0xEB194F8E1AE525FDull, 0x5DCFAB0800000000ull },
+    { 0x92EFD1B8D0CF37BEull, 0x5AA1CAE500000000ull },
+    { 0xB7ABC627050305ADull, 0xF14A3D9E40000000ull },
+    { 0xE596B7B0C643C719ull, 0x6D9CCD05D0000000ull },
+    { 0x8F7E32CE7BEA5C6Full, 0xE4820023A2000000ull },
+    { 0xB35DBF821AE4F38Bull, 0xDDA2802C8A800000ull },
+    { 0xE0352F62A19E306Eull, 0xD50B2037AD200000ull },
+    { 0x8C213D9DA502DE45ull, 0x4526F422CC340000ull },
+    { 0xAF298D050E4395D6ull, 0x9670B12B7F410000ull },
+    { 0xDAF3F04651D47B4Cull, 0x3C0CDD765F114000ull },
+    { 0x88D8762BF324CD0Full, 0xA5880A69FB6AC800ull },
+    { 0xAB0E93B6EFEE0053ull, 0x8EEA0D047A457A00ull },
+    { 0xD5D238A4ABE98068ull, 0x72A4904598D6D880ull },
+    { 0x85A36366EB71F041ull, 0x47A6DA2B7F864750ull },
+    { 0xA70C3C40A64E6C51ull, 0x999090B65F67D924ull },
+    { 0xD0CF4B50CFE20765ull, 0xFFF4B4E3F741CF6Dull },
+    { 0x82818F1281ED449Full, 0xBFF8F10E7A8921A4ull },
+    { 0xA321F2D7226895C7ull, 0xAFF72D52192B6A0Dull },
+    { 0xCBEA6F8CEB02BB39ull, 0x9BF4F8A69F764490ull },
+    { 0xFEE50B7025C36A08ull, 0x02F236D04753D5B4ull },
+    { 0x9F4F2726179A2245ull, 0x01D762422C946590ull },
+    { 0xC722F0EF9D80AAD6ull, 0x424D3AD2B7B97EF5ull },
+    { 0xF8EBAD2B84E0D58Bull, 0xD2E0898765A7DEB2ull },
+    { 0x9B934C3B330C8577ull, 0x63CC55F49F88EB2Full },
+    { 0xC2781F49FFCFA6D5ull, 0x3CBF6B71C76B25FBull },
+    { 0xF316271C7FC3908Aull, 0x8BEF464E3945EF7Aull },
+    { 0x97EDD871CFDA3A56ull, 0x97758BF0E3CBB5ACull },
+    { 0xBDE94E8E43D0C8ECull, 0x3D52EEED1CBEA317ull },
+    { 0xED63A231D4C4FB27ull, 0x4CA7AAA863EE4BDDull },
+    { 0x945E455F24FB1CF8ull, 0x8FE8CAA93E74EF6Aull },
+    { 0xB975D6B6EE39E436ull, 0xB3E2FD538E122B44ull },
+    { 0xE7D34C64A9C85D44ull, 0x60DBBCA87196B616ull },
+    { 0x90E40FBEEA1D3A4Aull, 0xBC8955E946FE31CDull },
+    { 0xB51D13AEA4A488DDull, 0x6BABAB6398BDBE41ull },
+    { 0xE264589A4DCDAB14ull, 0xC696963C7EED2DD1ull },
+    { 0x8D7EB76070A08AECull, 0xFC1E1DE5CF543CA2ull },
+    { 0xB0DE65388CC8ADA8ull, 0x3B25A55F43294BCBull },
+    { 0xDD15FE86AFFAD912ull, 0x49EF0EB713F39EBEull },
+    { 0x8A2DBF142DFCC7ABull, 0x6E3569326C784337ull },
+    { 0xACB92ED9397BF996ull, 0x49C2C37F07965404ull },
+    { 0xD7E77A8F87DAF7FBull, 0xDC33745EC97BE906ull },
+    { 0x86F0AC99B4E8DAFDull, 0x69A028BB3DED71A3ull },
+    { 0xA8ACD7C0222311BCull, 0xC40832EA0D68CE0Cull },
+    { 0xD2D80DB02AABD62Bull, 0xF50A3FA490C30190ull },
+    { 0x83C7088E1AAB65DBull, 0x792667C6DA79E0FAull },
+    { 0xA4B8CAB1A1563F52ull, 0x577001B891185938ull },
+    { 0xCDE6FD5E09ABCF26ull, 0xED4C0226B55E6F86ull },
+    { 0x80B05E5AC60B6178ull, 0x544F8158315B05B4ull },
+    { 0xA0DC75F1778E39D6ull, 0x696361AE3DB1C721ull },
+    { 0xC913936DD571C84Cull, 0x03BC3A19CD1E38E9ull },
+    { 0xFB5878494ACE3A5Full, 0x04AB48A04065C723ull },
+    { 0x9D174B2DCEC0E47Bull, 0x62EB0D64283F9C76ull },
+    { 0xC45D1DF942711D9Aull, 0x3BA5D0BD324F8394ull },
+    { 0xF5746577930D6500ull, 0xCA8F44EC7EE36479ull },
+    { 0x9968BF6ABBE85F20ull, 0x7E998B13CF4E1ECBull },
+    { 0xBFC2EF456AE276E8ull, 0x9E3FEDD8C321A67Eull },
+    { 0xEFB3AB16C59B14A2ull, 0xC5CFE94EF3EA101Eull },
+    { 0x95D04AEE3B80ECE5ull, 0xBBA1F1D158724A12ull },
+    { 0xBB445DA9CA61281Full, 0x2A8A6E45AE8EDC97ull },
+    { 0xEA1575143CF97226ull, 0xF52D09D71A3293BDull },
+    { 0x924D692CA61BE758ull, 0x593C2626705F9C56ull },
+    { 0xB6E0C377CFA2E12Eull, 0x6F8B2FB00C77836Cull },
+    { 0xE498F455C38B997Aull, 0x0B6DFB9C0F956447ull },
+    { 0x8EDF98B59A373FECull, 0x4724BD4189BD5EACull },
+    { 0xB2977EE300C50FE7ull, 0x58EDEC91EC2CB657ull },
+    { 0xDF3D5E9BC0F653E1ull, 0x2F2967B66737E3EDull },
+    { 0x8B865B215899F46Cull, 0xBD79E0D20082EE74ull },
+    { 0xAE67F1E9AEC07187ull, 0xECD8590680A3AA11ull },
+    { 0xDA01EE641A708DE9ull, 0xE80E6F4820CC9495ull },
+    { 0x884134FE908658B2ull, 0x3109058D147FDCDDull },
+    { 0xAA51823E34A7EEDEull, 0xBD4B46F0599FD415ull },
+    { 0xD4E5E2CDC1D1EA96ull, 0x6C9E18AC7007C91Aull },
+    { 0x850FADC09923329Eull, 0x03E2CF6BC604DDB0ull },
+    { 0xA6539930BF6BFF45ull, 0x84DB8346B786151Cull },
+    { 0xCFE87F7CEF46FF16ull, 0xE612641865679A63ull },
+    { 0x81F14FAE158C5F6Eull, 0x4FCB7E8F3F60C07Eull },
+    { 0xA26DA3999AEF7749ull, 0xE3BE5E330F38F09Dull },
+    { 0xCB090C8001AB551Cull, 0x5CADF5BFD3072CC5ull },
+    { 0xFDCB4FA002162A63ull, 0x73D9732FC7C8F7F6ull },
+    { 0x9E9F11C4014DDA7Eull, 0x2867E7FDDCDD9AFAull },
+    { 0xC646D63501A1511Dull, 0xB281E1FD541501B8ull },
+    { 0xF7D88BC24209A565ull, 0x1F225A7CA91A4226ull },
+    { 0x9AE757596946075Full, 0x3375788DE9B06958ull },
+    { 0xC1A12D2FC3978937ull, 0x0052D6B1641C83AEull },
+    { 0xF209787BB47D6B84ull, 0xC0678C5DBD23A49Aull },
+    { 0x9745EB4D50CE6332ull, 0xF840B7BA963646E0ull },
+    { 0xBD176620A501FBFFull, 0xB650E5A93BC3D898ull },
+    { 0xEC5D3FA8CE427AFFull, 0xA3E51F138AB4CEBEull },
+    { 0x93BA47C980E98CDFull, 0xC66F336C36B10137ull },
+    { 0xB8A8D9BBE123F017ull, 0xB80B0047445D4184ull },
+    { 0xE6D3102AD96CEC1Dull, 0xA60DC059157491E5ull },
+    { 0x9043EA1AC7E41392ull, 0x87C89837AD68DB2Full },
+    { 0xB454E4A179DD1877ull, 0x29BABE4598C311FBull },
+    { 0xE16A1DC9D8545E94ull, 0xF4296DD6FEF3D67Aull },
+    { 0x8CE2529E2734BB1Dull, 0x1899E4A65F58660Cull },
+    { 0xB01AE745B101E9E4ull, 0x5EC05DCFF72E7F8Full },
+    { 0xDC21A1171D42645Dull, 0x76707543F4FA1F73ull },
+    { 0x899504AE72497EBAull, 0x6A06494A791C53A8ull },
+    { 0xABFA45DA0EDBDE69ull, 0x0487DB9D17636892ull },
+    { 0xD6F8D7509292D603ull, 0x45A9D2845D3C42B6ull },
+    { 0x865B86925B9BC5C2ull, 0x0B8A2392BA45A9B2ull },
+    { 0xA7F26836F282B732ull, 0x8E6CAC7768D7141Eull },
+    { 0xD1EF0244AF2364FFull, 0x3207D795430CD926ull },
+    { 0x8335616AED761F1Full, 0x7F44E6BD49E807B8ull },
+    { 0xA402B9C5A8D3A6E7ull, 0x5F16206C9C6209A6ull },
+    { 0xCD036837130890A1ull, 0x36DBA887C37A8C0Full },
+    { 0x802221226BE55A64ull, 0xC2494954DA2C9789ull },
+    { 0xA02AA96B06DEB0FDull, 0xF2DB9BAA10B7BD6Cull },
+    { 0xC83553C5C8965D3Dull, 0x6F92829494E5ACC7ull },
+    { 0xFA42A8B73ABBF48Cull, 0xCB772339BA1F17F9ull },
+    { 0x9C69A97284B578D7ull, 0xFF2A760414536EFBull },
+    { 0xC38413CF25E2D70Dull, 0xFEF5138519684ABAull },
+    { 0xF46518C2EF5B8CD1ull, 0x7EB258665FC25D69ull },
+    { 0x98BF2F79D5993802ull, 0xEF2F773FFBD97A61ull },
+    { 0xBEEEFB584AFF8603ull, 0xAAFB550FFACFD8FAull },
+    { 0xEEAABA2E5DBF6784ull, 0x95BA2A53F983CF38ull },
+    { 0x952AB45CFA97A0B2ull, 0xDD945A747BF26183ull },
+    { 0xBA756174393D88DFull, 0x94F971119AEEF9E4ull },
+    { 0xE912B9D1478CEB17ull, 0x7A37CD5601AAB85Dull },
+    { 0x91ABB422CCB812EEull, 0xAC62E055C10AB33Aull },
+    { 0xB616A12B7FE617AAull, 0x577B986B314D6009ull },
+    { 0xE39C49765FDF9D94ull, 0xED5A7E85FDA0B80Bull },
+    { 0x8E41ADE9FBEBC27Dull, 0x14588F13BE847307ull },
+    { 0xB1D219647AE6B31Cull, 0x596EB2D8AE258FC8ull },
+    { 0xDE469FBD99A05FE3ull, 0x6FCA5F8ED9AEF3BBull },
+    { 0x8AEC23D680043BEEull, 0x25DE7BB9480D5854ull },
+    { 0xADA72CCC20054AE9ull, 0xAF561AA79A10AE6Aull },
+    { 0xD910F7FF28069DA4ull, 0x1B2BA1518094DA04ull },
+    { 0x87AA9AFF79042286ull, 0x90FB44D2F05D0842ull },
+    { 0xA99541BF57452B28ull, 0x353A1607AC744A53ull },
+    { 0xD3FA922F2D1675F2ull, 0x42889B8997915CE8ull },
+    { 0x847C9B5D7C2E09B7ull, 0x69956135FEBADA11ull },
+    { 0xA59BC234DB398C25ull, 0x43FAB9837E699095ull },
+    { 0xCF02B2C21207EF2Eull, 0x94F967E45E03F4BBull },
+    { 0x8161AFB94B44F57Dull, 0x1D1BE0EEBAC278F5ull },
+    { 0xA1BA1BA79E1632DCull, 0x6462D92A69731732ull },
+    { 0xCA28A291859BBF93ull, 0x7D7B8F7503CFDCFEull },
+    { 0xFCB2CB35E702AF78ull, 0x5CDA735244C3D43Eull },
+    { 0x9DEFBF01B061ADABull, 0x3A0888136AFA64A7ull },
+    { 0xC56BAEC21C7A1916ull, 0x088AAA1845B8FDD0ull },
+    { 0xF6C69A72A3989F5Bull, 0x8AAD549E57273D45ull },
+    { 0x9A3C2087A63F6399ull, 0x36AC54E2F678864Bull },
+    { 0xC0CB28A98FCF3C7Full, 0x84576A1BB416A7DDull },
+    { 0xF0FDF2D3F3C30B9Full, 0x656D44A2A11C51D5ull },
+    { 0x969EB7C47859E743ull, 0x9F644AE5A4B1B325ull },
+    { 0xBC4665B596706114ull, 0x873D5D9F0DDE1FEEull },
+    { 0xEB57FF22FC0C7959ull, 0xA90CB506D155A7EAull },
+    { 0x9316FF75DD87CBD8ull, 0x09A7F12442D588F2ull },
+    { 0xB7DCBF5354E9BECEull, 0x0C11ED6D538AEB2Full },
+    { 0xE5D3EF282A242E81ull, 0x8F1668C8A86DA5FAull },
+    { 0x8FA475791A569D10ull, 0xF96E017D694487BCull },
+    { 0xB38D92D760EC4455ull, 0x37C981DCC395A9ACull },
+    { 0xE070F78D3927556Aull, 0x85BBE253F47B1417ull },
+    { 0x8C469AB843B89562ull, 0x93956D7478CCEC8Eull },
+    { 0xAF58416654A6BABBull, 0x387AC8D1970027B2ull },
+    { 0xDB2E51BFE9D0696Aull, 0x06997B05FCC0319Eull },
+    { 0x88FCF317F22241E2ull, 0x441FECE3BDF81F03ull },
+    { 0xAB3C2FDDEEAAD25Aull, 0xD527E81CAD7626C3ull },
+    { 0xD60B3BD56A5586F1ull, 0x8A71E223D8D3B074ull },
+    { 0x85C7056562757456ull, 0xF6872D5667844E49ull },
+    { 0xA738C6BEBB12D16Cull, 0xB428F8AC016561DBull },
+    { 0xD106F86E69D785C7ull, 0xE13336D701BEBA52ull },
+    { 0x82A45B450226B39Cull, 0xECC0024661173473ull },
+    { 0xA34D721642B06084ull, 0x27F002D7F95D0190ull },
+    { 0xCC20CE9BD35C78A5ull, 0x31EC038DF7B441F4ull },
+    { 0xFF290242C83396CEull, 0x7E67047175A15271ull },
+    { 0x9F79A169BD203E41ull, 0x0F0062C6E984D386ull },
+    { 0xC75809C42C684DD1ull, 0x52C07B78A3E60868ull },
+    { 0xF92E0C3537826145ull, 0xA7709A56CCDF8A82ull },
+    { 0x9BBCC7A142B17CCBull, 0x88A66076400BB691ull },
+    { 0xC2ABF989935DDBFEull, 0x6ACFF893D00EA435ull },
+    { 0xF356F7EBF83552FEull, 0x0583F6B8C4124D43ull },
+    { 0x98165AF37B2153DEull, 0xC3727A337A8B704Aull },
+    { 0xBE1BF1B059E9A8D6ull, 0x744F18C0592E4C5Cull },
+    { 0xEDA2EE1C7064130Cull, 0x1162DEF06F79DF73ull },
+    { 0x9485D4D1C63E8BE7ull, 0x8ADDCB5645AC2BA8ull },
+    { 0xB9A74A0637CE2EE1ull, 0x6D953E2BD7173692ull },
+    { 0xE8111C87C5C1BA99ull, 0xC8FA8DB6CCDD0437ull },
+    { 0x910AB1D4DB9914A0ull, 0x1D9C9892400A22A2ull },
+    { 0xB54D5E4A127F59C8ull, 0x2503BEB6D00CAB4Bull },
+    { 0xE2A0B5DC971F303Aull, 0x2E44AE64840FD61Dull },
+    { 0x8DA471A9DE737E24ull, 0x5CEAECFED289E5D2ull },
+    { 0xB10D8E1456105DADull, 0x7425A83E872C5F47ull },
+    { 0xDD50F1996B947518ull, 0xD12F124E28F77719ull },
+    { 0x8A5296FFE33CC92Full, 0x82BD6B70D99AAA6Full },
+    { 0xACE73CBFDC0BFB7Bull, 0x636CC64D1001550Bull },
+    { 0xD8210BEFD30EFA5Aull, 0x3C47F7E05401AA4Eull },
+    { 0x8714A775E3E95C78ull, 0x65ACFAEC34810A71ull },
+    { 0xA8D9D1535CE3B396ull, 0x7F1839A741A14D0Dull },
+    { 0xD31045A8341CA07Cull, 0x1EDE48111209A050ull },
+    { 0x83EA2B892091E44Dull, 0x934AED0AAB460432ull },
+    { 0xA4E4B66B68B65D60ull, 0xF81DA84D5617853Full },
+    { 0xCE1DE40642E3F4B9ull, 0x36251260AB9D668Eull },
+    { 0x80D2AE83E9CE78F3ull, 0xC1D72B7C6B426019ull },
+    { 0xA1075A24E4421730ull, 0xB24CF65B8612F81Full },
+    { 0xC94930AE1D529CFCull, 0xDEE033F26797B627ull },
+    { 0xFB9B7CD9A4A7443Cull, 0x169840EF017DA3B1ull },
+    { 0x9D412E0806E88AA5ull, 0x8E1F289560EE864Eull },
+    { 0xC491798A08A2AD4Eull, 0xF1A6F2BAB92A27E2ull },
+    { 0xF5B5D7EC8ACB58A2ull, 0xAE10AF696774B1DBull },
+    { 0x9991A6F3D6BF1765ull, 0xACCA6DA1E0A8EF29ull },
+    { 0xBFF610B0CC6EDD3Full, 0x17FD090A58D32AF3ull },
+    { 0xEFF394DCFF8A948Eull, 0xDDFC4B4CEF07F5B0ull },
+    { 0x95F83D0A1FB69CD9ull, 0x4ABDAF101564F98Eull },
+    { 0xBB764C4CA7A4440Full, 0x9D6D1AD41ABE37F1ull },
+    { 0xEA53DF5FD18D5513ull, 0x84C86189216DC5EDull },
+    { 0x92746B9BE2F8552Cull, 0x32FD3CF5B4E49BB4ull },
+    { 0xB7118682DBB66A77ull, 0x3FBC8C33221DC2A1ull },
+    { 0xE4D5E82392A40515ull, 0x0FABAF3FEAA5334Aull },
+    { 0x8F05B1163BA6832Dull, 0x29CB4D87F2A7400Eull },
+    { 0xB2C71D5BCA9023F8ull, 0x743E20E9EF511012ull },
+    { 0xDF78E4B2BD342CF6ull, 0x914DA9246B255416ull },
+    { 0x8BAB8EEFB6409C1Aull, 0x1AD089B6C2F7548Eull },
+    { 0xAE9672ABA3D0C320ull, 0xA184AC2473B529B1ull },
+    { 0xDA3C0F568CC4F3E8ull, 0xC9E5D72D90A2741Eull },
+    { 0x8865899617FB1871ull, 0x7E2FA67C7A658892ull },
+    { 0xAA7EEBFB9DF9DE8Dull, 0xDDBB901B98FEEAB7ull },
+    { 0xD51EA6FA85785631ull, 0x552A74227F3EA565ull },
+    { 0x8533285C936B35DEull, 0xD53A88958F87275Full },
+    { 0xA67FF273B8460356ull, 0x8A892ABAF368F137ull },
+    { 0xD01FEF10A657842Cull, 0x2D2B7569B0432D85ull },
+    { 0x8213F56A67F6B29Bull, 0x9C3B29620E29FC73ull },
+    { 0xA298F2C501F45F42ull, 0x8349F3BA91B47B8Full },
+    { 0xCB3F2F7642717713ull, 0x241C70A936219A73ull },
+    { 0xFE0EFB53D30DD4D7ull, 0xED238CD383AA0110ull },
+    { 0x9EC95D1463E8A506ull, 0xF4363804324A40AAull },
+    { 0xC67BB4597CE2CE48ull, 0xB143C6053EDCD0D5ull },
+    { 0xF81AA16FDC1B81DAull, 0xDD94B7868E94050Aull },
+    { 0x9B10A4E5E9913128ull, 0xCA7CF2B4191C8326ull },
+    { 0xC1D4CE1F63F57D72ull, 0xFD1C2F611F63A3F0ull },
+    { 0xF24A01A73CF2DCCFull, 0xBC633B39673C8CECull },
+    { 0x976E41088617CA01ull, 0xD5BE0503E085D813ull },
+    { 0xBD49D14AA79DBC82ull, 0x4B2D8644D8A74E18ull },
+    { 0xEC9C459D51852BA2ull, 0xDDF8E7D60ED1219Eull },
+    { 0x93E1AB8252F33B45ull, 0xCABB90E5C942B503ull },
+    { 0xB8DA1662E7B00A17ull, 0x3D6A751F3B936243ull },
+    { 0xE7109BFBA19C0C9Dull, 0x0CC512670A783AD4ull },
+    { 0x906A617D450187E2ull, 0x27FB2B80668B24C5ull },
+    { 0xB484F9DC9641E9DAull, 0xB1F9F660802DEDF6ull },
+    { 0xE1A63853BBD26451ull, 0x5E7873F8A0396973ull },
+    { 0x8D07E33455637EB2ull, 0xDB0B487B6423E1E8ull },
+    { 0xB049DC016ABC5E5Full, 0x91CE1A9A3D2CDA62ull },
+    { 0xDC5C5301C56B75F7ull, 0x7641A140CC7810FBull },
+    { 0x89B9B3E11B6329BAull, 0xA9E904C87FCB0A9Dull },
+    { 0xAC2820D9623BF429ull, 0x546345FA9FBDCD44ull },
+    { 0xD732290FBACAF133ull, 0xA97C177947AD4095ull },
+    { 0x867F59A9D4BED6C0ull, 0x49ED8EABCCCC485Dull },
+    { 0xA81F301449EE8C70ull, 0x5C68F256BFFF5A74ull },
+    { 0xD226FC195C6A2F8Cull, 0x73832EEC6FFF3111ull },
+    { 0x83585D8FD9C25DB7ull, 0xC831FD53C5FF7EABull },
+    { 0xA42E74F3D032F525ull, 0xBA3E7CA8B77F5E55ull },
+    { 0xCD3A1230C43FB26Full, 0x28CE1BD2E55F35EBull },
+    { 0x80444B5E7AA7CF85ull, 0x7980D163CF5B81B3ull },
+    { 0xA0555E361951C366ull, 0xD7E105BCC332621Full },
+    { 0xC86AB5C39FA63440ull, 0x8DD9472BF3FEFAA7ull },
+    { 0xFA856334878FC150ull, 0xB14F98F6F0FEB951ull },
+    { 0x9C935E00D4B9D8D2ull, 0x6ED1BF9A569F33D3ull },
+    { 0xC3B8358109E84F07ull, 0x0A862F80EC4700C8ull },
+    { 0xF4A642E14C6262C8ull, 0xCD27BB612758C0FAull },
+    { 0x98E7E9CCCFBD7DBDull, 0x8038D51CB897789Cull },
+    { 0xBF21E44003ACDD2Cull, 0xE0470A63E6BD56C3ull },
+    { 0xEEEA5D5004981478ull, 0x1858CCFCE06CAC74ull },
+    { 0x95527A5202DF0CCBull, 0x0F37801E0C43EBC8ull },
+    { 0xBAA718E68396CFFDull, 0xD30560258F54E6BAull },
+    { 0xE950DF20247C83FDull, 0x47C6B82EF32A2069ull },
+    { 0x91D28B7416CDD27Eull, 0x4CDC331D57FA5441ull },
+    { 0xB6472E511C81471Dull, 0xE0133FE4ADF8E952ull },
+    { 0xE3D8F9E563A198E5ull, 0x58180FDDD97723A6ull },
+    { 0x8E679C2F5E44FF8Full, 0x570F09EAA7EA7648ull },
+};
+
+/// Exact powers of ten of the Clinger fast path.
+inline constexpr double pow10_f64[23] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+/// Layout of the binary formats.
+template <typename Float>
+struct float_binary_format
+{
+    static constexpr bool is_double = std::is_same_v<Float, double>;
+
+    static constexpr int mantissa_bits = is_double ? 52 : 23;
+    static constexpr int exponent_bias = is_double ? 1023 : 127;
+    static constexpr int infinite_exponent = is_double ? 0x7FF : 0xFF;
+
+    // w * 10^q is zero below and infinite above for any 19 digit w
+    static constexpr int min_power10 = is_double ? -342 : -64;
+    static constexpr int max_power10 = is_double ? 308 : 38;
+
+    // 5^q fits the product exactly, so that a tie is a real one
+    static constexpr int min_round_to_even = is_double ? -4 : -17;
+    static constexpr int max_round_to_even = is_double ? 23 : 10;
+
+    // w and 10^q are exact floating point values
+    static constexpr int max_fast_power10 = is_double ? 22 : 10;
+    static constexpr std::uint64_t max_fast_mantissa = std::uint64_t(2) << mantissa_bits;
+};
+
+/// Mantissa without the hidden bit and biased exponent of a binary float.
+struct binary_float
+{
+    std::uint64_t mantissa;
+    int exponent;
+
+    bool operator==(const binary_float &other) const STR_NOEXCEPT
+    {
+        return mantissa == other.mantissa && exponent == other.exponent;
+    }
+
+    bool operator!=(const binary_float &other) const STR_NOEXCEPT
+    {
+        return !(*this == other);
+    }
+};
+
+/// Rounds w * 10^q to the nearest binary float with the Eisel-Lemire algorithm.
+/// The truncated 128 bit product is always enough to decide (Mushtak and Lemire, 2022).
+template <typename Float>
+inline binary_float eisel_lemire(int q, std::uint64_t w) STR_NOEXCEPT
+{
+    using format = float_binary_format<Float>;
+
+    if (w == 0 || q < format::min_power10)
+        return { 0, 0 };
+
+    if (q > format::max_power10)
+        return { 0, format::infinite_exponent };
+
+    auto lz = static_cast<int>(63 - bsr64(w));
+    w <<= lz;
+
+    // the second half of 5^q only matters when the bits below the mantissa are all ones
+    auto &pow5 = pow5_128[q - pow5_128_min];
+    auto product = umul128(w, pow5[0]);
+
+    constexpr std::uint64_t precision_mask = ~std::uint64_t(0) >> (format::mantissa_bits + 3);
+    if ((product.high & precision_mask) == precision_mask)
+    {
+        auto second = umul128(w, pow5[1]);
+        product.low += second.high;
+        if (second.high > product.low)
+            product.high++;
+    }
+
+    auto upperbit = static_cast<int>(product.high >> 63);
+    auto shift = upperbit + 64 - format::mantissa_bits - 3;
+
+    // one bit more than the mantissa for rounding, floor(q * log2(10)) + 63 is the exponent of 10^q
+    binary_float answer;
+    answer.mantissa = product.high >> shift;
+    answer.exponent = (((152170 + 65536) * q) >> 16) + 63 + upperbit - lz + format::exponent_bias;
+
+    if (answer.exponent <= 0)
+    {
+        // subnormal, shifted down to the minimum exponent first
+        if (-answer.exponent + 1 >= 64)
+            return { 0, 0 };
+
+        answer.mantissa >>= -answer.exponent + 1;
+        answer.mantissa += answer.mantissa & 1;
+        answer.mantissa >>= 1;
+
+        // rounding up may carry into the smallest normal
+        answer.exponent = answer.mantissa < (std::uint64_t(1) << format::mantissa_bits) ? 0 : 1;
+        answer.mantissa &= ~(std::uint64_t(1) << format::mantissa_bits);
+        return answer;
+    }
+
+    // exactly halfway, round down to even
+    if (product.low <= 1 && q >= format::min_round_to_even && q <= format::max_round_to_even &&
+        (answer.mantissa & 3) == 1 && (answer.mantissa << shift) == product.high)
+    {
+        answer.mantissa &= ~std::uint64_t(1);
+    }
+
+    answer.mantissa += answer.mantissa & 1;
+    answer.mantissa >>= 1;
+    if (answer.mantissa >= (std::uint64_t(2) << format::mantissa_bits))
+    {
+        answer.mantissa = std::uint64_t(1) << format::mantissa_bits;
+        answer.exponent++;
+    }
+
+    answer.mantissa &= ~(std::uint64_t(1) << format::mantissa_bits);
+    if (answer.exponent >= format::infinite_exponent)
+        return { 0, format::infinite_exponent };
+
+    return answer;
+}
+
+/// Decimal digits 0.d0d1d2... * 10^point for the slow path of parsing, when more than
+/// 19 digits are too close to a halfway point. Digits past the capacity are only
+/// remembered as truncated.
+struct big_decimal
+{
+    static constexpr int max_digits = 800;
+
+    std::uint8_t digits[max_digits];
+    int count;
+    int point;
+    bool truncated;
+};
+
+inline void trim_big_decimal(big_decimal &dec) STR_NOEXCEPT
+{
+    while (dec.count > 0 && dec.digits[dec.count - 1] == 0)
+        dec.count--;
+
+    if (dec.count == 0)
+        dec.point = 0;
+}
+
+/// Multiplies by 2^shift, shift <= 60.
+inline void shift_big_decimal_left(big_decimal &dec, unsigned shift) STR_NOEXCEPT
+{
+    // 2^shift adds at most shift * log10(2) + 1 digits
+    auto added = static_cast<int>((shift * 1233) >> 12) + 1;
+    auto read = dec.count;
+    auto write = dec.count + added;
+
+    std::uint64_t n = 0;
+    auto put = [&]()
+    {
+        auto quotient = n / 10;
+        auto digit = static_cast<std::uint8_t>(n - 10 * quotient);
+        if (--write < big_decimal::max_digits)
+            dec.digits[write] = digit;
+        else if (digit != 0)
+            dec.truncated = true;
+        n = quotient;
+    };
+
+    while (read > 0)
+    {
+        n += std::uint64_t(dec.digits[--read]) << shift;
+        put();
+    }
+
+    while (n > 0)
+        put();
+
+    auto count = std::min(dec.count + added, big_decimal::max_digits) - write;
+    std::memmove(dec.digits, dec.digits + write, static_cast<std::size_t>(count));
+    dec.count = count;
+    dec.point += added - write;
+    trim_big_decimal(dec);
+}
+
+/// Divides by 2^shift, shift <= 60.
+inline void shift_big_decimal_right(big_decimal &dec, unsigned shift) STR_NOEXCEPT
+{
+    int read = 0;
+    int write = 0;
+
+    // enough leading digits for the first quotient digit
+    std::uint64_t n = 0;
+    for (; (n >> shift) == 0; read++)
+    {
+        if (read >= dec.count)
+        {
+            if (n == 0)
+            {
+                dec.count = 0;
+                return;
+            }
+
+            while ((n >> shift) == 0)
+            {
+                n *= 10;
+                read++;
+            }
+            break;
+        }
+
+        n = n * 10 + dec.digits[read];
+    }
+
+    dec.point -= read - 1;
+
+    auto mask = (std::uint64_t(1) << shift) - 1;
+    for (; read < dec.count; read++)
+    {
+        dec.digits[write++] = static_cast<std::uint8_t>(n >> shift);
+        n = (n & mask) * 10 + dec.digits[read];
+    }
+
+    while (n > 0)
+    {
+        auto digit = static_cast<std::uint8_t>(n >> shift);
+        if (write < big_decimal::max_digits)
+            dec.digits[write++] = digit;
+        else if (digit != 0)
+            dec.truncated = true;
+        n = (n & mask) * 10;
+    }
+
+    dec.count = write;
+    trim_big_decimal(dec);
+}
+
+/// Multiplies by 2^shift, or divides for a negative shift.
+inline void shift_big_decimal(big_decimal &dec, int shift) STR_NOEXCEPT
+{
+    constexpr int max_shift = 60;
+
+    for (; shift > max_shift; shift -= max_shift)
+        shift_big_decimal_left(dec, max_shift);
+    for (; shift < -max_shift; shift += max_shift)
+        shift_big_decimal_right(dec, max_shift);
+
+    if (shift > 0)
+        shift_big_decimal_left(dec, static_cast<unsigned>(shift));
+    else if (shift < 0)
+        shift_big_decimal_right(dec, static_cast<unsigned>(-shift));
+}
+
+/// Returns the integer part rounded half to even, dec.point must be <= 19.
+inline std::uint64_t round_big_decimal(const big_decimal &dec) STR_NOEXCEPT
+{
+    std::uint64_t n = 0;
+    int i = 0;
+    for (; i < dec.point && i < dec.count; i++)
+        n = n * 10 + dec.digits[i];
+    for (; i < dec.point; i++)
+        n *= 10;
+
+    if (dec.point >= 0 && dec.point < dec.count)
+    {
+        auto digit = dec.digits[dec.point];
+        bool tie = digit == 5 && dec.point + 1 == dec.count && !dec.truncated;
+        if (tie ? dec.point > 0 && dec.digits[dec.point - 1] % 2 : digit >= 5)
+            n++;
+    }
+
+    return n;
+}
+
+/// Converts to the nearest binary float with Nigel Tao's simple decimal conversion,
+/// shifting by powers of two until the value is in [1/2, 1).
+template <typename Float>
+inline binary_float big_decimal_to_binary(big_decimal &dec) STR_NOEXCEPT
+{
+    using format = float_binary_format<Float>;
+
+    constexpr binary_float zero{ 0, 0 };
+    constexpr binary_float infinity{ 0, format::infinite_exponent };
+
+    if (dec.count == 0 || dec.point < -330)
+        return zero;
+
+    if (dec.point > 310)
+        return infinity;
+
+    // the largest shifts which keep a digit before the point, by count of digits
+    constexpr int shifts[9] = { 1, 3, 6, 9, 13, 16, 19, 23, 26 };
+
+    int exponent = 0;
+    while (dec.point > 0)
+    {
+        auto shift = dec.point < 9 ? shifts[dec.point] : 27;
+        shift_big_decimal(dec, -shift);
+        exponent += shift;
+    }
+
+    while (dec.point < 0 || (dec.point == 0 && dec.digits[0] < 5))
+    {
+        auto shift = -dec.point < 9 ? shifts[-dec.point] : 27;
+        shift_big_decimal(dec, shift);
+        exponent -= shift;
+    }
+
+    // [1/2, 1) to [1, 2), then down to the subnormals
+    exponent--;
+    if (exponent < 1 - format::exponent_bias)
+    {
+        auto shift = 1 - format::exponent_bias - exponent;
+        shift_big_decimal(dec, -shift);
+        exponent += shift;
+    }
+
+    if (exponent + format::exponent_bias >= format::infinite_exponent)
+        return infinity;
+
+    shift_big_decimal(dec, format::mantissa_bits + 1);
+    auto mantissa = round_big_decimal(dec);
+    if (mantissa == std::uint64_t(2) << format::mantissa_bits)
+    {
+        mantissa >>= 1;
+        if (++exponent + format::exponent_bias >= format::infinite_exponent)
+            return infinity;
+    }
+
+    auto hidden = std::uint64_t(1) << format::mantissa_bits;
+    auto biased = (mantissa & hidden) ? exponent + format::exponent_bias : 0;
+    return { mantissa & (hidden - 1), biased };
+}
+
+/// Collects the digits of [int_first, int_last) and [frac_first, frac_last) times 10^exponent.
+template <typename Char>
+inline void to_big_decimal(big_decimal &dec, const Char *int_first, const Char *int_last,
+                           const Char *frac_first, const Char *frac_last, std::int64_t exponent) STR_NOEXCEPT
+{
+    dec.count = 0;
+    dec.point = 0;
+    dec.truncated = false;
+
+    auto push = [&](const Char *it)
+    {
+        auto digit = static_cast<std::uint8_t>(static_cast<std::uint32_t>(*it) - '0');
+        if (dec.count < big_decimal::max_digits)
+            dec.digits[dec.count++] = digit;
+        else if (digit != 0)
+            dec.truncated = true;
+    };
+
+    for (auto it = int_first; it != int_last; ++it)
+    {
+        if (dec.count == 0 && *it == static_cast<Char>('0'))
+            continue;
+
+        push(it);
+        dec.point++;
+    }
+
+    for (auto it = frac_first; it != frac_last; ++it)
+    {
+        if (dec.count == 0 && *it == static_cast<Char>('0'))
+            dec.point--;
+        else
+            push(it);
+    }
+
+    dec.point = static_cast<int>(std::clamp<std::int64_t>(dec.point + exponent, -100000, 100000));
+    trim_big_decimal(dec);
+}
+
+/// Returns the length of word at it, compared case insensitively, or 0 if it is not there.
+template <typename Char>
+inline std::size_t match_word(const Char *it, const Char *end, const char *word) STR_NOEXCEPT
+{
+    std::size_t size = 0;
+    for (; word[size]; size++)
+    {
+        if (it + size == end || (static_cast<std::uint32_t>(it[size]) | 0x20) != static_cast<std::uint32_t>(word[size]))
+            return 0;
+    }
+
+    return size;
+}
+
+/// Parses a decimal floating point number from [ptr, ptr + count): an optional '-',
+/// digits with an optional '.' and an optional exponent, or inf, infinity, nan and nan(chars).
+/// The result is correctly rounded, out of range values are reported like integers.
+/// Does not depend on the locale or on a null terminator.
+template <typename Float, typename Char>
+inline parse_result<Float> convert_str_to_float(const Char *ptr, std::size_t count) STR_NOEXCEPT
+{
+    static_assert(std::is_same_v<Float, float> || std::is_same_v<Float, double>, "Float must be float or double");
+
+    using format = float_binary_format<Float>;
+    using UInt = std::conditional_t<format::is_double, std::uint64_t, std::uint32_t>;
+
+    parse_result<Float> result{ Float(), 0, std::errc::invalid_argument };
+
+    auto it = ptr;
+    auto end = ptr + count;
+
+    bool negative = it != end && *it == static_cast<Char>('-');
+    if (negative)
+        ++it;
+
+    // the digits wrap around past 19, they are read again below
+    std::uint64_t w = 0;
+    auto read_digits = [&]()
+    {
+#ifndef STR_BIG_ENDIAN
+        if constexpr (sizeof(Char) == 1)
+        {
+            while (end - it >= 8)
+            {
+                std::uint64_t chunk;
+                std::memcpy(&chunk, it, sizeof(chunk));
+                if (!is_eight_digits(chunk))
+                    break;
+
+                w = w * 100000000 + parse_eight_digits(chunk);
+                it += 8;
+            }
+        }
+#endif
+        for (; it != end; ++it)
+        {
+            auto digit = static_cast<std::uint32_t>(*it) - '0';
+            if (digit >= 10)
+                break;
+
+            w = w * 10 + digit;
+        }
+    };
+
+    auto int_first = it;
+    read_digits();
+    auto int_last = it;
+
+    auto frac_first = it;
+    auto frac_last = it;
+    if (it != end && *it == static_cast<Char>('.'))
+    {
+        frac_first = ++it;
+        read_digits();
+        frac_last = it;
+    }
+
+    auto digits = (int_last - int_first) + (frac_last - frac_first);
+    if (digits == 0)
+    {
+        // a lone '.' or a special value
+        it = int_first;
+        if (auto size = match_word(it, end, "inf"))
+        {
+            it += size;
+            if (auto rest = match_word(it, end, "inity"))
+                it += rest;
+
+            result.value = negative ? -std::numeric_limits<Float>::infinity() : std::numeric_limits<Float>::infinity();
+        }
+        else if (auto size = match_word(it, end, "nan"))
+        {
+            it += size;
+
+            // nan(n-char-sequence)
+            if (it != end && *it == static_cast<Char>('('))
+            {
+                auto close = it + 1;
+                while (close != end && (digit_value(*close) < 36 || *close == static_cast<Char>('_')))
+                    ++close;
+
+                if (close != end && *close == static_cast<Char>(')'))
+                    it = close + 1;
+            }
+
+            result.value = negative ? -std::numeric_limits<Float>::quiet_NaN() : std::numeric_limits<Float>::quiet_NaN();
+        }
+        else
+        {
+            return result;
+        }
+
+        result.count = static_cast<std::size_t>(it - ptr);
+        result.ec = std::errc();
+        return result;
+    }
+
+    // the exponent is only taken with at least one digit, it saturates
+    std::int64_t explicit_exponent = 0;
+    if (it != end && (*it == static_cast<Char>('e') || *it == static_cast<Char>('E')))
+    {
+        auto exp_it = it + 1;
+        bool exp_negative = false;
+        if (exp_it != end && (*exp_it == static_cast<Char>('-') || *exp_it == static_cast<Char>('+')))
+            exp_negative = *exp_it++ == static_cast<Char>('-');
+
+        if (exp_it != end && static_cast<std::uint32_t>(*exp_it) - '0' < 10)
+        {
+            for (; exp_it != end && static_cast<std::uint32_t>(*exp_it) - '0' < 10; ++exp_it)
+            {
+                if (explicit_exponent < 0x10000000)
+                    explicit_exponent = explicit_exponent * 10 + (static_cast<std::uint32_t>(*exp_it) - '0');
+            }
+
+            explicit_exponent = exp_negative ? -explicit_exponent : explicit_exponent;
+            it = exp_it;
+        }
+    }
+
+    result.count = static_cast<std::size_t>(it - ptr);
+    auto exponent = explicit_exponent - (frac_last - frac_first);
+
+    // more than 19 significant digits, w is made of the first 19 ones
+    bool truncated = false;
+    if (digits > 19)
+    {
+        auto first = int_first;
+        for (; first != int_last && *first == static_cast<Char>('0'); first++)
+            digits--;
+
+        if (first == int_last)
+        {
+            for (first = frac_first; first != frac_last && *first == static_cast<Char>('0'); first++)
+                digits--;
+        }
+
+        if (digits > 19)
+        {
+            constexpr std::uint64_t min_nineteen_digits = 1000000000000000000;
+
+            truncated = true;
+            w = 0;
+
+            auto p = int_first;
+            for (; w < min_nineteen_digits && p != int_last; ++p)
+                w = w * 10 + (static_cast<std::uint32_t>(*p) - '0');
+
+            if (w >= min_nineteen_digits)
+            {
+                exponent = explicit_exponent + (int_last - p);
+            }
+            else
+            {
+                for (p = frac_first; w < min_nineteen_digits && p != frac_last; ++p)
+                    w = w * 10 + (static_cast<std::uint32_t>(*p) - '0');
+
+                exponent = explicit_exponent - (p - frac_first);
+            }
+        }
+    }
+
+    if (!truncated && exponent >= -format::max_fast_power10 && exponent <= format::max_fast_power10 &&
+        w <= format::max_fast_mantissa)
+    {
+        // Clinger's fast path, one correctly rounded operation on exact values
+        auto value = static_cast<Float>(w);
+        auto pow10 = static_cast<Float>(pow10_f64[exponent < 0 ? -exponent : exponent]);
+        value = exponent < 0 ? value / pow10 : value * pow10;
+
+        result.value = negative ? -value : value;
+        result.ec = std::errc();
+        return result;
+    }
+
+    auto q = static_cast<int>(std::clamp<std::int64_t>(exponent, format::min_power10 - 1, format::max_power10 + 1));
+    auto binary = eisel_lemire<Float>(q, w);
+
+    // the truncated digits may round either way
+    if (truncated && binary != eisel_lemire<Float>(q, w + 1))
+    {
+        big_decimal dec;
+        to_big_decimal(dec, int_first, int_last, frac_first, frac_last, explicit_exponent);
+        binary = big_decimal_to_binary<Float>(dec);
+    }
+
+    if (binary.exponent == format::infinite_exponent || (w != 0 && binary.mantissa == 0 && binary.exponent == 0))
+    {
+        result.ec = std::errc::result_out_of_range;
+        return result;
+    }
+
+    auto bits = static_cast<UInt>(binary.mantissa | (static_cast<std::uint64_t>(binary.exponent) << format::mantissa_bits));
+    bits |= static_cast<UInt>(negative) << (sizeof(UInt) * 8 - 1);
+    std::memcpy(&result.value, &bits, sizeof(bits));
+    result.ec = std::errc();
+    return result;
+}
+
+STR_NAMESPACE_DETAILS_END
+STR_NAMESPACE_MAIN_END
@@ -0,0 +1,94 @@
+#pragma once
+#include "common.hpp"
+#include "tweaks.hpp"
+#include <cstddef>
+#include <algorithm>
+
+STR_NAMESPACE_MAIN_BEGIN
+
+///////////////////////////////////////////////////////////////////
+// Growth Policies
+///////////////////////////////////////////////////////////////////
+// A growth policy decides the capacity to allocate when a string
+// needs room for at least `required` characters.
+//
+// struct policy
+// {
+//     template <typename Char, typename Size>
+//     static Size grow(Size capacity, Size required, Size max_size);
+// };
+
+/// Allocates exactly what is required, appending in a loop is O(n^2).
+struct growth_exact
+{
+    template <typename Char, typename Size>
+    STR_CONSTEXPR static Size grow(Size, Size required, Size) STR_NOEXCEPT
+    {
+        return required;
+    }
+};
+
+/// Multiplies the capacity by Num / Den, appending in a loop is amortized O(1).
+template <std::size_t Num, std::size_t Den>
+struct growth_geometric
+{
+    static_assert(Num > Den, "growth factor must be greater than 1");
+
+    template <typename Char, typename Size>
+    STR_CONSTEXPR static Size grow(Size capacity, Size required, Size max_size) STR_NOEXCEPT
+    {
+        // avoid overflowing when close to max_size
+        if (capacity >= max_size / Num)
+            return std::max(required, max_size);
+
+        return std::max(required, capacity * Num / Den);
+    }
+};
+
+using growth_1_5x = growth_geometric<3, 2>;
+using growth_2x = growth_geometric<2, 1>;
+
+/// Grows geometrically and rounds the allocation up to the size classes
+/// used by common malloc implementations, so the slack is never wasted.
+/// Classes are multiples of 16 bytes up to 128, then four per power of two.
+template <typename Geometric = growth_1_5x>
+struct growth_size_class
+{
+    template <typename Char, typename Size>
+    STR_CONSTEXPR static Size grow(Size capacity, Size required, Size max_size) STR_NOEXCEPT
+    {
+        Size cap = Geometric::template grow<Char, Size>(capacity, required, max_size);
+
+#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
+        Size bytes = (cap + 1) * sizeof(Char);
+#else
+        Size bytes = cap * sizeof(Char);
+#endif
+
+        Size rounded;
+        if (bytes <= 128)
+        {
+            rounded = (bytes + 15) & ~Size(15);
+        }
+        else
+        {
+            // spacing is a quarter of the highest power of two below bytes
+            Size spacing = 1;
+            while (spacing <= bytes / 8)
+                spacing <<= 1;
+
+            rounded = (bytes + spacing - 1) & ~(spacing - 1);
+        }
+
+#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
+        return std::min(max_size, std::max(cap, rounded / sizeof(Char) - 1));
+#else
+        return std::min(max_size, std::max(cap, rounded / sizeof(Char)));
+#endif
+    }
+};
+
+/// Policy used by basic_heapstr and basic_bufstr unless specified.
+using default_growth = growth_2x;
+
+STR_NAMESPACE_MAIN_END
@@ -1,17 +1,23 @@
 #pragma once
 #include "str.hpp"
+#include "allocator.hpp"
 
 STR_NAMESPACE_MAIN_BEGIN
 
-template <typename Char, typename CharTraits = std::char_traits<char>, typename Allocator = std::allocator<Char>>
-class basic_heapstr : public basic_str<Char, CharTraits, Allocator>
+template <typename Char, typename CharTraits = std::char_traits<Char>, typename Allocator = std::allocator<Char>,
+          typename GrowthPolicy = default_growth>
+class basic_heapstr : public basic_str_core<basic_heapstr<Char, CharTraits, Allocator, GrowthPolicy>,
+                                            Char, CharTraits, Allocator>
 {
-    using this_t = basic_heapstr<Char, CharTraits, Allocator>;
+    using this_t = basic_heapstr<Char, CharTraits, Allocator, GrowthPolicy>;
 
 public:
-    using base_t = basic_str<Char, CharTraits, Allocator>;
+    using base_t = basic_str_core<this_t, Char, CharTraits, Allocator>;
+    using growth_policy = GrowthPolicy;
     using value_type = typename base_t::value_type;
     using traits_type = typename base_t::traits_type;
+    using allocator_type = typename base_t::allocator_type;
+    using allocator_traits = typename base_t::allocator_traits;
     using size_type = typename base_t::size_type;
     using difference_type = typename base_t::difference_type;
     using reference = typename base_t::reference;
@@ -23,23 +29,57 @@ public:
     using reverse_iterator = typename base_t::reverse_iterator;
     using const_reverse_iterator = typename base_t::const_reverse_iterator;
 
+    using base_t::npos;
+    using base_t::operator=;
+    using base_t::resize;
+
+    friend base_t;
+
+    template <typename String>
+    friend class basic_str_adapter;
+
 public:
     //////////////////////////////////////////////////////////////////////
     // CONSTRUCTORS / DESTRUCTOR
     //////////////////////////////////////////////////////////////////////
 
-    STR_CONSTEXPR ~basic_heapstr() STR_NOEXCEPT = default;
-
     STR_CONSTEXPR basic_heapstr(const Allocator &alloc = Allocator())
         : alloc_{alloc} {}
 
-    template <typename OtherCharTraits, typename OtherAllocator>
-    STR_CONSTEXPR basic_heapstr(basic_heapstr<Char, OtherCharTraits, OtherAllocator> &&other,
-                                const Allocator &alloc = Allocator()) : alloc_{alloc}
+    STR_CONSTEXPR basic_heapstr(const basic_heapstr &other)
+        : alloc_{allocator_traits::select_on_container_copy_construction(other.alloc_)}
     {
-        std::swap(data_, other.data_);
-        std::swap(size_, other.size_);
-        std::swap(capacity_, other.capacity_);
+        this->append(other.data(), other.size());
+    }
+
+    STR_CONSTEXPR basic_heapstr(const basic_heapstr &other, const Allocator &alloc)
+        : alloc_{alloc}
+    {
+        this->append(other.data(), other.size());
+    }
+
+    STR_CONSTEXPR basic_heapstr(basic_heapstr &&other) STR_NOEXCEPT
+        : data_{other.data_}, size_{other.size_}, capacity_{other.capacity_}, alloc_{std::move(other.alloc_)}
+    {
+        other.data_ = nullptr;
+        other.size_ = 0;
+        other.capacity_ = 0;
+    }
+
+    /// Takes the buffer of other if alloc can free it, else copies the characters.
+    STR_CONSTEXPR basic_heapstr(basic_heapstr &&other, const Allocator &alloc)
+        : alloc_{alloc}
+    {
+        if constexpr (!allocator_traits::is_always_equal::value)
+        {
+            if (alloc_ != other.alloc_)
+            {
+                this->append(std::as_const(other).data(), other.size());
+                return;
+            }
+        }
+
+        swap_(other);
     }
 
     STR_CONSTEXPR basic_heapstr(size_type size, const Allocator &alloc = Allocator())
@@ -51,57 +91,116 @@ public:
     STR_CONSTEXPR basic_heapstr(value_type ch, size_type count, const Allocator &alloc = Allocator())
         : alloc_{alloc}
     {
-        append(ch, count);
+        this->append(ch, count);
     }
 
     STR_CONSTEXPR basic_heapstr(const value_type *s, const Allocator &alloc = Allocator())
         : alloc_{alloc}
     {
-        append(s);
+        this->append(s);
     }
     STR_CONSTEXPR basic_heapstr(const value_type *s, size_type count, const Allocator &alloc = Allocator())
         : alloc_{alloc}
     {
-        append(s, count);
+        this->append(s, count);
     }
 
     template <typename InputIt>
     STR_CONSTEXPR basic_heapstr(InputIt first, InputIt last, const Allocator &alloc = Allocator())
         : alloc_{alloc}
     {
-        append(first, last);
+        this->append(first, last);
     }
 
     STR_CONSTEXPR basic_heapstr(std::initializer_list<value_type> ilist, const Allocator &alloc = Allocator())
         : alloc_{alloc}
     {
-        append(ilist);
+        this->append(ilist);
     }
 
     template <typename StringLike>
     STR_CONSTEXPR basic_heapstr(const StringLike &str, size_type str_index = 0, const Allocator &alloc = Allocator())
         : alloc_{alloc}
     {
-        append(str, str_index, npos);
+        this->append(str, str_index, npos);
     }
 
     template <typename StringLike>
     STR_CONSTEXPR basic_heapstr(const StringLike &str, size_type str_index, size_type str_count = npos, const Allocator &alloc = Allocator())
         : alloc_{alloc}
     {
-        append(str, str_index, str_count);
+        this->append(str, str_index, str_count);
+    }
+
+    STR_CONSTEXPR ~basic_heapstr() STR_NOEXCEPT
+    {
+        if (data_)
+        {
+            deallocate_(data_, capacity_);
+        }
+    }
+
+    STR_CONSTEXPR basic_heapstr &operator=(const basic_heapstr &other)
+    {
+        if (this == &other)
+            return *this;
+
+        if constexpr (allocator_traits::propagate_on_container_copy_assignment::value)
+        {
+            if constexpr (!allocator_traits::is_always_equal::value)
+            {
+                // memory of this string cannot be freed with the allocator of other
+                if (alloc_ != other.alloc_)
+                {
+                    release_();
+                }
+            }
+
+            alloc_ = other.alloc_;
+        }
+
+        this->assign(other.data(), other.size());
+        return *this;
+    }
+
+    STR_CONSTEXPR basic_heapstr &operator=(basic_heapstr &&other) STR_NOEXCEPT_IF(
+        allocator_traits::propagate_on_container_move_assignment::value || allocator_traits::is_always_equal::value)
+    {
+        if (this == &other)
+            return *this;
+
+        if constexpr (!allocator_traits::propagate_on_container_move_assignment::value &&
+                      !allocator_traits::is_always_equal::value)
+        {
+            // memory of other cannot be freed with our allocator
+            if (alloc_ != other.alloc_)
+            {
+                this->assign(std::as_const(other).data(), other.size());
+                return *this;
+            }
+        }
+
+        release_();
+
+        if constexpr (allocator_traits::propagate_on_container_move_assignment::value)
+        {
+            alloc_ = std::move(other.alloc_);
+        }
+
+        swap_(other);
+        return *this;
     }
 
     //////////////////////////////////////////////////////////////////////
     // ELEMENT ACCESS
     //////////////////////////////////////////////////////////////////////
 
-    STR_CONSTEXPR pointer data() STR_NOEXCEPT override
+    STR_CONSTEXPR pointer data() STR_NOEXCEPT
     {
         return data_;
     }
 
-    STR_CONSTEXPR const_pointer data() const STR_NOEXCEPT override
+    STR_CONSTEXPR const_pointer data() const STR_NOEXCEPT
     {
         return data_;
     }
@@ -110,62 +209,90 @@ public:
     // CAPACITY
     //////////////////////////////////////////////////////////////////////
 
-    STR_CONSTEXPR size_type size() const STR_NOEXCEPT override
+    STR_CONSTEXPR size_type size() const STR_NOEXCEPT
     {
         return size_;
     }
 
-    STR_CONSTEXPR void set_size_(size_type size) STR_NOEXCEPT override
+    STR_CONSTEXPR size_type max_size() const STR_NOEXCEPT
     {
-        size_ = size;
+        return allocator_traits::max_size(alloc_);
+    }
+
+    STR_CONSTEXPR size_type capacity() const STR_NOEXCEPT
+    {
+        return capacity_;
     }
 
-    STR_CONSTEXPR size_type max_size() const STR_NOEXCEPT override
+    STR_CONSTEXPR allocator_type get_allocator() const STR_NOEXCEPT
     {
-        return alloc_.max_size();
+        return alloc_;
     }
 
-    STR_CONSTEXPR size_type capacity() const STR_NOEXCEPT override
+protected:
+    STR_CONSTEXPR void set_size_(size_type size) STR_NOEXCEPT
     {
-        return capacity_;
+        size_ = size;
     }
 
+    STR_CONSTEXPR size_type recommend_(size_type required) const STR_NOEXCEPT
+    {
+        return growth_policy::template grow<value_type, size_type>(capacity_, required, max_size());
+    }
+
+public:
     //////////////////////////////////////////////////////////////////////
     // OPERATIONS
     //////////////////////////////////////////////////////////////////////
 
-    STR_CONSTEXPR void resize(size_type cap, value_type ch) override
+    STR_CONSTEXPR void resize(size_type cap, value_type ch)
+    {
+        resize_(cap, &ch);
+    }
+
+protected:
+    /// Sets the capacity to cap without initializing the new characters.
+    STR_CONSTEXPR void reserve_(size_type cap)
+    {
+        resize_(cap, nullptr);
+    }
+
+    /// Sets the capacity to cap, the new characters are set to *fill unless it is null.
+    STR_CONSTEXPR void resize_(size_type cap, const value_type *fill)
     {
-        assert_length_(cap);
+        this->assert_length_(cap);
 
         if (capacity_ == cap)
             return;
 
+        if constexpr (details::has_reallocate<Allocator>::value && std::is_trivially_copyable_v<value_type>)
+        {
+            if (data_ && cap > 0)
+            {
+                reallocate_(cap, fill);
+                return;
+            }
+        }
+
         pointer ptr = nullptr;
         if (cap > 0)
         {
-
-#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
-            ptr = alloc_.allocate(cap + 1);
-#else
-            ptr = alloc_.allocate(cap);
-#endif
+            ptr = allocate_(cap);
             if (ptr == nullptr)
                 return;
 
-            if (cap < size_)
+            auto count = std::min(size_, cap);
+            traits_type::copy(ptr, data_, count);
+
+            if (fill)
             {
-                std::memcpy(ptr, data_, cap - 1);
+                traits_type::assign(ptr + count, cap - count, *fill);
+            }
 
 #ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
-                ptr[cap] = '\0';
+            ptr[count] = '\0';
+            ptr[cap] = '\0';
 #endif
-            }
-            else
-            {
-                std::memcpy(ptr, data_, size_);
-                std::memset(ptr + cap, ch, cap - size_);
-            }
         }
 
         // cache old data for exception safety
@@ -181,183 +308,198 @@ public:
         // an exception will have no effect now
         if (old_ptr)
         {
-            alloc_.deallocate(old_ptr, old_cap);
+            deallocate_(old_ptr, old_cap);
         }
     }
 
-protected:
-    pointer data_ = nullptr;
-    size_type size_ = 0;
-    size_type capacity_ = 0;
-    Allocator alloc_;
-};
-
-//////////////////////////////////////////////////////////////////////
-// operator +
-//////////////////////////////////////////////////////////////////////
+public:
+    /// Exchanges the contents with other. The allocators are exchanged if they propagate
+    /// on swap, else they must compare equal.
+    STR_CONSTEXPR void swap(basic_heapstr &other) STR_NOEXCEPT
+    {
+        if constexpr (allocator_traits::propagate_on_container_swap::value)
+        {
+            using std::swap;
+            swap(alloc_, other.alloc_);
+        }
 
-template <typename Char, typename CharTraits, typename Allocator, typename StringLike>
-basic_heapstr<Char, CharTraits, Allocator>
-operator+(const basic_heapstr<Char, CharTraits, Allocator> &lhs,
-          const StringLike &rhs)
-{
-    using lhstraits = strtraits<basic_heapstr<Char, CharTraits, Allocator>>;
-    using rhstraits = strtraits<StringLike>;
+        swap_(other);
+    }
 
-    static_assert(std::is_same_v<lhstraits::char_type, rhstraits::char_type>,
-                  "char_type must be same for both string types");
+protected:
+    /// Allocates at least cap characters, cap is raised to what the block can hold,
+    /// so the slack of the allocator size class is used before reallocating.
+    STR_CONSTEXPR pointer allocate_(size_type &cap)
+    {
+#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
+        auto result = details::allocate_at_least(alloc_, cap + 1);
+        cap = result.count - 1;
+#else
+        auto result = details::allocate_at_least(alloc_, cap);
+        cap = result.count;
+#endif
+        return result.ptr;
+    }
 
-    static_assert(std::is_same_v<lhstraits::char_traits, rhstraits::char_traits>,
-                  "char_traits must be same for both string types");
+    /// Resizes the buffer to at least cap characters through the allocator,
+    /// which may grow it in place or move the pages instead of copying them.
+    STR_CONSTEXPR void reallocate_(size_type cap, const value_type *fill)
+    {
+        auto old_cap = capacity_;
+#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
+        auto result = alloc_.reallocate(data_, old_cap + 1, cap + 1);
+        cap = result.count - 1;
+#else
+        auto result = alloc_.reallocate(data_, old_cap, cap);
+        cap = result.count;
+#endif
 
-    auto str = basic_heapstr<Char, CharTraits, Allocator>(
-        lhstraits::size(lhs) + rhstraits::size(rhs));
+        data_ = result.ptr;
+        capacity_ = cap;
+        size_ = std::min(size_, capacity_);
 
-    str.append(lhs);
-    str.append(rhstraits::data(rhs), rhstraits::size(rhs));
+        if (fill)
+        {
+            traits_type::assign(data_ + size_, cap - size_, *fill);
+        }
 
-    return str;
-}
+#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
+        data_[size_] = '\0';
+        data_[cap] = '\0';
+#endif
+    }
 
-template <typename Char, typename CharTraits, typename Allocator, typename StringLike>
-basic_heapstr<Char, CharTraits, Allocator>
-operator+(const StringLike &lhs,
-          const basic_heapstr<Char, CharTraits, Allocator> &rhs)
-{
-    using lhstraits = strtraits<StringLike>;
-    using rhstraits = strtraits<basic_heapstr<Char, CharTraits, Allocator>>;
+    STR_CONSTEXPR void deallocate_(pointer ptr, size_type cap) STR_NOEXCEPT
+    {
+#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
+        allocator_traits::deallocate(alloc_, ptr, cap + 1);
+#else
+        allocator_traits::deallocate(alloc_, ptr, cap);
+#endif
+    }
 
-    static_assert(std::is_same_v<lhstraits::char_type, rhstraits::char_type>,
-                  "char_type must be same for both string types");
+    /// Frees the buffer, the string is left empty.
+    STR_CONSTEXPR void release_() STR_NOEXCEPT
+    {
+        if (data_)
+        {
+            deallocate_(data_, capacity_);
+        }
 
-    static_assert(std::is_same_v<lhstraits::char_traits, rhstraits::char_traits>,
-                  "char_traits must be same for both string types");
+        data_ = nullptr;
+        size_ = 0;
+        capacity_ = 0;
+    }
 
-    static_assert(std::is_same_v<lhstraits::allocator_type, rhstraits::allocator_type>,
-                  "allocator_type must be same for both string types");
+    /// Exchanges the buffers, not the allocators.
+    STR_CONSTEXPR void swap_(basic_heapstr &other) STR_NOEXCEPT
+    {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
 
-    auto str = basic_heapstr<Char, CharTraits, Allocator>(
-        lhstraits::size(lhs) + rhstraits::size(rhs));
+protected:
+    pointer data_ = nullptr;
+    size_type size_ = 0;
+    size_type capacity_ = 0;
+    Allocator alloc_;
+};
 
-    str.append(lhstraits::data(lhs), lhstraits::size(lhs));
-    str.append(rhs);
+//////////////////////////////////////////////////////////////////////
+// operator +
+//////////////////////////////////////////////////////////////////////
 
-    return str;
-}
+STR_NAMESPACE_DETAILS_BEGIN
 
-template <typename Char, typename CharTraits, typename Allocator>
-basic_heapstr<Char, CharTraits, Allocator>
-operator+(const basic_heapstr<Char, CharTraits, Allocator> &lhs, const Char *rhs)
+template <typename T>
+struct is_heapstr : std::false_type
 {
-    auto lhslen = CharTraits::length(rhs);
-    auto str = basic_heapstr<Char, CharTraits, Allocator>(
-        lhs.size() + lhslen);
-
-    str.append(lhs);
-    str.append(rhs, lhslen);
-
-    return str;
-}
+};
 
-template <typename Char, typename CharTraits, typename Allocator>
-basic_heapstr<Char, CharTraits, Allocator>
-operator+(const basic_heapstr<Char, CharTraits, Allocator> &lhs, Char rhs)
+template <typename Char, typename CharTraits, typename Allocator, typename GrowthPolicy>
+struct is_heapstr<basic_heapstr<Char, CharTraits, Allocator, GrowthPolicy>> : std::true_type
 {
-    auto str = basic_heapstr<Char, CharTraits, Allocator>(
-        lhs.size() + 1);
-
-    str.append(lhs);
-    str.append(rhs);
+};
 
-    return str;
-}
+STR_NAMESPACE_DETAILS_END
 
-template <typename Char, typename CharTraits, typename Allocator>
-basic_heapstr<Char, CharTraits, Allocator>
-operator+(const Char *lhs, const basic_heapstr<Char, CharTraits, Allocator> &rhs)
+/// Concatenates lhs with a character, a null-terminated string or a string described by strtraits.
+/// No string is made: the result is an expression that is sized and written
+/// in a single allocation when it is assigned to or used to construct a string.
+template <typename Char, typename CharTraits, typename Allocator, typename GrowthPolicy, typename Part,
+          std::enable_if_t<details::is_concat_part_v<Part, Char> && !details::is_strconcat_v<Part>, int> = 0>
+STR_CONSTEXPR basic_strconcat<Char, CharTraits, basic_strview<Char, CharTraits>,
+                              details::concat_part_t<Part, Char, CharTraits>>
+operator+(const basic_heapstr<Char, CharTraits, Allocator, GrowthPolicy> &lhs, const Part &rhs)
 {
-    auto lhslen = CharTraits::length(lhs);
-    auto str = basic_heapstr<Char, CharTraits, Allocator>(
-        rhs.size() + lhslen);
-
-    str.append(lhs, lhslen);
-    str.append(rhs);
-
-    return str;
+    return { lhs, rhs };
 }
 
-template <typename Char, typename CharTraits, typename Allocator>
-basic_heapstr<Char, CharTraits, Allocator>
-operator+(Char lhs, const basic_heapstr<Char, CharTraits, Allocator> &rhs)
+template <typename Char, typename CharTraits, typename Allocator, typename GrowthPolicy, typename Part,
+          std::enable_if_t<details::is_concat_part_v<Part, Char> && !details::is_strconcat_v<Part> &&
+                               !details::is_heapstr<Part>::value,
+                           int> = 0>
+STR_CONSTEXPR basic_strconcat<Char, CharTraits, details::concat_part_t<Part, Char, CharTraits>,
+                              basic_strview<Char, CharTraits>>
+operator+(const Part &lhs, const basic_heapstr<Char, CharTraits, Allocator, GrowthPolicy> &rhs)
 {
-    auto str = basic_heapstr<Char, CharTraits, Allocator>(
-        rhs.size() + 1);
-
-    str.append(lhs);
-    str.append(rhs);
-
-    return str;
+    return { lhs, rhs };
 }
 
-template <typename Char, typename CharTraits, typename Allocator>
-basic_heapstr<Char, CharTraits, Allocator>
-operator+(basic_heapstr<Char, CharTraits, Allocator> &&lhs,
-          basic_heapstr<Char, CharTraits, Allocator> &&rhs)
+/// A temporary string is appended to in place, reusing its buffer.
+template <typename Char, typename CharTraits, typename Allocator, typename GrowthPolicy>
+basic_heapstr<Char, CharTraits, Allocator, GrowthPolicy>
+operator+(basic_heapstr<Char, CharTraits, Allocator, GrowthPolicy> &&lhs,
+          basic_heapstr<Char, CharTraits, Allocator, GrowthPolicy> &&rhs)
 {
     auto reqcap = lhs.size() + rhs.size();
 
     // if lhs dont have enough capacity but rhs has, move into rhs
     if (lhs.capacity() < reqcap && rhs.capacity() > reqcap)
     {
-        return std::move(str.insert(0, lhs));
+        return std::move(rhs.insert(0, lhs));
     }
 
     return std::move(lhs.append(rhs));
 }
 
-template <typename Char, typename CharTraits, typename Allocator>
-basic_heapstr<Char, CharTraits, Allocator>
-operator+(basic_heapstr<Char, CharTraits, Allocator> &&lhs,
-          const basic_str<Char, CharTraits, Allocator> &rhs)
-{
-    return std::move(lhs.append(rhs));
-}
-
-template <typename Char, typename CharTraits, typename Allocator>
-basic_heapstr<Char, CharTraits, Allocator>
-operator+(basic_heapstr<Char, CharTraits, Allocator> &&lhs, const Char *rhs)
-{
-    return std::move(lhs.append(rhs));
-}
-
-template <typename Char, typename CharTraits, typename Allocator>
-basic_heapstr<Char, CharTraits, Allocator>
-operator+(basic_heapstr<Char, CharTraits, Allocator> &&lhs, Char rhs)
+template <typename Char, typename CharTraits, typename Allocator, typename GrowthPolicy, typename Part,
+          std::enable_if_t<details::is_concat_part_v<Part, Char> && !details::is_strconcat_v<Part>, int> = 0>
+basic_heapstr<Char, CharTraits, Allocator, GrowthPolicy>
+operator+(basic_heapstr<Char, CharTraits, Allocator, GrowthPolicy> &&lhs, const Part &rhs)
 {
-    return std::move(lhs.append(rhs));
-}
-
-template <typename Char, typename CharTraits, typename Allocator>
-basic_heapstr<Char, CharTraits, Allocator>
-operator+(const basic_str<Char, CharTraits, Allocator> &lhs,
-          basic_heapstr<Char, CharTraits, Allocator> &&rhs)
-{
-    return std::move(rhs.insert(0, lhs));
+    if constexpr (std::is_same_v<Part, Char>)
+    {
+        return std::move(lhs.append(rhs));
+    }
+    else
+    {
+        return std::move(lhs.append(basic_strview<Char, CharTraits>(rhs)));
+    }
 }
 
-template <typename Char, typename CharTraits, typename Allocator>
-basic_heapstr<Char, CharTraits, Allocator>
-operator+(const Char *lhs, basic_heapstr<Char, CharTraits, Allocator> &&rhs)
+template <typename Char, typename CharTraits, typename Allocator, typename GrowthPolicy, typename Part,
+          std::enable_if_t<details::is_concat_part_v<Part, Char> && !details::is_strconcat_v<Part>, int> = 0>
+basic_heapstr<Char, CharTraits, Allocator, GrowthPolicy>
+operator+(const Part &lhs, basic_heapstr<Char, CharTraits, Allocator, GrowthPolicy> &&rhs)
 {
-    return std::move(rhs.insert(0, lhs));
+    if constexpr (std::is_same_v<Part, Char>)
+    {
+        return std::move(rhs.insert(0, lhs));
+    }
+    else
+    {
+        return std::move(rhs.insert(0, basic_strview<Char, CharTraits>(lhs)));
+    }
 }
 
-template <typename Char, typename CharTraits, typename Allocator>
-basic_heapstr<Char, CharTraits, Allocator>
-operator+(Char lhs, basic_heapstr<Char, CharTraits, Allocator> &&rhs)
+/// The buffer is on the heap, a string can move by its bytes if its allocator can.
+template <typename Char, typename CharTraits, typename Allocator, typename GrowthPolicy>
+struct is_trivially_relocatable<basic_heapstr<Char, CharTraits, Allocator, GrowthPolicy>>
+    : is_trivially_relocatable<Allocator>
 {
-    return std::move(rhs.insert(0, lhs));
-}
+};
 
 //////////////////////////////////////////////////////////////////////
 // typedefs
@@ -369,4 +511,18 @@ using u8heapstr = basic_heapstr<char8_t>;
 using u16heapstr = basic_heapstr<char16_t>;
 using u32heapstr = basic_heapstr<char32_t>;
 
+#ifdef STR_HAS_PMR
+namespace pmr
+{
+template <typename Char>
+using basic_heapstr = ::STR_NAMESPACE_MAIN::basic_heapstr<Char, std::char_traits<Char>, std::pmr::polymorphic_allocator<Char>>;
+
+using heapstr = basic_heapstr<char>;
+using wheapstr = basic_heapstr<wchar_t>;
+using u8heapstr = basic_heapstr<char8_t>;
+using u16heapstr = basic_heapstr<char16_t>;
+using u32heapstr = basic_heapstr<char32_t>;
+}
+#endif
+
 STR_NAMESPACE_MAIN_END
\ No newline at end of file
@@ -0,0 +1,239 @@
+#pragma once
+#include "common.hpp"
+#include "strview.hpp"
+#include "file.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#ifdef STR_HAS_MMAP
+#include <sys/mman.h>
+#endif
+
+STR_NAMESPACE_MAIN_BEGIN
+
+#ifdef STR_HAS_MMAP
+
+/// Expected access pattern of a mapping, forwarded to madvise().
+enum class mmap_access
+{
+    normal,
+    sequential, ///< read ahead aggressively, pages behind may be dropped early
+    random,     ///< no read ahead, each fault reads a single page
+};
+
+/// Read-only string mapped from a file. Opening costs a single mmap(), the
+/// content is read lazily by page faults and shared with the page cache, so a
+/// file of several GB is neither copied nor held twice in memory.
+/// It offers the read-only part of the string API like basic_strview,
+/// substr() returns views into the mapping which must not outlive it.
+/// @note the string is not null-terminated, the mapping ends with the file.
+template <typename Char, typename CharTraits = std::char_traits<Char>>
+class basic_mmapstr : private basic_strview<Char, CharTraits>
+{
+    using this_t = basic_mmapstr<Char, CharTraits>;
+
+public:
+    using view_type = basic_strview<Char, CharTraits>;
+    using value_type = typename view_type::value_type;
+    using traits_type = typename view_type::traits_type;
+    using size_type = typename view_type::size_type;
+    using difference_type = typename view_type::difference_type;
+    using reference = typename view_type::const_reference;
+    using const_reference = typename view_type::const_reference;
+    using pointer = typename view_type::const_pointer;
+    using const_pointer = typename view_type::const_pointer;
+    using iterator = typename view_type::const_iterator;
+    using const_iterator = typename view_type::const_iterator;
+    using reverse_iterator = typename view_type::const_reverse_iterator;
+    using const_reverse_iterator = typename view_type::const_reverse_iterator;
+
+    using view_type::npos;
+
+    using view_type::at;
+    using view_type::operator[];
+    using view_type::front;
+    using view_type::back;
+    using view_type::data;
+    using view_type::begin;
+    using view_type::cbegin;
+    using view_type::end;
+    using view_type::cend;
+    using view_type::rbegin;
+    using view_type::crbegin;
+    using view_type::rend;
+    using view_type::crend;
+    using view_type::size;
+    using view_type::length;
+    using view_type::max_size;
+    using view_type::empty;
+    using view_type::toindex;
+    using view_type::cit;
+    using view_type::crit;
+    using view_type::compare;
+    using view_type::starts_with;
+    using view_type::ends_with;
+    using view_type::contains;
+    using view_type::copy;
+    using view_type::substr;
+    using view_type::find;
+    using view_type::rfind;
+    using view_type::find_first_of;
+    using view_type::find_first_not_of;
+    using view_type::find_last_of;
+    using view_type::find_last_not_of;
+
+public:
+    //////////////////////////////////////////////////////////////////////
+    // CONSTRUCTORS / DESTRUCTOR
+    //////////////////////////////////////////////////////////////////////
+
+    basic_mmapstr() STR_NOEXCEPT = default;
+
+    /// Maps the file at path, throws std::system_error on failure.
+    /// An empty file gives an empty string without a mapping.
+    explicit basic_mmapstr(const char *path, mmap_access access = mmap_access::normal)
+    {
+        details::file_handle file(path);
+
+        struct stat st;
+        if (::fstat(file.fd, &st) != 0)
+            details::throw_file_error("fstat");
+
+        auto count = static_cast<size_type>(st.st_size) / sizeof(value_type);
+        if (count == 0)
+            return;
+
+        // the mapping stays valid once the descriptor is closed
+        auto bytes = count * sizeof(value_type);
+        auto ptr = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, file.fd, 0);
+        if (ptr == MAP_FAILED)
+            details::throw_file_error("mmap");
+
+        this->ptr_ = static_cast<const_pointer>(ptr);
+        this->size_ = count;
+        advise(access);
+    }
+
+    basic_mmapstr(const basic_mmapstr &) = delete;
+    basic_mmapstr &operator=(const basic_mmapstr &) = delete;
+
+    basic_mmapstr(basic_mmapstr &&other) STR_NOEXCEPT
+    {
+        swap(other);
+    }
+
+    basic_mmapstr &operator=(basic_mmapstr &&other) STR_NOEXCEPT
+    {
+        basic_mmapstr(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    ~basic_mmapstr()
+    {
+        if (this->ptr_)
+        {
+            ::munmap(const_cast<value_type *>(this->ptr_), this->size_ * sizeof(value_type));
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////
+    // MAPPING
+    //////////////////////////////////////////////////////////////////////
+
+    /// Returns a view of the whole mapping.
+    view_type view() const STR_NOEXCEPT
+    {
+        return *this;
+    }
+
+    /// Hints the access pattern of the characters [index, index+count).
+    void advise(mmap_access access, size_type index = 0, size_type count = npos) const STR_NOEXCEPT
+    {
+        int advice = MADV_NORMAL;
+        if (access == mmap_access::sequential)
+            advice = MADV_SEQUENTIAL;
+        else if (access == mmap_access::random)
+            advice = MADV_RANDOM;
+
+        madvise_(advice, index, count);
+    }
+
+    /// Starts reading the pages of the characters [index, index+count) in the
+    /// background, so that scanning them later does not wait on page faults.
+    void prefetch(size_type index = 0, size_type count = npos) const STR_NOEXCEPT
+    {
+        madvise_(MADV_WILLNEED, index, count);
+    }
+
+    void swap(basic_mmapstr &other) STR_NOEXCEPT
+    {
+        view_type::swap(other);
+    }
+
+protected:
+    /// Advice is only a hint, failures are ignored.
+    void madvise_(int advice, size_type index, size_type count) const STR_NOEXCEPT
+    {
+        if (index >= this->size_)
+            return;
+
+        static const auto page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+
+        // madvise() takes page aligned addresses
+        auto first = reinterpret_cast<std::uintptr_t>(this->ptr_ + index);
+        auto last = reinterpret_cast<std::uintptr_t>(this->ptr_ + index + std::min(this->size_ - index, count));
+        first &= ~static_cast<std::uintptr_t>(page_size - 1);
+
+        ::madvise(reinterpret_cast<void *>(first), last - first, advice);
+    }
+};
+
+//////////////////////////////////////////////////////////////////////
+// strtraits
+//////////////////////////////////////////////////////////////////////
+
+template <typename Char, typename CharTraits>
+class strtraits<basic_mmapstr<Char, CharTraits>>
+{
+public:
+    using string_type = basic_mmapstr<Char, CharTraits>;
+    using char_type = typename string_type::value_type;
+    using char_traits = typename string_type::traits_type;
+    using size_type = typename string_type::size_type;
+    using const_pointer = typename string_type::const_pointer;
+
+public:
+    STR_CONSTEXPR static size_type size(const string_type &str) STR_NOEXCEPT
+    {
+        return str.size();
+    }
+
+    STR_CONSTEXPR static const_pointer data(const string_type &str) STR_NOEXCEPT
+    {
+        return str.data();
+    }
+};
+
+//////////////////////////////////////////////////////////////////////
+// OStream Operator
+//////////////////////////////////////////////////////////////////////
+
+template <typename Char, typename CharTraits>
+std::basic_ostream<Char, CharTraits> &
+operator<<(std::basic_ostream<Char, CharTraits> &os, const basic_mmapstr<Char, CharTraits> &str)
+{
+    return details::ostream_insert(os, str.data(), str.size());
+}
+
+//////////////////////////////////////////////////////////////////////
+// TypeDefs
+//////////////////////////////////////////////////////////////////////
+
+using mmapstr = basic_mmapstr<char>;
+using wmmapstr = basic_mmapstr<wchar_t>;
+
+#endif
+
+STR_NAMESPACE_MAIN_END
@@ -0,0 +1,298 @@
+#pragma once
+#include "common.hpp"
+#include "simd.hpp"
+#include "allocator.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+STR_NAMESPACE_MAIN_BEGIN
+STR_NAMESPACE_DETAILS_BEGIN
+
+//////////////////////////////////////////////////////////////////////
+// Size class pool
+//////////////////////////////////////////////////////////////////////
+// Blocks of 16, 32, ... 4096 bytes are carved from 64 KB slabs, each slab
+// holds a single size class and is owned by the cache of a thread.
+// A thread allocates and frees its own blocks through free lists without
+// locks or atomics, blocks freed by other threads are pushed to a return
+// queue of the owner, which takes them back when its free list runs out.
+// Larger blocks fall through to operator new.
+
+inline constexpr std::size_t pool_min_block = 16;
+inline constexpr std::size_t pool_max_block = 4096;
+inline constexpr std::size_t pool_classes = 9;
+inline constexpr std::size_t pool_slab_size = 64 * 1024;
+
+struct pool_block
+{
+    pool_block *next;
+};
+
+struct pool_cache
+{
+    pool_block *free[pool_classes] = {};
+
+    // blocks freed by other threads, only the owner takes them
+    std::atomic<pool_block *> remote[pool_classes] = {};
+
+    pool_cache *next_orphan = nullptr;
+};
+
+/// Header at the start of each slab, blocks are found from it by alignment.
+struct pool_slab
+{
+    pool_cache *owner;
+    std::size_t size_class;
+};
+
+/// Returns the size class of a block holding bytes, bytes must be at most pool_max_block.
+inline std::size_t pool_size_class(std::size_t bytes) STR_NOEXCEPT
+{
+    if (bytes <= pool_min_block)
+        return 0;
+
+    // ceil(log2(bytes)) - log2(pool_min_block)
+    return static_cast<std::size_t>(bsr64(bytes - 1)) + 1 - 4;
+}
+
+inline constexpr std::size_t pool_block_size(std::size_t size_class) STR_NOEXCEPT
+{
+    return pool_min_block << size_class;
+}
+
+inline pool_slab *pool_slab_of(void *ptr) STR_NOEXCEPT
+{
+    return reinterpret_cast<pool_slab *>(reinterpret_cast<std::uintptr_t>(ptr) & ~(pool_slab_size - 1));
+}
+
+/// Caches of exited threads, their slabs may still hold live blocks,
+/// so they are handed to new threads instead of being freed.
+struct pool_orphans
+{
+    std::mutex mutex;
+    pool_cache *head = nullptr;
+};
+
+inline pool_orphans &pool_orphanage() STR_NOEXCEPT
+{
+    static pool_orphans orphans;
+    return orphans;
+}
+
+inline pool_cache *pool_adopt()
+{
+    auto &orphans = pool_orphanage();
+    {
+        std::lock_guard<std::mutex> lock(orphans.mutex);
+        if (auto cache = orphans.head)
+        {
+            orphans.head = cache->next_orphan;
+            cache->next_orphan = nullptr;
+            return cache;
+        }
+    }
+
+    return new pool_cache();
+}
+
+inline void pool_orphan(pool_cache *cache) STR_NOEXCEPT
+{
+    auto &orphans = pool_orphanage();
+    std::lock_guard<std::mutex> lock(orphans.mutex);
+    cache->next_orphan = orphans.head;
+    orphans.head = cache;
+}
+
+/// Cache of the calling thread, orphaned when the thread exits.
+struct pool_thread
+{
+    ~pool_thread()
+    {
+        if (auto cache = current())
+        {
+            current() = nullptr;
+            pool_orphan(cache);
+        }
+
+        exited() = true;
+    }
+
+    /// Cache of the thread, null until it first allocates and once it exited.
+    /// It is trivially destructible, so it can be read without creating a cache,
+    /// or by strings freed later on in the thread exit.
+    static pool_cache *&current() STR_NOEXCEPT
+    {
+        static thread_local pool_cache *cache = nullptr;
+        return cache;
+    }
+
+    /// Set once the cache of the thread is destroyed, it is trivially destructible
+    /// so it can still be read by strings freed later on in the thread exit.
+    static bool &exited() STR_NOEXCEPT
+    {
+        static thread_local bool exited = false;
+        return exited;
+    }
+};
+
+inline pool_cache *pool_local_cache()
+{
+    // orphans the cache at thread exit
+    static thread_local pool_thread thread;
+    (void)thread;
+
+    auto &cache = pool_thread::current();
+    if (cache == nullptr)
+    {
+        cache = pool_adopt();
+    }
+
+    return cache;
+}
+
+/// Carves a new slab of size_class for cache, returns its blocks linked.
+inline pool_block *pool_refill(pool_cache *cache, std::size_t size_class)
+{
+    auto slab = static_cast<pool_slab *>(::operator new(pool_slab_size, std::align_val_t(pool_slab_size)));
+    slab->owner = cache;
+    slab->size_class = size_class;
+
+    auto block_size = pool_block_size(size_class);
+    auto first = (sizeof(pool_slab) + block_size - 1) & ~(block_size - 1);
+    auto bytes = reinterpret_cast<char *>(slab);
+
+    pool_block *head = nullptr;
+    for (auto offset = pool_slab_size - block_size; offset >= first; offset -= block_size)
+    {
+        auto block = reinterpret_cast<pool_block *>(bytes + offset);
+        block->next = head;
+        head = block;
+    }
+
+    return head;
+}
+
+inline void *pool_allocate_from(pool_cache *cache, std::size_t size_class)
+{
+    auto block = cache->free[size_class];
+    if (block == nullptr)
+    {
+        block = cache->remote[size_class].exchange(nullptr, std::memory_order_acquire);
+        if (block == nullptr)
+        {
+            block = pool_refill(cache, size_class);
+        }
+    }
+
+    cache->free[size_class] = block->next;
+    return block;
+}
+
+/// Allocates a block of at least bytes, at most pool_max_block.
+inline void *pool_allocate(std::size_t bytes)
+{
+    auto size_class = pool_size_class(bytes);
+    if (!pool_thread::exited())
+        return pool_allocate_from(pool_local_cache(), size_class);
+
+    // the thread is exiting, borrow a cache for this block
+    auto cache = pool_adopt();
+    auto ptr = pool_allocate_from(cache, size_class);
+    pool_orphan(cache);
+    return ptr;
+}
+
+/// Returns a block from pool_allocate() to the cache owning its slab.
+inline void pool_deallocate(void *ptr) STR_NOEXCEPT
+{
+    auto slab = pool_slab_of(ptr);
+    auto owner = slab->owner;
+    auto block = static_cast<pool_block *>(ptr);
+
+    // a thread which never allocated has no cache and owns no slab
+    if (owner == pool_thread::current())
+    {
+        block->next = owner->free[slab->size_class];
+        owner->free[slab->size_class] = block;
+        return;
+    }
+
+    auto &remote = owner->remote[slab->size_class];
+    block->next = remote.load(std::memory_order_relaxed);
+    while (!remote.compare_exchange_weak(block->next, block, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+}
+
+STR_NAMESPACE_DETAILS_END
+
+/// Stateless allocator for string buffers, buffers up to 4 KB come from
+/// thread-local free lists of power of two size classes, larger ones from operator new.
+/// Threads do not contend on a malloc lock, a buffer freed by another thread
+/// is queued back to the thread which allocated it.
+template <typename T>
+class pool_allocator
+{
+public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    STR_CONSTEXPR pool_allocator() STR_NOEXCEPT = default;
+
+    template <typename U>
+    STR_CONSTEXPR pool_allocator(const pool_allocator<U> &) STR_NOEXCEPT {}
+
+    T *allocate(std::size_t count)
+    {
+        if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            throw std::bad_array_new_length();
+
+        auto bytes = count * sizeof(T);
+        if (bytes <= details::pool_max_block && alignof(T) <= details::pool_min_block)
+            return static_cast<T *>(details::pool_allocate(bytes));
+
+        return static_cast<T *>(::operator new(bytes));
+    }
+
+    /// Allocates count elements, reports the whole size class as usable.
+    allocation_result<T *> allocate_at_least(std::size_t count)
+    {
+        auto ptr = allocate(count);
+        auto bytes = count * sizeof(T);
+        if (bytes <= details::pool_max_block && alignof(T) <= details::pool_min_block)
+            return { ptr, details::pool_block_size(details::pool_size_class(bytes)) / sizeof(T) };
+
+        return { ptr, count };
+    }
+
+    void deallocate(T *ptr, std::size_t count) STR_NOEXCEPT
+    {
+        auto bytes = count * sizeof(T);
+        if (bytes <= details::pool_max_block && alignof(T) <= details::pool_min_block)
+        {
+            details::pool_deallocate(ptr);
+            return;
+        }
+
+        ::operator delete(ptr);
+    }
+};
+
+template <typename T, typename U>
+STR_CONSTEXPR bool operator==(const pool_allocator<T> &, const pool_allocator<U> &) STR_NOEXCEPT
+{
+    return true;
+}
+
+template <typename T, typename U>
+STR_CONSTEXPR bool operator!=(const pool_allocator<T> &, const pool_allocator<U> &) STR_NOEXCEPT
+{
+    return false;
+}
+
+STR_NAMESPACE_MAIN_END
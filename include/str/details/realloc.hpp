@@ -0,0 +1,198 @@
+#pragma once
+#include "common.hpp"
+#include "allocator.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#ifdef STR_HAS_MALLOC_USABLE_SIZE
+#include <malloc.h>
+#endif
+
+#ifdef STR_HAS_MREMAP
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+STR_NAMESPACE_MAIN_BEGIN
+
+/// Allocator of trivially copyable elements which can grow a block in place.
+/// Blocks below MapThreshold bytes come from malloc and grow through realloc,
+/// larger ones are mapped pages which grow through mremap, so the kernel moves
+/// the page tables instead of copying the content and the old block is not held
+/// next to the new one. Strings detect reallocate() and use it instead of
+/// allocating, copying and freeing.
+/// Without mremap, every block comes from malloc.
+template <typename T, std::size_t MapThreshold = 32 * 1024 * 1024>
+class realloc_allocator
+{
+    static_assert(std::is_trivially_copyable_v<T>, "realloc_allocator moves elements as bytes");
+
+public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    static constexpr std::size_t map_threshold = MapThreshold;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = realloc_allocator<U, MapThreshold>;
+    };
+
+    STR_CONSTEXPR realloc_allocator() STR_NOEXCEPT = default;
+
+    template <typename U>
+    STR_CONSTEXPR realloc_allocator(const realloc_allocator<U, MapThreshold> &) STR_NOEXCEPT {}
+
+    T *allocate(std::size_t count)
+    {
+        return allocate_at_least(count).ptr;
+    }
+
+    /// Allocates count elements, reports the usable size of the block.
+    allocation_result<T *> allocate_at_least(std::size_t count)
+    {
+        auto bytes = bytes_(count);
+        if (mapped_(bytes))
+            return map_(bytes);
+
+        auto ptr = static_cast<T *>(std::malloc(bytes));
+        if (ptr == nullptr)
+            throw std::bad_alloc();
+
+        return { ptr, usable_(ptr, count) };
+    }
+
+    void deallocate(T *ptr, std::size_t count) STR_NOEXCEPT
+    {
+        auto bytes = count * sizeof(T);
+        if (mapped_(bytes))
+        {
+            unmap_(ptr, bytes);
+            return;
+        }
+
+        std::free(ptr);
+    }
+
+    /// Resizes the block of ptr holding count elements to new_count, keeping
+    /// the first min(count, new_count) of them. The block may move, on failure
+    /// std::bad_alloc is thrown and ptr is left untouched.
+    allocation_result<T *> reallocate(T *ptr, std::size_t count, std::size_t new_count)
+    {
+        auto bytes = count * sizeof(T);
+        auto new_bytes = bytes_(new_count);
+
+        if (!mapped_(bytes) && !mapped_(new_bytes))
+        {
+            auto new_ptr = static_cast<T *>(std::realloc(ptr, new_bytes));
+            if (new_ptr == nullptr)
+                throw std::bad_alloc();
+
+            return { new_ptr, usable_(new_ptr, new_count) };
+        }
+
+#ifdef STR_HAS_MREMAP
+        if (mapped_(bytes) && mapped_(new_bytes))
+        {
+            auto size = page_round_(bytes);
+            auto new_size = page_round_(new_bytes);
+            auto new_ptr = ::mremap(ptr, size, new_size, MREMAP_MAYMOVE);
+            if (new_ptr == MAP_FAILED)
+                throw std::bad_alloc();
+
+            return { static_cast<T *>(new_ptr), new_size / sizeof(T) };
+        }
+#endif
+
+        // crossing the threshold, between malloc and pages
+        auto result = allocate_at_least(new_count);
+        std::memcpy(result.ptr, ptr, std::min(bytes, new_bytes));
+        deallocate(ptr, count);
+        return result;
+    }
+
+protected:
+    static std::size_t bytes_(std::size_t count)
+    {
+        if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            throw std::bad_array_new_length();
+
+        return count * sizeof(T);
+    }
+
+    static bool mapped_(std::size_t bytes) STR_NOEXCEPT
+    {
+#ifdef STR_HAS_MREMAP
+        return bytes >= map_threshold;
+#else
+        (void)bytes;
+        return false;
+#endif
+    }
+
+    /// Usable elements of a malloc block, kept under the threshold
+    /// so that deallocate() and reallocate() take the same path.
+    static std::size_t usable_(T *ptr, std::size_t count) STR_NOEXCEPT
+    {
+#ifdef STR_HAS_MALLOC_USABLE_SIZE
+        auto usable = ::malloc_usable_size(ptr) / sizeof(T);
+        if (usable > count && mapped_(usable * sizeof(T)))
+            usable = (map_threshold - 1) / sizeof(T);
+
+        return std::max(count, usable);
+#else
+        (void)ptr;
+        return count;
+#endif
+    }
+
+#ifdef STR_HAS_MREMAP
+    static std::size_t page_round_(std::size_t bytes) STR_NOEXCEPT
+    {
+        static const auto page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        return (bytes + page_size - 1) & ~(page_size - 1);
+    }
+
+    static allocation_result<T *> map_(std::size_t bytes)
+    {
+        auto size = page_round_(bytes);
+        auto ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED)
+            throw std::bad_alloc();
+
+        return { static_cast<T *>(ptr), size / sizeof(T) };
+    }
+
+    static void unmap_(T *ptr, std::size_t bytes) STR_NOEXCEPT
+    {
+        ::munmap(ptr, page_round_(bytes));
+    }
+#else
+    static allocation_result<T *> map_(std::size_t)
+    {
+        throw std::bad_alloc();
+    }
+
+    static void unmap_(T *, std::size_t) STR_NOEXCEPT {}
+#endif
+};
+
+template <typename T, typename U, std::size_t MapThreshold>
+STR_CONSTEXPR bool operator==(const realloc_allocator<T, MapThreshold> &, const realloc_allocator<U, MapThreshold> &) STR_NOEXCEPT
+{
+    return true;
+}
+
+template <typename T, typename U, std::size_t MapThreshold>
+STR_CONSTEXPR bool operator!=(const realloc_allocator<T, MapThreshold> &, const realloc_allocator<U, MapThreshold> &) STR_NOEXCEPT
+{
+    return false;
+}
+
+STR_NAMESPACE_MAIN_END
@@ -0,0 +1,417 @@
+#pragma once
+#include "common.hpp"
+#include "simd.hpp"
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+STR_NAMESPACE_MAIN_BEGIN
+STR_NAMESPACE_DETAILS_BEGIN
+
+///////////////////////////////////////////////////////////////////
+// Search Engine
+///////////////////////////////////////////////////////////////////
+// All functions search in the range [hay, hay + len) and return
+// the index of the match relative to hay, or search_npos.
+
+constexpr std::size_t search_npos = static_cast<std::size_t>(-1);
+
+/// Needles of at least this length use horspool instead of the vector filter.
+constexpr std::size_t search_long_needle = 32;
+
+/// Haystacks shorter than this never use horspool, building the skip table costs more.
+constexpr std::size_t search_long_haystack = 256;
+
+/// Code units can be compared bitwise and searched with vector instructions.
+template <typename Char, typename CharTraits>
+struct is_simd_searchable
+    : std::integral_constant<bool, std::is_same<CharTraits, std::char_traits<Char>>::value &&
+                                       (sizeof(Char) == 1 || sizeof(Char) == 2 || sizeof(Char) == 4)>
+{
+};
+
+/// Checks whether [lhs, lhs + count) and [rhs, rhs + count) are equal.
+template <typename Char, typename CharTraits>
+inline bool equal(const Char *lhs, const Char *rhs, std::size_t count) STR_NOEXCEPT
+{
+    return CharTraits::compare(lhs, rhs, count) == 0;
+}
+
+/// Finds the first occurrence of ch.
+template <typename Char, typename CharTraits>
+inline std::size_t find_char(const Char *hay, std::size_t len, Char ch) STR_NOEXCEPT
+{
+    // char_traits::find is memchr/wmemchr for the standard character types
+    auto ptr = CharTraits::find(hay, len, ch);
+    return ptr == nullptr ? search_npos : static_cast<std::size_t>(ptr - hay);
+}
+
+/// Finds the first character of the needle and compares the rest at each candidate.
+template <typename Char, typename CharTraits>
+inline std::size_t search_scalar_(const Char *hay, std::size_t len, const Char *needle, std::size_t count) STR_NOEXCEPT
+{
+    const Char *ptr = hay;
+    const Char *last = hay + (len - count) + 1;
+
+    while (true)
+    {
+        ptr = CharTraits::find(ptr, static_cast<std::size_t>(last - ptr), needle[0]);
+        if (ptr == nullptr)
+            return search_npos;
+
+        if (CharTraits::compare(ptr + 1, needle + 1, count - 1) == 0)
+            return static_cast<std::size_t>(ptr - hay);
+
+        ptr++;
+    }
+}
+
+/// Boyer-Moore-Horspool, used for long needles over byte sized code units.
+template <typename Char>
+inline std::size_t search_horspool_(const Char *hay, std::size_t len, const Char *needle, std::size_t count) STR_NOEXCEPT
+{
+    using byte = unsigned char;
+
+    std::size_t skip[256];
+    for (auto &shift : skip)
+        shift = count;
+
+    for (std::size_t i = 0; i + 1 < count; i++)
+        skip[static_cast<byte>(needle[i])] = count - 1 - i;
+
+    const byte last = static_cast<byte>(needle[count - 1]);
+    for (std::size_t i = 0; i <= len - count;)
+    {
+        const byte ch = static_cast<byte>(hay[i + count - 1]);
+        if (ch == last && std::memcmp(hay + i, needle, count - 1) == 0)
+            return i;
+
+        i += skip[ch];
+    }
+
+    return search_npos;
+}
+
+#ifdef STR_SIMD_SSE2
+
+/// Compares the first and the last character of the needle against 16 bytes at a time,
+/// full comparisons are only performed where both of them match.
+template <typename Char, typename CharTraits>
+inline std::size_t search_sse2_(const Char *hay, std::size_t len, const Char *needle, std::size_t count) STR_NOEXCEPT
+{
+    using ops = sse2_ops<sizeof(Char)>;
+    constexpr std::size_t width = 16 / sizeof(Char);
+    constexpr std::uint32_t unit_bits = (1u << sizeof(Char)) - 1;
+
+    const __m128i first = ops::set1(needle[0]);
+    const __m128i last = ops::set1(needle[count - 1]);
+
+    std::size_t i = 0;
+    for (; i + count - 1 + width <= len; i += width)
+    {
+        const __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i *>(hay + i));
+        const __m128i block_last = _mm_loadu_si128(reinterpret_cast<const __m128i *>(hay + i + count - 1));
+        const __m128i eq = _mm_and_si128(ops::cmpeq(first, block_first), ops::cmpeq(last, block_last));
+
+        auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(eq));
+        while (mask != 0)
+        {
+            const unsigned bit = ctz32(mask);
+            const std::size_t pos = i + bit / sizeof(Char);
+            if (std::memcmp(hay + pos + 1, needle + 1, (count - 2) * sizeof(Char)) == 0)
+                return pos;
+
+            mask &= ~(unit_bits << bit);
+        }
+    }
+
+    if (i + count > len)
+        return search_npos;
+
+    auto result = search_scalar_<Char, CharTraits>(hay + i, len - i, needle, count);
+    return result == search_npos ? search_npos : i + result;
+}
+
+#ifdef STR_SIMD_AVX2
+
+/// Same as search_sse2_ with 32 bytes at a time.
+template <typename Char, typename CharTraits>
+STR_SIMD_TARGET_AVX2 inline std::size_t search_avx2_(const Char *hay, std::size_t len, const Char *needle, std::size_t count) STR_NOEXCEPT
+{
+    using ops = avx2_ops<sizeof(Char)>;
+    constexpr std::size_t width = 32 / sizeof(Char);
+    constexpr std::uint32_t unit_bits = (1u << sizeof(Char)) - 1;
+
+    const __m256i first = ops::set1(needle[0]);
+    const __m256i last = ops::set1(needle[count - 1]);
+
+    std::size_t i = 0;
+    for (; i + count - 1 + width <= len; i += width)
+    {
+        const __m256i block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(hay + i));
+        const __m256i block_last = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(hay + i + count - 1));
+        const __m256i eq = _mm256_and_si256(ops::cmpeq(first, block_first), ops::cmpeq(last, block_last));
+
+        auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(eq));
+        while (mask != 0)
+        {
+            const unsigned bit = ctz32(mask);
+            const std::size_t pos = i + bit / sizeof(Char);
+            if (std::memcmp(hay + pos + 1, needle + 1, (count - 2) * sizeof(Char)) == 0)
+                return pos;
+
+            mask &= ~(unit_bits << bit);
+        }
+    }
+
+    if (i + count > len)
+        return search_npos;
+
+    // the remaining tail is shorter than one avx2 block
+    auto result = search_sse2_<Char, CharTraits>(hay + i, len - i, needle, count);
+    return result == search_npos ? search_npos : i + result;
+}
+
+#endif
+#endif
+
+/// Finds the first occurrence of [needle, needle + count).
+/// The algorithm is picked at runtime from the needle length, the haystack length,
+/// the code unit type and the instruction sets supported by the cpu.
+template <typename Char, typename CharTraits>
+inline std::size_t search(const Char *hay, std::size_t len, const Char *needle, std::size_t count) STR_NOEXCEPT
+{
+    if (count == 0)
+        return 0;
+
+    if (count > len)
+        return search_npos;
+
+    if (count == 1)
+        return find_char<Char, CharTraits>(hay, len, needle[0]);
+
+    if constexpr (is_simd_searchable<Char, CharTraits>::value)
+    {
+        if (sizeof(Char) == 1 && count >= search_long_needle && len >= search_long_haystack)
+            return search_horspool_(hay, len, needle, count);
+
+#ifdef STR_SIMD_SSE2
+#ifdef STR_SIMD_AVX2
+        if (cpu_has_avx2())
+            return search_avx2_<Char, CharTraits>(hay, len, needle, count);
+#endif
+        return search_sse2_<Char, CharTraits>(hay, len, needle, count);
+#endif
+    }
+
+    return search_scalar_<Char, CharTraits>(hay, len, needle, count);
+}
+
+///////////////////////////////////////////////////////////////////
+// Reverse Search Engine
+///////////////////////////////////////////////////////////////////
+// Same as above, but returns the index of the last match.
+
+template <typename Char, typename CharTraits, bool Equal>
+inline std::size_t rfind_char_scalar_(const Char *hay, std::size_t len, Char ch) STR_NOEXCEPT
+{
+    for (std::size_t i = len; i > 0; i--)
+    {
+        if (CharTraits::eq(hay[i - 1], ch) == Equal)
+            return i - 1;
+    }
+
+    return search_npos;
+}
+
+template <typename Char, typename CharTraits>
+inline std::size_t rsearch_scalar_(const Char *hay, std::size_t len, const Char *needle, std::size_t count) STR_NOEXCEPT
+{
+    for (std::size_t i = len - count + 1; i > 0; i--)
+    {
+        if (CharTraits::eq(hay[i - 1], needle[0]) && CharTraits::compare(hay + i, needle + 1, count - 1) == 0)
+            return i - 1;
+    }
+
+    return search_npos;
+}
+
+#ifdef STR_SIMD_SSE2
+
+/// Scans 16 bytes at a time from the end, memrchr style.
+/// If Equal is false, finds the last character which is not ch.
+template <typename Char, typename CharTraits, bool Equal>
+inline std::size_t rfind_char_sse2_(const Char *hay, std::size_t len, Char ch) STR_NOEXCEPT
+{
+    using ops = sse2_ops<sizeof(Char)>;
+    constexpr std::size_t width = 16 / sizeof(Char);
+
+    const __m128i needle = ops::set1(ch);
+
+    std::size_t i = len;
+    while (i >= width)
+    {
+        i -= width;
+
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(hay + i));
+        auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(ops::cmpeq(needle, block)));
+        if (!Equal)
+            mask ^= 0xFFFFu;
+
+        if (mask != 0)
+            return i + bsr32(mask) / sizeof(Char);
+    }
+
+    return rfind_char_scalar_<Char, CharTraits, Equal>(hay, i, ch);
+}
+
+/// Reversed first+last character filter, candidates are checked from the highest position.
+template <typename Char, typename CharTraits>
+inline std::size_t rsearch_sse2_(const Char *hay, std::size_t len, const Char *needle, std::size_t count) STR_NOEXCEPT
+{
+    using ops = sse2_ops<sizeof(Char)>;
+    constexpr std::size_t width = 16 / sizeof(Char);
+    constexpr std::uint32_t unit_bits = (1u << sizeof(Char)) - 1;
+
+    const __m128i first = ops::set1(needle[0]);
+    const __m128i last = ops::set1(needle[count - 1]);
+
+    // candidates are [0, i)
+    std::size_t i = len - count + 1;
+    while (i >= width)
+    {
+        i -= width;
+
+        const __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i *>(hay + i));
+        const __m128i block_last = _mm_loadu_si128(reinterpret_cast<const __m128i *>(hay + i + count - 1));
+        const __m128i eq = _mm_and_si128(ops::cmpeq(first, block_first), ops::cmpeq(last, block_last));
+
+        auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(eq));
+        while (mask != 0)
+        {
+            const unsigned unit = bsr32(mask) / sizeof(Char);
+            const std::size_t pos = i + unit;
+            if (std::memcmp(hay + pos + 1, needle + 1, (count - 2) * sizeof(Char)) == 0)
+                return pos;
+
+            mask &= ~(unit_bits << (unit * sizeof(Char)));
+        }
+    }
+
+    return rsearch_scalar_<Char, CharTraits>(hay, i + count - 1, needle, count);
+}
+
+#ifdef STR_SIMD_AVX2
+
+/// Same as rfind_char_sse2_ with 32 bytes at a time.
+template <typename Char, typename CharTraits, bool Equal>
+STR_SIMD_TARGET_AVX2 inline std::size_t rfind_char_avx2_(const Char *hay, std::size_t len, Char ch) STR_NOEXCEPT
+{
+    using ops = avx2_ops<sizeof(Char)>;
+    constexpr std::size_t width = 32 / sizeof(Char);
+
+    const __m256i needle = ops::set1(ch);
+
+    std::size_t i = len;
+    while (i >= width)
+    {
+        i -= width;
+
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(hay + i));
+        auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(ops::cmpeq(needle, block)));
+        if (!Equal)
+            mask = ~mask;
+
+        if (mask != 0)
+            return i + bsr32(mask) / sizeof(Char);
+    }
+
+    return rfind_char_sse2_<Char, CharTraits, Equal>(hay, i, ch);
+}
+
+/// Same as rsearch_sse2_ with 32 bytes at a time.
+template <typename Char, typename CharTraits>
+STR_SIMD_TARGET_AVX2 inline std::size_t rsearch_avx2_(const Char *hay, std::size_t len, const Char *needle, std::size_t count) STR_NOEXCEPT
+{
+    using ops = avx2_ops<sizeof(Char)>;
+    constexpr std::size_t width = 32 / sizeof(Char);
+    constexpr std::uint32_t unit_bits = (1u << sizeof(Char)) - 1;
+
+    const __m256i first = ops::set1(needle[0]);
+    const __m256i last = ops::set1(needle[count - 1]);
+
+    std::size_t i = len - count + 1;
+    while (i >= width)
+    {
+        i -= width;
+
+        const __m256i block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(hay + i));
+        const __m256i block_last = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(hay + i + count - 1));
+        const __m256i eq = _mm256_and_si256(ops::cmpeq(first, block_first), ops::cmpeq(last, block_last));
+
+        auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(eq));
+        while (mask != 0)
+        {
+            const unsigned unit = bsr32(mask) / sizeof(Char);
+            const std::size_t pos = i + unit;
+            if (std::memcmp(hay + pos + 1, needle + 1, (count - 2) * sizeof(Char)) == 0)
+                return pos;
+
+            mask &= ~(unit_bits << (unit * sizeof(Char)));
+        }
+    }
+
+    return rsearch_sse2_<Char, CharTraits>(hay, i + count - 1, needle, count);
+}
+
+#endif
+#endif
+
+/// Finds the last occurrence of ch, or the last character which is not ch if Equal is false.
+template <typename Char, typename CharTraits, bool Equal = true>
+inline std::size_t rfind_char(const Char *hay, std::size_t len, Char ch) STR_NOEXCEPT
+{
+#ifdef STR_SIMD_SSE2
+    if constexpr (is_simd_searchable<Char, CharTraits>::value)
+    {
+#ifdef STR_SIMD_AVX2
+        if (cpu_has_avx2())
+            return rfind_char_avx2_<Char, CharTraits, Equal>(hay, len, ch);
+#endif
+        return rfind_char_sse2_<Char, CharTraits, Equal>(hay, len, ch);
+    }
+#endif
+
+    return rfind_char_scalar_<Char, CharTraits, Equal>(hay, len, ch);
+}
+
+/// Finds the last occurrence of [needle, needle + count).
+template <typename Char, typename CharTraits>
+inline std::size_t rsearch(const Char *hay, std::size_t len, const Char *needle, std::size_t count) STR_NOEXCEPT
+{
+    if (count == 0)
+        return len;
+
+    if (count > len)
+        return search_npos;
+
+    if (count == 1)
+        return rfind_char<Char, CharTraits>(hay, len, needle[0]);
+
+#ifdef STR_SIMD_SSE2
+    if constexpr (is_simd_searchable<Char, CharTraits>::value)
+    {
+#ifdef STR_SIMD_AVX2
+        if (cpu_has_avx2())
+            return rsearch_avx2_<Char, CharTraits>(hay, len, needle, count);
+#endif
+        return rsearch_sse2_<Char, CharTraits>(hay, len, needle, count);
+    }
+#endif
+
+    return rsearch_scalar_<Char, CharTraits>(hay, len, needle, count);
+}
+
+STR_NAMESPACE_DETAILS_END
+STR_NAMESPACE_MAIN_END
@@ -0,0 +1,443 @@
+#pragma once
+#include "str.hpp"
+#include "allocator.hpp"
+#include <atomic>
+#include <new>
+
+STR_NAMESPACE_MAIN_BEGIN
+
+/// Reference counted string, copies share the same buffer.
+/// The buffer is a single allocation holding the reference count, the capacity
+/// and the characters. Copies and substr() only increment the reference count,
+/// the buffer is copied the first time a shared string is written (copy-on-write).
+/// Every string stays null-terminated: substr() shares the buffer only when the
+/// slice is followed by a terminator, such as a suffix, and copies it otherwise.
+/// Once a mutable pointer or reference is handed out by data(), operator[] or begin(),
+/// the buffer is no longer shared: copies made until the size changes copy the characters.
+template <typename Char, typename CharTraits = std::char_traits<Char>, typename Allocator = std::allocator<Char>,
+          typename GrowthPolicy = default_growth>
+class basic_sharedstr : public basic_str_core<basic_sharedstr<Char, CharTraits, Allocator, GrowthPolicy>,
+                                              Char, CharTraits, Allocator>
+{
+    using this_t = basic_sharedstr<Char, CharTraits, Allocator, GrowthPolicy>;
+
+public:
+    using base_t = basic_str_core<this_t, Char, CharTraits, Allocator>;
+    using growth_policy = GrowthPolicy;
+    using value_type = typename base_t::value_type;
+    using traits_type = typename base_t::traits_type;
+    using allocator_type = typename base_t::allocator_type;
+    using allocator_traits = typename base_t::allocator_traits;
+    using size_type = typename base_t::size_type;
+    using difference_type = typename base_t::difference_type;
+    using reference = typename base_t::reference;
+    using const_reference = typename base_t::const_reference;
+    using pointer = typename base_t::pointer;
+    using const_pointer = typename base_t::const_pointer;
+    using iterator = typename base_t::iterator;
+    using const_iterator = typename base_t::const_iterator;
+    using reverse_iterator = typename base_t::reverse_iterator;
+    using const_reverse_iterator = typename base_t::const_reverse_iterator;
+
+    using base_t::npos;
+    using base_t::operator=;
+    using base_t::resize;
+
+    friend base_t;
+
+    template <typename String>
+    friend class basic_str_adapter;
+
+protected:
+    /// Header of the buffer, the characters follow it.
+    struct block_t
+    {
+        std::atomic<size_type> refs;
+        size_type capacity;
+
+        // a mutable pointer was handed out, only written by the single owner
+        bool unshareable;
+    };
+
+    using block_allocator = typename allocator_traits::template rebind_alloc<block_t>;
+    using block_traits = typename allocator_traits::template rebind_traits<block_t>;
+
+    static_assert(sizeof(block_t) % sizeof(value_type) == 0, "value_type must divide the buffer header");
+
+public:
+    //////////////////////////////////////////////////////////////////////
+    // CONSTRUCTORS / DESTRUCTOR
+    //////////////////////////////////////////////////////////////////////
+
+    STR_CONSTEXPR basic_sharedstr(const Allocator &alloc = Allocator()) STR_NOEXCEPT
+        : storage_{alloc}, data_{empty_()} {}
+
+    /// Shares the buffer of other, or copies it when other handed out a mutable pointer.
+    STR_CONSTEXPR basic_sharedstr(const basic_sharedstr &other)
+        : storage_{other.alloc_()}, data_{empty_()}
+    {
+        share_(other, 0, other.size_);
+    }
+
+    STR_CONSTEXPR basic_sharedstr(basic_sharedstr &&other) STR_NOEXCEPT
+        : storage_{std::move(other.alloc_())}, data_{other.data_}, size_{other.size_}
+    {
+        storage_.value = other.storage_.value;
+        other.storage_.value = nullptr;
+        other.data_ = empty_();
+        other.size_ = 0;
+    }
+
+    STR_CONSTEXPR basic_sharedstr(size_type size, const Allocator &alloc = Allocator())
+        : storage_{alloc}, data_{empty_()}
+    {
+        resize(size);
+    }
+
+    STR_CONSTEXPR basic_sharedstr(value_type ch, size_type count, const Allocator &alloc = Allocator())
+        : storage_{alloc}, data_{empty_()}
+    {
+        this->append(ch, count);
+    }
+
+    STR_CONSTEXPR basic_sharedstr(const value_type *s, const Allocator &alloc = Allocator())
+        : storage_{alloc}, data_{empty_()}
+    {
+        this->append(s);
+    }
+
+    STR_CONSTEXPR basic_sharedstr(const value_type *s, size_type count, const Allocator &alloc = Allocator())
+        : storage_{alloc}, data_{empty_()}
+    {
+        this->append(s, count);
+    }
+
+    template <typename InputIt>
+    STR_CONSTEXPR basic_sharedstr(InputIt first, InputIt last, const Allocator &alloc = Allocator())
+        : storage_{alloc}, data_{empty_()}
+    {
+        this->append(first, last);
+    }
+
+    STR_CONSTEXPR basic_sharedstr(std::initializer_list<value_type> ilist, const Allocator &alloc = Allocator())
+        : storage_{alloc}, data_{empty_()}
+    {
+        this->append(ilist);
+    }
+
+    template <typename StringLike>
+    STR_CONSTEXPR basic_sharedstr(const StringLike &str, size_type str_index = 0, const Allocator &alloc = Allocator())
+        : storage_{alloc}, data_{empty_()}
+    {
+        this->append(str, str_index, npos);
+    }
+
+    template <typename StringLike>
+    STR_CONSTEXPR basic_sharedstr(const StringLike &str, size_type str_index, size_type str_count = npos, const Allocator &alloc = Allocator())
+        : storage_{alloc}, data_{empty_()}
+    {
+        this->append(str, str_index, str_count);
+    }
+
+    STR_CONSTEXPR ~basic_sharedstr() STR_NOEXCEPT
+    {
+        release_();
+    }
+
+    /// Shares the buffer of other.
+    STR_CONSTEXPR basic_sharedstr &operator=(const basic_sharedstr &other)
+    {
+        if (this != &other)
+        {
+            basic_sharedstr tmp(other);
+            swap_(tmp);
+        }
+
+        return *this;
+    }
+
+    STR_CONSTEXPR basic_sharedstr &operator=(basic_sharedstr &&other) STR_NOEXCEPT
+    {
+        if (this != &other)
+        {
+            basic_sharedstr tmp(std::move(other));
+            swap_(tmp);
+        }
+
+        return *this;
+    }
+
+    //////////////////////////////////////////////////////////////////////
+    // ELEMENT ACCESS
+    //////////////////////////////////////////////////////////////////////
+
+    /// Returns a pointer to the characters, a shared buffer is copied first.
+    /// The pointer may be written later on, so the buffer stops being shared.
+    STR_CONSTEXPR pointer data()
+    {
+        if (storage_.value == nullptr)
+            return empty_();
+
+        if (!unique_())
+        {
+            resize(size_);
+        }
+
+        storage_.value->unshareable = true;
+        return data_;
+    }
+
+    STR_CONSTEXPR const_pointer data() const STR_NOEXCEPT
+    {
+        return data_;
+    }
+
+    //////////////////////////////////////////////////////////////////////
+    // CAPACITY
+    //////////////////////////////////////////////////////////////////////
+
+    STR_CONSTEXPR size_type size() const STR_NOEXCEPT
+    {
+        return size_;
+    }
+
+    STR_CONSTEXPR size_type max_size() const STR_NOEXCEPT
+    {
+        block_allocator alloc(alloc_());
+        return (block_traits::max_size(alloc) - 1) * (sizeof(block_t) / sizeof(value_type)) - 1;
+    }
+
+    /// A shared buffer has no room to grow, writing to it requires a copy.
+    STR_CONSTEXPR size_type capacity() const STR_NOEXCEPT
+    {
+        if (!unique_())
+            return size_;
+
+        auto block = storage_.value;
+        return block->capacity - static_cast<size_type>(data_ - chars_(block));
+    }
+
+    STR_CONSTEXPR allocator_type get_allocator() const STR_NOEXCEPT
+    {
+        return alloc_();
+    }
+
+    /// Returns the count of strings sharing the buffer, 0 if there is no buffer.
+    STR_CONSTEXPR size_type use_count() const STR_NOEXCEPT
+    {
+        return storage_.value ? storage_.value->refs.load(std::memory_order_relaxed) : 0;
+    }
+
+    /// Checks whether the buffer is shared with other strings.
+    STR_CONSTEXPR bool is_shared() const STR_NOEXCEPT
+    {
+        return use_count() > 1;
+    }
+
+protected:
+    /// Called once the characters were written, previous pointers are invalidated
+    /// so the buffer can be shared again.
+    STR_CONSTEXPR void set_size_(size_type size) STR_NOEXCEPT
+    {
+        size_ = size;
+
+        // only set on a buffer which is not shared
+        if (storage_.value && storage_.value->unshareable)
+        {
+            storage_.value->unshareable = false;
+        }
+    }
+
+    STR_CONSTEXPR size_type recommend_(size_type required) const STR_NOEXCEPT
+    {
+        return growth_policy::template grow<value_type, size_type>(capacity(), required, max_size());
+    }
+
+public:
+    //////////////////////////////////////////////////////////////////////
+    // OPERATIONS
+    //////////////////////////////////////////////////////////////////////
+
+    /// Clears the contents, a shared buffer is released.
+    STR_CONSTEXPR void clear() STR_NOEXCEPT
+    {
+        if (!unique_())
+        {
+            release_();
+            return;
+        }
+
+        size_ = 0;
+        data_[0] = '\0';
+        storage_.value->unshareable = false;
+    }
+
+    /// Returns the substring [index, index + count), which shares this buffer when
+    /// it is followed by a null terminator and is copied otherwise.
+    STR_CONSTEXPR basic_sharedstr substr(size_type index = 0, size_type count = npos) const
+    {
+        this->assert_range_(index);
+
+        basic_sharedstr slice(alloc_());
+        slice.share_(*this, index, std::min(count, size_ - index));
+        return slice;
+    }
+
+    /// Reallocates the buffer with capacity cap, the new buffer is not shared.
+    STR_CONSTEXPR void resize(size_type cap, value_type ch)
+    {
+        resize_(cap, &ch);
+    }
+
+protected:
+    /// Sets the capacity to cap without initializing the new characters.
+    STR_CONSTEXPR void reserve_(size_type cap)
+    {
+        resize_(cap, nullptr);
+    }
+
+    /// Sets the capacity to cap, the new characters are set to *fill unless it is null.
+    STR_CONSTEXPR void resize_(size_type cap, const value_type *fill)
+    {
+        this->assert_length_(cap);
+
+        auto block = storage_.value;
+        if (unique_() && data_ == chars_(block) && block->capacity == cap)
+            return;
+
+        auto count = std::min(size_, cap);
+
+        auto new_block = allocate_(cap);
+        auto ptr = chars_(new_block);
+        traits_type::copy(ptr, data_, count);
+        if (fill)
+        {
+            traits_type::assign(ptr + count, cap - count, *fill);
+        }
+
+        ptr[count] = '\0';
+        ptr[cap] = '\0';
+
+        release_();
+
+        storage_.value = new_block;
+        data_ = ptr;
+        size_ = count;
+    }
+
+    STR_CONSTEXPR allocator_type &alloc_() STR_NOEXCEPT
+    {
+        return storage_.allocator();
+    }
+
+    STR_CONSTEXPR const allocator_type &alloc_() const STR_NOEXCEPT
+    {
+        return storage_.allocator();
+    }
+
+    /// Buffer of empty strings, it is never written.
+    static STR_CONSTEXPR pointer empty_() STR_NOEXCEPT
+    {
+        static value_type empty[1] = {};
+        return empty;
+    }
+
+    static STR_CONSTEXPR pointer chars_(block_t *block) STR_NOEXCEPT
+    {
+        return reinterpret_cast<pointer>(block + 1);
+    }
+
+    /// Count of headers needed to hold the header, cap characters and the null terminator.
+    static STR_CONSTEXPR size_type blocks_(size_type cap) STR_NOEXCEPT
+    {
+        return 1 + ((cap + 1) * sizeof(value_type) + sizeof(block_t) - 1) / sizeof(block_t);
+    }
+
+    STR_CONSTEXPR bool unique_() const STR_NOEXCEPT
+    {
+        // acquire the writes of the strings which released the buffer
+        return storage_.value && storage_.value->refs.load(std::memory_order_acquire) == 1;
+    }
+
+    STR_CONSTEXPR block_t *allocate_(size_type cap)
+    {
+        block_allocator alloc(alloc_());
+        block_t *block = block_traits::allocate(alloc, blocks_(cap));
+
+        ::new (static_cast<void *>(block)) block_t{{1}, cap, false};
+        return block;
+    }
+
+    /// Drops the reference to the buffer, the last reference frees it.
+    STR_CONSTEXPR void release_() STR_NOEXCEPT
+    {
+        auto block = storage_.value;
+        if (block && block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            auto count = blocks_(block->capacity);
+            block->~block_t();
+
+            block_allocator alloc(alloc_());
+            block_traits::deallocate(alloc, block, count);
+        }
+
+        storage_.value = nullptr;
+        data_ = empty_();
+        size_ = 0;
+    }
+
+    /// Refers to the characters [index, index + count) of other, which must be empty.
+    /// They are copied if other handed out a mutable pointer to its buffer, or if
+    /// they are not followed by a null terminator: c_str() const must not write.
+    STR_CONSTEXPR void share_(const basic_sharedstr &other, size_type index, size_type count)
+    {
+        auto block = other.storage_.value;
+        if (block && (block->unshareable || !traits_type::eq(other.data_[index + count], value_type())))
+        {
+            this->append(static_cast<const_pointer>(other.data_ + index), count);
+            return;
+        }
+
+        storage_.value = block;
+        if (block)
+        {
+            block->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        data_ = other.data_ + index;
+        size_ = count;
+    }
+
+    STR_CONSTEXPR void swap_(basic_sharedstr &other) STR_NOEXCEPT
+    {
+        using std::swap;
+        swap(alloc_(), other.alloc_());
+        swap(storage_.value, other.storage_.value);
+        swap(data_, other.data_);
+        swap(size_, other.size_);
+    }
+
+protected:
+    details::alloc_storage<Allocator, block_t *> storage_;
+    pointer data_;
+    size_type size_ = 0;
+};
+
+/// Copies share a block on the heap, which does not point back to them.
+template <typename Char, typename CharTraits, typename Allocator, typename GrowthPolicy>
+struct is_trivially_relocatable<basic_sharedstr<Char, CharTraits, Allocator, GrowthPolicy>>
+    : is_trivially_relocatable<Allocator>
+{
+};
+
+//////////////////////////////////////////////////////////////////////
+// TypeDefs
+//////////////////////////////////////////////////////////////////////
+
+using sharedstr = basic_sharedstr<char>;
+using wsharedstr = basic_sharedstr<wchar_t>;
+using u8sharedstr = basic_sharedstr<char8_t>;
+using u16sharedstr = basic_sharedstr<char16_t>;
+using u32sharedstr = basic_sharedstr<char32_t>;
+
+STR_NAMESPACE_MAIN_END
@@ -0,0 +1,246 @@
+#pragma once
+#include "common.hpp"
+#include "tweaks.hpp"
+#include <cstddef>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////
+// Instruction Sets
+///////////////////////////////////////////////////////////////////
+// STR_SIMD_SSE2 is defined when sse2 is available at compile time.
+// STR_SIMD_SSSE3 and STR_SIMD_AVX2 are defined when ssse3 and avx2 kernels
+// can be compiled, they must only be called after checking
+// details::cpu_has_ssse3() and details::cpu_has_avx2().
+#ifndef STR_TWEAKS_DISABLE_SIMD
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define STR_SIMD_SSE2
+#endif
+#endif
+
+#ifdef STR_SIMD_SSE2
+#include <immintrin.h>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define STR_SIMD_SSSE3
+#define STR_SIMD_TARGET_SSSE3
+#define STR_SIMD_AVX2
+#define STR_SIMD_TARGET_AVX2
+#elif defined(__GNUC__) || defined(__clang__)
+#define STR_SIMD_SSSE3
+#define STR_SIMD_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define STR_SIMD_AVX2
+#define STR_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+#endif
+
+STR_NAMESPACE_MAIN_BEGIN
+STR_NAMESPACE_DETAILS_BEGIN
+
+/// Returns true if the running cpu supports ssse3.
+/// The check is performed once and cached.
+inline bool cpu_has_ssse3() STR_NOEXCEPT
+{
+#if defined(__SSSE3__)
+    return true;
+#elif defined(STR_SIMD_SSSE3) && defined(_MSC_VER) && !defined(__clang__)
+    static const bool has_ssse3 = []
+    {
+        int info[4];
+        __cpuidex(info, 1, 0);
+        return (info[2] & (1 << 9)) != 0;
+    }();
+
+    return has_ssse3;
+#elif defined(STR_SIMD_SSSE3)
+    static const bool has_ssse3 = __builtin_cpu_supports("ssse3");
+    return has_ssse3;
+#else
+    return false;
+#endif
+}
+
+/// Returns true if the running cpu supports avx2.
+/// The check is performed once and cached.
+inline bool cpu_has_avx2() STR_NOEXCEPT
+{
+#if defined(__AVX2__)
+    return true;
+#elif defined(STR_SIMD_AVX2) && defined(_MSC_VER) && !defined(__clang__)
+    static const bool has_avx2 = []
+    {
+        int info[4];
+        __cpuidex(info, 0, 0);
+        if (info[0] < 7)
+            return false;
+
+        // os must save ymm registers
+        __cpuidex(info, 1, 0);
+        if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0)
+            return false;
+        if ((_xgetbv(0) & 6) != 6)
+            return false;
+
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+    }();
+
+    return has_avx2;
+#elif defined(STR_SIMD_AVX2)
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    return has_avx2;
+#else
+    return false;
+#endif
+}
+
+/// Returns the index of the lowest set bit.
+/// @note the behavior is undefined if mask == 0.
+inline unsigned ctz32(std::uint32_t mask) STR_NOEXCEPT
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+
+/// Returns the index of the highest set bit.
+/// @note the behavior is undefined if mask == 0.
+inline unsigned bsr32(std::uint32_t mask) STR_NOEXCEPT
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanReverse(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return 31u - static_cast<unsigned>(__builtin_clz(mask));
+#endif
+}
+
+/// Returns the index of the highest set bit.
+/// @note the behavior is undefined if mask == 0.
+inline unsigned bsr64(std::uint64_t mask) STR_NOEXCEPT
+{
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    _BitScanReverse64(&index, mask);
+    return static_cast<unsigned>(index);
+#elif defined(_MSC_VER) && !defined(__clang__)
+    auto high = static_cast<std::uint32_t>(mask >> 32);
+    return high ? 32u + bsr32(high) : bsr32(static_cast<std::uint32_t>(mask));
+#else
+    return 63u - static_cast<unsigned>(__builtin_clzll(mask));
+#endif
+}
+
+#ifdef STR_SIMD_SSE2
+
+/// Vector operations on 128 bit registers for code units of the given size.
+template <std::size_t UnitSize>
+struct sse2_ops;
+
+template <>
+struct sse2_ops<1>
+{
+    template <typename Char>
+    static __m128i set1(Char ch) STR_NOEXCEPT
+    {
+        return _mm_set1_epi8(static_cast<char>(ch));
+    }
+
+    static __m128i cmpeq(__m128i a, __m128i b) STR_NOEXCEPT
+    {
+        return _mm_cmpeq_epi8(a, b);
+    }
+};
+
+template <>
+struct sse2_ops<2>
+{
+    template <typename Char>
+    static __m128i set1(Char ch) STR_NOEXCEPT
+    {
+        return _mm_set1_epi16(static_cast<short>(ch));
+    }
+
+    static __m128i cmpeq(__m128i a, __m128i b) STR_NOEXCEPT
+    {
+        return _mm_cmpeq_epi16(a, b);
+    }
+};
+
+template <>
+struct sse2_ops<4>
+{
+    template <typename Char>
+    static __m128i set1(Char ch) STR_NOEXCEPT
+    {
+        return _mm_set1_epi32(static_cast<int>(ch));
+    }
+
+    static __m128i cmpeq(__m128i a, __m128i b) STR_NOEXCEPT
+    {
+        return _mm_cmpeq_epi32(a, b);
+    }
+};
+
+#ifdef STR_SIMD_AVX2
+
+/// Vector operations on 256 bit registers for code units of the given size.
+template <std::size_t UnitSize>
+struct avx2_ops;
+
+template <>
+struct avx2_ops<1>
+{
+    template <typename Char>
+    STR_SIMD_TARGET_AVX2 static __m256i set1(Char ch) STR_NOEXCEPT
+    {
+        return _mm256_set1_epi8(static_cast<char>(ch));
+    }
+
+    STR_SIMD_TARGET_AVX2 static __m256i cmpeq(__m256i a, __m256i b) STR_NOEXCEPT
+    {
+        return _mm256_cmpeq_epi8(a, b);
+    }
+};
+
+template <>
+struct avx2_ops<2>
+{
+    template <typename Char>
+    STR_SIMD_TARGET_AVX2 static __m256i set1(Char ch) STR_NOEXCEPT
+    {
+        return _mm256_set1_epi16(static_cast<short>(ch));
+    }
+
+    STR_SIMD_TARGET_AVX2 static __m256i cmpeq(__m256i a, __m256i b) STR_NOEXCEPT
+    {
+        return _mm256_cmpeq_epi16(a, b);
+    }
+};
+
+template <>
+struct avx2_ops<4>
+{
+    template <typename Char>
+    STR_SIMD_TARGET_AVX2 static __m256i set1(Char ch) STR_NOEXCEPT
+    {
+        return _mm256_set1_epi32(static_cast<int>(ch));
+    }
+
+    STR_SIMD_TARGET_AVX2 static __m256i cmpeq(__m256i a, __m256i b) STR_NOEXCEPT
+    {
+        return _mm256_cmpeq_epi32(a, b);
+    }
+};
+
+#endif
+#endif
+
+STR_NAMESPACE_DETAILS_END
+STR_NAMESPACE_MAIN_END
@@ -0,0 +1,499 @@
+#pragma once
+#include "str.hpp"
+#include "allocator.hpp"
+
+STR_NAMESPACE_MAIN_BEGIN
+
+/// String of three words with inline storage for short strings.
+/// Short strings are stored in place and the last byte holds the remaining
+/// inline capacity, so it doubles as the null terminator of a full buffer.
+/// Long strings are stored as { data, size, capacity } and the high bit of
+/// the last byte marks them as allocated.
+template <typename Char, typename CharTraits = std::char_traits<Char>, typename Allocator = std::allocator<Char>,
+          typename GrowthPolicy = default_growth>
+class basic_smallstr : public basic_str_core<basic_smallstr<Char, CharTraits, Allocator, GrowthPolicy>,
+                                             Char, CharTraits, Allocator>
+{
+    using this_t = basic_smallstr<Char, CharTraits, Allocator, GrowthPolicy>;
+
+public:
+    using base_t = basic_str_core<this_t, Char, CharTraits, Allocator>;
+    using growth_policy = GrowthPolicy;
+    using value_type = typename base_t::value_type;
+    using traits_type = typename base_t::traits_type;
+    using allocator_type = typename base_t::allocator_type;
+    using allocator_traits = typename base_t::allocator_traits;
+    using size_type = typename base_t::size_type;
+    using difference_type = typename base_t::difference_type;
+    using reference = typename base_t::reference;
+    using const_reference = typename base_t::const_reference;
+    using pointer = typename base_t::pointer;
+    using const_pointer = typename base_t::const_pointer;
+    using iterator = typename base_t::iterator;
+    using const_iterator = typename base_t::const_iterator;
+    using reverse_iterator = typename base_t::reverse_iterator;
+    using const_reverse_iterator = typename base_t::const_reverse_iterator;
+
+    using base_t::npos;
+    using base_t::operator=;
+    using base_t::resize;
+
+    friend base_t;
+
+    template <typename String>
+    friend class basic_str_adapter;
+
+protected:
+    struct heap_t
+    {
+        pointer data;
+        size_type size;
+        size_type capacity;
+    };
+
+    union repr_t
+    {
+        heap_t heap;
+        value_type buf[sizeof(heap_t) / sizeof(value_type)];
+        unsigned char bytes[sizeof(heap_t)];
+    };
+
+    static_assert(sizeof(heap_t) % sizeof(value_type) == 0, "value_type must divide the string layout");
+
+    static constexpr size_type control_byte_ = sizeof(repr_t) - 1;
+    static constexpr unsigned char heap_flag_ = 0x80;
+
+public:
+    /// Count of characters stored without allocating.
+    static constexpr size_type small_capacity = sizeof(repr_t) / sizeof(value_type) - 1;
+
+public:
+    //////////////////////////////////////////////////////////////////////
+    // CONSTRUCTORS / DESTRUCTOR
+    //////////////////////////////////////////////////////////////////////
+
+    STR_CONSTEXPR basic_smallstr(const Allocator &alloc = Allocator()) STR_NOEXCEPT
+        : storage_{alloc}
+    {
+        set_small_size_(0);
+    }
+
+    STR_CONSTEXPR basic_smallstr(const basic_smallstr &other)
+        : storage_{allocator_traits::select_on_container_copy_construction(other.alloc_())}
+    {
+        set_small_size_(0);
+        this->append(other.data(), other.size());
+    }
+
+    STR_CONSTEXPR basic_smallstr(basic_smallstr &&other) STR_NOEXCEPT
+        : storage_{std::move(other.alloc_())}
+    {
+        storage_.value = other.storage_.value;
+        other.set_small_size_(0);
+    }
+
+    STR_CONSTEXPR basic_smallstr(size_type size, const Allocator &alloc = Allocator())
+        : storage_{alloc}
+    {
+        set_small_size_(0);
+        resize(size);
+    }
+
+    STR_CONSTEXPR basic_smallstr(value_type ch, size_type count, const Allocator &alloc = Allocator())
+        : storage_{alloc}
+    {
+        set_small_size_(0);
+        this->append(ch, count);
+    }
+
+    STR_CONSTEXPR basic_smallstr(const value_type *s, const Allocator &alloc = Allocator())
+        : storage_{alloc}
+    {
+        set_small_size_(0);
+        this->append(s);
+    }
+
+    STR_CONSTEXPR basic_smallstr(const value_type *s, size_type count, const Allocator &alloc = Allocator())
+        : storage_{alloc}
+    {
+        set_small_size_(0);
+        this->append(s, count);
+    }
+
+    template <typename InputIt>
+    STR_CONSTEXPR basic_smallstr(InputIt first, InputIt last, const Allocator &alloc = Allocator())
+        : storage_{alloc}
+    {
+        set_small_size_(0);
+        this->append(first, last);
+    }
+
+    STR_CONSTEXPR basic_smallstr(std::initializer_list<value_type> ilist, const Allocator &alloc = Allocator())
+        : storage_{alloc}
+    {
+        set_small_size_(0);
+        this->append(ilist);
+    }
+
+    template <typename StringLike>
+    STR_CONSTEXPR basic_smallstr(const StringLike &str, size_type str_index = 0, const Allocator &alloc = Allocator())
+        : storage_{alloc}
+    {
+        set_small_size_(0);
+        this->append(str, str_index, npos);
+    }
+
+    template <typename StringLike>
+    STR_CONSTEXPR basic_smallstr(const StringLike &str, size_type str_index, size_type str_count = npos, const Allocator &alloc = Allocator())
+        : storage_{alloc}
+    {
+        set_small_size_(0);
+        this->append(str, str_index, str_count);
+    }
+
+    STR_CONSTEXPR ~basic_smallstr() STR_NOEXCEPT
+    {
+        if (is_heap())
+        {
+            deallocate_(storage_.value.heap.data, capacity());
+        }
+    }
+
+    STR_CONSTEXPR basic_smallstr &operator=(const basic_smallstr &other)
+    {
+        if (this == &other)
+            return *this;
+
+        if constexpr (allocator_traits::propagate_on_container_copy_assignment::value)
+        {
+            if constexpr (!allocator_traits::is_always_equal::value)
+            {
+                // memory of this string cannot be freed with the allocator of other
+                if (alloc_() != other.alloc_() && is_heap())
+                {
+                    deallocate_(storage_.value.heap.data, capacity());
+                    set_small_size_(0);
+                }
+            }
+
+            alloc_() = other.alloc_();
+        }
+
+        this->assign(other.data(), other.size());
+        return *this;
+    }
+
+    STR_CONSTEXPR basic_smallstr &operator=(basic_smallstr &&other) STR_NOEXCEPT_IF(
+        allocator_traits::propagate_on_container_move_assignment::value || allocator_traits::is_always_equal::value)
+    {
+        if (this == &other)
+            return *this;
+
+        if constexpr (!allocator_traits::propagate_on_container_move_assignment::value &&
+                      !allocator_traits::is_always_equal::value)
+        {
+            // memory of other cannot be freed with our allocator
+            if (alloc_() != other.alloc_())
+            {
+                this->assign(std::as_const(other).data(), other.size());
+                return *this;
+            }
+        }
+
+        if (is_heap())
+        {
+            deallocate_(storage_.value.heap.data, capacity());
+        }
+
+        if constexpr (allocator_traits::propagate_on_container_move_assignment::value)
+        {
+            alloc_() = std::move(other.alloc_());
+        }
+
+        storage_.value = other.storage_.value;
+        other.set_small_size_(0);
+        return *this;
+    }
+
+    //////////////////////////////////////////////////////////////////////
+    // ELEMENT ACCESS
+    //////////////////////////////////////////////////////////////////////
+
+    STR_CONSTEXPR pointer data() STR_NOEXCEPT
+    {
+        return is_small() ? storage_.value.buf : storage_.value.heap.data;
+    }
+
+    STR_CONSTEXPR const_pointer data() const STR_NOEXCEPT
+    {
+        return is_small() ? storage_.value.buf : storage_.value.heap.data;
+    }
+
+    //////////////////////////////////////////////////////////////////////
+    // CAPACITY
+    //////////////////////////////////////////////////////////////////////
+
+    STR_CONSTEXPR size_type size() const STR_NOEXCEPT
+    {
+        return is_small() ? small_capacity - storage_.value.bytes[control_byte_] : storage_.value.heap.size;
+    }
+
+    STR_CONSTEXPR size_type max_size() const STR_NOEXCEPT
+    {
+        return std::min<size_type>(allocator_traits::max_size(alloc_()), max_capacity_());
+    }
+
+    STR_CONSTEXPR size_type capacity() const STR_NOEXCEPT
+    {
+        return is_small() ? small_capacity : decode_capacity_(storage_.value.heap.capacity);
+    }
+
+    STR_CONSTEXPR allocator_type get_allocator() const STR_NOEXCEPT
+    {
+        return alloc_();
+    }
+
+    /// Checks whether the characters are stored inline.
+    STR_CONSTEXPR bool is_small() const STR_NOEXCEPT
+    {
+        return (storage_.value.bytes[control_byte_] & heap_flag_) == 0;
+    }
+
+    /// Checks whether the characters are stored on the heap.
+    STR_CONSTEXPR bool is_heap() const STR_NOEXCEPT
+    {
+        return !is_small();
+    }
+
+protected:
+    STR_CONSTEXPR void set_size_(size_type size) STR_NOEXCEPT
+    {
+        if (is_small())
+        {
+            set_small_size_(size);
+        }
+        else
+        {
+            storage_.value.heap.size = size;
+        }
+    }
+
+    /// The inline buffer is used as is, growth only applies once on the heap.
+    STR_CONSTEXPR size_type recommend_(size_type required) const STR_NOEXCEPT
+    {
+        if (required <= small_capacity)
+            return small_capacity;
+
+        return growth_policy::template grow<value_type, size_type>(capacity(), required, max_size());
+    }
+
+public:
+    //////////////////////////////////////////////////////////////////////
+    // OPERATIONS
+    //////////////////////////////////////////////////////////////////////
+
+    /// Exchanges the contents with other. The allocators are exchanged if they propagate
+    /// on swap, else they must compare equal.
+    STR_CONSTEXPR void swap(basic_smallstr &other) STR_NOEXCEPT
+    {
+        using std::swap;
+        if constexpr (allocator_traits::propagate_on_container_swap::value)
+        {
+            swap(alloc_(), other.alloc_());
+        }
+
+        swap(storage_.value, other.storage_.value);
+    }
+
+    STR_CONSTEXPR void resize(size_type cap, value_type ch)
+    {
+        resize_(cap, &ch);
+    }
+
+protected:
+    /// Sets the capacity to cap without initializing the new characters.
+    STR_CONSTEXPR void reserve_(size_type cap)
+    {
+        resize_(cap, nullptr);
+    }
+
+    /// Sets the capacity to cap, the new characters are set to *fill unless it is null.
+    STR_CONSTEXPR void resize_(size_type cap, const value_type *fill)
+    {
+        this->assert_length_(cap);
+
+        auto count = std::min(size(), cap);
+
+        // if the inline buffer is large enough, use it
+        if (cap <= small_capacity)
+        {
+            if (is_small())
+            {
+                if (fill)
+                {
+                    traits_type::assign(storage_.value.buf + count, cap - count, *fill);
+                }
+
+#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
+                storage_.value.buf[count] = value_type();
+#endif
+                set_small_size_(count);
+                return;
+            }
+
+            // the buffer overlaps the heap fields
+            auto heap = storage_.value.heap;
+
+            traits_type::copy(storage_.value.buf, heap.data, count);
+            if (fill)
+            {
+                traits_type::assign(storage_.value.buf + count, cap - count, *fill);
+            }
+
+#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
+            storage_.value.buf[count] = value_type();
+#endif
+            set_small_size_(count);
+
+            deallocate_(heap.data, decode_capacity_(heap.capacity));
+            return;
+        }
+
+        if (is_heap() && capacity() == cap)
+            return;
+
+        // requirement is larger than the inline buffer,
+        // so allocate on heap
+        pointer ptr = allocate_(cap);
+        traits_type::copy(ptr, data(), count);
+        if (fill)
+        {
+            traits_type::assign(ptr + count, cap - count, *fill);
+        }
+
+#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
+        ptr[count] = '\0';
+        ptr[cap] = '\0';
+#endif
+
+        if (is_heap())
+        {
+            deallocate_(storage_.value.heap.data, capacity());
+        }
+
+        storage_.value.heap.data = ptr;
+        storage_.value.heap.size = count;
+        storage_.value.heap.capacity = encode_capacity_(cap);
+    }
+
+    STR_CONSTEXPR allocator_type &alloc_() STR_NOEXCEPT
+    {
+        return storage_.allocator();
+    }
+
+    STR_CONSTEXPR const allocator_type &alloc_() const STR_NOEXCEPT
+    {
+        return storage_.allocator();
+    }
+
+    STR_CONSTEXPR pointer allocate_(size_type cap)
+    {
+#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
+        return allocator_traits::allocate(alloc_(), cap + 1);
+#else
+        return allocator_traits::allocate(alloc_(), cap);
+#endif
+    }
+
+    STR_CONSTEXPR void deallocate_(pointer ptr, size_type cap) STR_NOEXCEPT
+    {
+#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
+        allocator_traits::deallocate(alloc_(), ptr, cap + 1);
+#else
+        allocator_traits::deallocate(alloc_(), ptr, cap);
+#endif
+    }
+
+    /// Writes the inline size, the last character is cleared
+    /// so it terminates the string when the buffer is full.
+    STR_CONSTEXPR void set_small_size_(size_type size) STR_NOEXCEPT
+    {
+#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
+        // the buffer may still hold characters or the pointer of a moved string
+        storage_.value.buf[size] = value_type();
+#endif
+
+        storage_.value.buf[small_capacity] = value_type();
+        storage_.value.bytes[control_byte_] = static_cast<unsigned char>(small_capacity - size);
+    }
+
+    // the heap flag is the high bit of the last byte of the capacity word
+
+#ifdef STR_BIG_ENDIAN
+    static STR_CONSTEXPR size_type encode_capacity_(size_type cap) STR_NOEXCEPT
+    {
+        return (cap << 8) | heap_flag_;
+    }
+
+    static STR_CONSTEXPR size_type decode_capacity_(size_type word) STR_NOEXCEPT
+    {
+        return word >> 8;
+    }
+
+    static STR_CONSTEXPR size_type max_capacity_() STR_NOEXCEPT
+    {
+        return (size_type(-1) >> 8) - 1;
+    }
+#else
+    static STR_CONSTEXPR size_type encode_capacity_(size_type cap) STR_NOEXCEPT
+    {
+        return cap | (size_type(heap_flag_) << (sizeof(size_type) * 8 - 8));
+    }
+
+    static STR_CONSTEXPR size_type decode_capacity_(size_type word) STR_NOEXCEPT
+    {
+        return word & ~(size_type(heap_flag_) << (sizeof(size_type) * 8 - 8));
+    }
+
+    static STR_CONSTEXPR size_type max_capacity_() STR_NOEXCEPT
+    {
+        return (size_type(-1) >> 1) - 1;
+    }
+#endif
+
+protected:
+    details::alloc_storage<Allocator, repr_t> storage_;
+};
+
+/// Inline characters are addressed from the object, not through a pointer to it.
+template <typename Char, typename CharTraits, typename Allocator, typename GrowthPolicy>
+struct is_trivially_relocatable<basic_smallstr<Char, CharTraits, Allocator, GrowthPolicy>>
+    : is_trivially_relocatable<Allocator>
+{
+};
+
+//////////////////////////////////////////////////////////////////////
+// TypeDefs
+//////////////////////////////////////////////////////////////////////
+
+using smallstr = basic_smallstr<char>;
+using wsmallstr = basic_smallstr<wchar_t>;
+using u8smallstr = basic_smallstr<char8_t>;
+using u16smallstr = basic_smallstr<char16_t>;
+using u32smallstr = basic_smallstr<char32_t>;
+
+#ifdef STR_HAS_PMR
+namespace pmr
+{
+template <typename Char>
+using basic_smallstr = ::STR_NAMESPACE_MAIN::basic_smallstr<Char, std::char_traits<Char>, std::pmr::polymorphic_allocator<Char>>;
+
+using smallstr = basic_smallstr<char>;
+using wsmallstr = basic_smallstr<wchar_t>;
+using u8smallstr = basic_smallstr<char8_t>;
+using u16smallstr = basic_smallstr<char16_t>;
+using u32smallstr = basic_smallstr<char32_t>;
+}
+#endif
+
+STR_NAMESPACE_MAIN_END
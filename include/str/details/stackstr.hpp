@@ -3,14 +3,15 @@
 
 STR_NAMESPACE_MAIN_BEGIN
 
-template <size_t Size, typename Char, typename CharTraits = std::char_traits<char>,
+template <size_t Size, typename Char, typename CharTraits = std::char_traits<Char>,
           typename Allocator = std::allocator<Char>>
-class basic_stackstr : public basic_str<Char, CharTraits, std::allocator<Char>>
+class basic_stackstr : public basic_str_core<basic_stackstr<Size, Char, CharTraits, Allocator>,
+                                             Char, CharTraits, std::allocator<Char>>
 {
-    using this_t = basic_stackstr<Size, Char, CharTraits>;
+    using this_t = basic_stackstr<Size, Char, CharTraits, Allocator>;
 
 public:
-    using base_t = basic_str<Char, CharTraits, std::allocator<Char>>;
+    using base_t = basic_str_core<this_t, Char, CharTraits, std::allocator<Char>>;
     using value_type = typename base_t::value_type;
     using traits_type = typename base_t::traits_type;
     using allocator_type = typename base_t::allocator_type;
@@ -26,6 +27,15 @@ public:
     using reverse_iterator = typename base_t::reverse_iterator;
     using const_reverse_iterator = typename base_t::const_reverse_iterator;
 
+    using base_t::npos;
+    using base_t::operator=;
+    using base_t::resize;
+
+    friend base_t;
+
+    template <typename String>
+    friend class basic_str_adapter;
+
 public:
     //////////////////////////////////////////////////////////////////////
     // CONSTRUCTORS / DESTRUCTOR
@@ -40,53 +50,85 @@ public:
 #endif
     }
 
+    /// Copies the characters in use, not the whole buffer.
+    STR_CONSTEXPR basic_stackstr(const basic_stackstr &other) STR_NOEXCEPT
+    {
+        copy_(other);
+    }
+
+    /// Nothing can be taken from other, the characters in use are copied.
+    STR_CONSTEXPR basic_stackstr(basic_stackstr &&other) STR_NOEXCEPT
+    {
+        copy_(other);
+    }
+
     STR_CONSTEXPR ~basic_stackstr() STR_NOEXCEPT = default;
 
+    STR_CONSTEXPR basic_stackstr &operator=(const basic_stackstr &other) STR_NOEXCEPT
+    {
+        if (this != &other)
+        {
+            copy_(other);
+        }
+
+        return *this;
+    }
+
+    STR_CONSTEXPR basic_stackstr &operator=(basic_stackstr &&other) STR_NOEXCEPT
+    {
+        if (this != &other)
+        {
+            copy_(other);
+        }
+
+        return *this;
+    }
+
     STR_CONSTEXPR basic_stackstr(value_type ch)
     {
-        append(ch, Size);
+        this->append(ch, Size);
     }
     STR_CONSTEXPR basic_stackstr(value_type ch, size_type count)
     {
-        append(ch, count);
+        this->append(ch, count);
     }
 
     STR_CONSTEXPR basic_stackstr(const value_type *s)
     {
-        append(s);
+        this->append(s);
     }
     STR_CONSTEXPR basic_stackstr(const value_type *s, size_type count)
     {
-        append(s, count);
+        this->append(s, count);
     }
 
     template <typename InputIt>
     STR_CONSTEXPR basic_stackstr(InputIt first, InputIt last)
     {
-        append(first, last);
+        this->append(first, last);
     }
 
     STR_CONSTEXPR basic_stackstr(std::initializer_list<value_type> ilist)
     {
-        append(ilist);
+        this->append(ilist);
     }
 
     template <typename String>
     STR_CONSTEXPR basic_stackstr(const String &str, size_type str_index = 0, size_type str_count = npos)
     {
-        append(str, str_index, str_count);
+        this->append(str, str_index, str_count);
     }
 
     //////////////////////////////////////////////////////////////////////
     // ELEMENT ACCESS
     //////////////////////////////////////////////////////////////////////
 
-    STR_CONSTEXPR pointer data() STR_NOEXCEPT override
+    STR_CONSTEXPR pointer data() STR_NOEXCEPT
     {
         return data_;
     }
 
-    STR_CONSTEXPR const_pointer data() const STR_NOEXCEPT override
+    STR_CONSTEXPR const_pointer data() const STR_NOEXCEPT
     {
         return data_;
     }
@@ -95,22 +137,17 @@ public:
     // CAPACITY
     //////////////////////////////////////////////////////////////////////
 
-    STR_CONSTEXPR size_type size() const STR_NOEXCEPT override
+    STR_CONSTEXPR size_type size() const STR_NOEXCEPT
     {
         return size_;
     }
 
-    STR_CONSTEXPR void set_size_(size_type size) STR_NOEXCEPT override
-    {
-        size_ = size;
-    }
-
-    STR_CONSTEXPR size_type max_size() const STR_NOEXCEPT override
+    STR_CONSTEXPR size_type max_size() const STR_NOEXCEPT
     {
         return Size;
     }
 
-    STR_CONSTEXPR size_type capacity() const STR_NOEXCEPT override
+    STR_CONSTEXPR size_type capacity() const STR_NOEXCEPT
     {
         return Size;
     }
@@ -119,7 +156,24 @@ public:
     // OPERATIONS
     //////////////////////////////////////////////////////////////////////
 
-    STR_CONSTEXPR void resize(size_type count, value_type c) override {}
+    STR_CONSTEXPR void resize(size_type, value_type) {}
+
+protected:
+    STR_CONSTEXPR void set_size_(size_type size) STR_NOEXCEPT
+    {
+        size_ = size;
+    }
+
+    STR_CONSTEXPR void copy_(const basic_stackstr &other) STR_NOEXCEPT
+    {
+        size_ = other.size_;
+        traits_type::copy(data_, other.data_, size_);
+
+#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
+        data_[size_] = '\0';
+        data_[Size] = '\0';
+#endif
+    }
 
 protected:
 #ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
@@ -131,6 +185,12 @@ protected:
     size_type size_ = 0;
 };
 
+/// The characters are stored inline, without a pointer to them.
+template <size_t Size, typename Char, typename CharTraits, typename Allocator>
+struct is_trivially_relocatable<basic_stackstr<Size, Char, CharTraits, Allocator>> : std::true_type
+{
+};
+
 //////////////////////////////////////////////////////////////////////
 // operator +
 //////////////////////////////////////////////////////////////////////
@@ -171,12 +231,22 @@ using u32stackstr = basic_stackstr<Size, char32_t>;
 // Numeric Conversions
 //////////////////////////////////////////////////////////////////////
 
-template <typename Int>
+template <typename Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
 stackstr<21> to_stackstr(Int value)
 {
-    stackstr<21> str; // can hold -2^63 and 2^64 - 1, plus NUL
-    details::convert_num_to_str(str.data(), str.size(), value);
+    static_assert(details::max_num_chars<Int> <= 21, "Int does not fit in stackstr<21>");
+
+    stackstr<21> str; // can hold -2^63 and 2^64 - 1
+    str.append_int(value);
+    return str;
+}
+
+template <typename Float, std::enable_if_t<std::is_floating_point_v<Float>, int> = 0>
+stackstr<24> to_stackstr(Float value)
+{
+    stackstr<24> str; // can hold the shortest form of any double, -2.2250738585072014e-308
+    str.append_float(value);
     return str;
 }
 
-STR_NAMESPACE_MAIN_END
\ No newline at end of file
+STR_NAMESPACE_MAIN_END
@@ -1,22 +1,99 @@
 #pragma once
 #include "common.hpp"
 #include "details.hpp"
+#include "floating.hpp"
+#include "search.hpp"
+#include "charset.hpp"
+#include "growth.hpp"
 #include "strtraits.hpp"
+#include "stredit.hpp"
+#include <algorithm>
 #include <type_traits>
 #include <exception>
 #include <stdexcept>
 #include <memory>
+#include <functional>
+#include <tuple>
+#include <utility>
 #include <iostream>
+#include <iterator>
+#include <locale>
+#include <cstring>
+#include <new>
+
+#ifdef STR_HAS_PMR
+#include <memory_resource>
+#endif
 
 STR_NAMESPACE_MAIN_BEGIN
 
-template <typename Char, typename CharTraits = std::char_traits<Char>, typename Allocator = std::allocator<Char>>
-class basic_str
+template <typename Char, typename CharTraits = std::char_traits<Char>>
+class basic_strview;
+
+template <typename Char, typename CharTraits, typename Lhs, typename Rhs>
+class basic_strconcat;
+
+/// Checks whether a T can be moved to another address by copying its bytes,
+/// the source being then forgotten instead of destroyed. Trivially copyable types
+/// can, strings holding no pointer into themselves are specialized to.
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T>
+{
+};
+
+template <typename T>
+struct is_trivially_relocatable<std::allocator<T>> : std::true_type
+{
+};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+/// Moves [first, last) to the uninitialized storage at dest and ends the source objects,
+/// as containers do when they reallocate. Trivially relocatable elements are copied
+/// with one memcpy, others are move constructed then destroyed one by one.
+/// @return the end of the relocated range
+template <typename T>
+T *relocate(T *first, T *last, T *dest) STR_NOEXCEPT_IF(is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>)
+{
+    if constexpr (is_trivially_relocatable_v<T>)
+    {
+        auto count = static_cast<std::size_t>(last - first);
+        if (count)
+        {
+            std::memcpy(static_cast<void *>(dest), static_cast<const void *>(first), count * sizeof(T));
+        }
+
+        return dest + count;
+    }
+    else
+    {
+        for (; first != last; ++first, ++dest)
+        {
+            ::new (static_cast<void *>(dest)) T(std::move(*first));
+            first->~T();
+        }
+
+        return dest;
+    }
+}
+
+/// Statically dispatched core shared by all the string types.
+/// Derived provides the storage through data(), size(), max_size(), capacity(),
+/// resize(count, ch) and set_size_(size), and may hide recommend_(required)
+/// and reserve_(cap).
+/// Calls to them are resolved at compile time, so they can be inlined
+/// and the strings do not carry a vtable.
+template <typename Derived, typename Char, typename CharTraits = std::char_traits<Char>,
+          typename Allocator = std::allocator<Char>>
+class basic_str_core
 {
 public:
     class iterator;
     class const_iterator;
+    class append_span;
 
+    using derived_type = Derived;
     using value_type = Char;
     using traits_type = CharTraits;
     using allocator_type = Allocator;
@@ -36,10 +113,24 @@ public:
     //////////////////////////////////////////////////////////////////////
     // BASE
     //////////////////////////////////////////////////////////////////////
-    STR_CONSTEXPR basic_str &base() STR_NOEXCEPT
+    STR_CONSTEXPR basic_str_core &base() STR_NOEXCEPT
     {
         return *this;
     }
+    STR_CONSTEXPR const basic_str_core &base() const STR_NOEXCEPT
+    {
+        return *this;
+    }
+
+    /// Returns the string as its concrete type.
+    STR_CONSTEXPR Derived &derived() STR_NOEXCEPT
+    {
+        return static_cast<Derived &>(*this);
+    }
+    STR_CONSTEXPR const Derived &derived() const STR_NOEXCEPT
+    {
+        return static_cast<const Derived &>(*this);
+    }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// ELEMENT ACCESS
@@ -94,8 +185,15 @@ public:
     }
 
     /// Returns a pointer to the first character of a string.
-    STR_CONSTEXPR_VFUNC pointer data() STR_NOEXCEPT = 0;
-    STR_CONSTEXPR_VFUNC const_pointer data() const STR_NOEXCEPT = 0;
+    /// Strings sharing their buffer may copy it here, before it is written.
+    STR_CONSTEXPR pointer data() STR_NOEXCEPT_IF(STR_NOEXCEPT_IF(std::declval<Derived &>().data()))
+    {
+        return derived().data();
+    }
+    STR_CONSTEXPR const_pointer data() const STR_NOEXCEPT
+    {
+        return derived().data();
+    }
 
     /// Returns a const pointer to the first character of a string.
     STR_CONSTEXPR const_pointer c_str() const STR_NOEXCEPT
@@ -114,7 +212,7 @@ public:
     }
 
     /// Returns an iterator to the given index.
-    STR_CONSTEXPR iterator it(size_type index) STR_NOEXCEPT
+    STR_CONSTEXPR iterator it(size_type index) STR_NOEXCEPT_IF(STR_NOEXCEPT_IF(std::declval<Derived &>().data()))
     {
         return iterator(data() + index);
     }
@@ -128,7 +226,7 @@ public:
     }
 
     /// Returns an iterator to the first character of the string.
-    STR_CONSTEXPR iterator begin() STR_NOEXCEPT
+    STR_CONSTEXPR iterator begin() STR_NOEXCEPT_IF(STR_NOEXCEPT_IF(std::declval<Derived &>().data()))
     {
         return it(0);
     }
@@ -142,7 +240,7 @@ public:
     }
 
     /// Returns an iterator to the character following the last character of the string (null character).
-    STR_CONSTEXPR iterator end() STR_NOEXCEPT
+    STR_CONSTEXPR iterator end() STR_NOEXCEPT_IF(STR_NOEXCEPT_IF(std::declval<Derived &>().data()))
     {
         return it(size());
     }
@@ -157,7 +255,7 @@ public:
 
     /// Returns a reverse iterator to the given index.
     /// Indexing starts in reverse order
-    STR_CONSTEXPR reverse_iterator rit(size_type index) STR_NOEXCEPT
+    STR_CONSTEXPR reverse_iterator rit(size_type index) STR_NOEXCEPT_IF(STR_NOEXCEPT_IF(std::declval<Derived &>().data()))
     {
         return reverse_iterator(it(size() - index));
     }
@@ -171,7 +269,7 @@ public:
     }
 
     /// Returns a reverse iterator to the first character of the reversed string.
-    STR_CONSTEXPR reverse_iterator rbegin() STR_NOEXCEPT
+    STR_CONSTEXPR reverse_iterator rbegin() STR_NOEXCEPT_IF(STR_NOEXCEPT_IF(std::declval<Derived &>().data()))
     {
         return rit(0);
     }
@@ -185,7 +283,7 @@ public:
     }
 
     /// Returns a reverse iterator to the character following the last character of the reversed string.
-    STR_CONSTEXPR reverse_iterator rend() STR_NOEXCEPT
+    STR_CONSTEXPR reverse_iterator rend() STR_NOEXCEPT_IF(STR_NOEXCEPT_IF(std::declval<Derived &>().data()))
     {
         return rit(size());
     }
@@ -209,25 +307,47 @@ public:
     }
 
     /// Returns the count of characters.
-    STR_CONSTEXPR_VFUNC size_type size() const STR_NOEXCEPT = 0;
+    STR_CONSTEXPR size_type size() const STR_NOEXCEPT
+    {
+        return derived().size();
+    }
     STR_CONSTEXPR size_type length() const STR_NOEXCEPT
     {
         return size();
     }
 
     /// Returns the maximum number of elements the string is able to hold.
-    STR_CONSTEXPR_VFUNC size_type max_size() const STR_NOEXCEPT = 0;
+    STR_CONSTEXPR size_type max_size() const STR_NOEXCEPT
+    {
+        return derived().max_size();
+    }
 
     /// Returns the number of characters that the string has currently allocated space for.
-    STR_CONSTEXPR_VFUNC size_type capacity() const STR_NOEXCEPT = 0;
+    STR_CONSTEXPR size_type capacity() const STR_NOEXCEPT
+    {
+        return derived().capacity();
+    }
 
     /// Reserves at least new_cap storage.
     /// If new_cap is less than or equal to the current capacity(), there is no effect.
+    /// The allocated capacity is decided by the growth policy of the string,
+    /// so repeated appends reallocate amortized O(1) times.
     STR_CONSTEXPR void reserve(size_type required)
     {
         if (capacity() < required)
         {
-            resize(required);
+            derived().reserve_(derived().recommend_(required));
+        }
+    }
+
+    /// Reserves exactly new_cap storage, bypassing the growth policy. Heap strings may
+    /// still get more, up to what the allocator block holds.
+    /// If new_cap is less than or equal to the current capacity(), there is no effect.
+    STR_CONSTEXPR void reserve_exact(size_type required)
+    {
+        if (capacity() < required)
+        {
+            derived().reserve_(required);
         }
     }
 
@@ -237,16 +357,44 @@ public:
         if (size() == capacity())
             return;
 
-        resize(size());
+        derived().reserve_(size());
     }
 
+    /// Returns the allocator, strings which store one hide it.
     STR_CONSTEXPR allocator_type get_allocator() const STR_NOEXCEPT
     {
         return allocator_type();
     }
 
 protected:
-    STR_CONSTEXPR_VFUNC void set_size_(size_type size) STR_NOEXCEPT = 0;
+    STR_CONSTEXPR void set_size_(size_type size) STR_NOEXCEPT
+    {
+        derived().set_size_(size);
+    }
+
+    /// Returns the capacity to allocate to hold at least required characters.
+    /// Derived hides it to apply its growth policy.
+    STR_CONSTEXPR size_type recommend_(size_type required) const STR_NOEXCEPT
+    {
+        return required;
+    }
+
+    /// Sets the capacity to cap, the characters past size() are left unspecified.
+    /// Derived hides it to skip filling them like resize(count, ch) does.
+    STR_CONSTEXPR void reserve_(size_type cap)
+    {
+        resize(cap);
+    }
+
+    /// Terminates the characters at size() once they were written in place.
+    STR_CONSTEXPR void commit_size_(size_type size) STR_NOEXCEPT
+    {
+        set_size_(size);
+
+#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
+        data()[size] = '\0';
+#endif
+    }
 
 public:
     /////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -270,56 +418,73 @@ public:
     //////////////////////////////////////////////////////////////////////
 
     /// Inserts character ch before the character pointed by index.
-    STR_CONSTEXPR basic_str &insert(size_type index, value_type ch)
+    STR_CONSTEXPR Derived &insert(size_type index, value_type ch)
     {
         insert_(index, ch, 1);
-        return *this;
+        return derived();
     }
 
     /// Inserts count copies of character ch at the position index
-    STR_CONSTEXPR_VFUNC basic_str &insert(size_type index, value_type ch, size_type count)
+    STR_CONSTEXPR Derived &insert(size_type index, value_type ch, size_type count)
     {
         insert_(index, ch, count);
-        return *this;
+        return derived();
     }
 
     /// Inserts null-terminated character string pointed to by s at the position index.
     /// the length of the string is determined by the first null character using CharTraits::length(s).
-    STR_CONSTEXPR basic_str &insert(size_type index, const value_type *s)
+    STR_CONSTEXPR Derived &insert(size_type index, const value_type *s)
     {
         insert_(index, s, traits_type::length(s));
-        return *this;
+        return derived();
     }
 
     /// Inserts the characters in the range [s, s+count) at the position index.
     /// the range can contain null characters.
-    STR_CONSTEXPR basic_str &insert(size_type index, const value_type *s, size_type count)
+    STR_CONSTEXPR Derived &insert(size_type index, const value_type *s, size_type count)
     {
         insert_(index, s, count);
-        return *this;
+        return derived();
     }
 
     /// Inserts characters from the range [first, last) before the element (if any) pointed by index.
     template <typename InputIt>
-    STR_CONSTEXPR basic_str &insert(size_type index, InputIt first, InputIt last)
+    STR_CONSTEXPR Derived &insert(size_type index, InputIt first, InputIt last)
     {
-        insert_(index, first, static_cast<size_type>(std::distance(first, last)));
-        return *this;
+        using category = typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (std::is_same_v<category, std::input_iterator_tag>)
+        {
+            // single pass, like istreambuf_iterator: the count is not known up front
+            assert_range_(index);
+            auto len = size();
+            for (; first != last; ++first)
+            {
+                push_back(*first);
+            }
+
+            std::rotate(begin() + index, begin() + len, end());
+        }
+        else
+        {
+            insert_(index, first, static_cast<size_type>(std::distance(first, last)));
+        }
+
+        return derived();
     }
 
     /// Inserts elements from initializer list ilist before the element (if any) pointed by pos
-    STR_CONSTEXPR basic_str &insert(size_type index, std::initializer_list<value_type> ilist)
+    STR_CONSTEXPR Derived &insert(size_type index, std::initializer_list<value_type> ilist)
     {
         insert_(index, ilist.begin(), static_cast<size_type>(ilist.size()));
-        return *this;
+        return derived();
     }
 
     template <typename StringLike>
-    STR_CONSTEXPR basic_str &insert(size_type index, const StringLike &str, size_type str_index = 0, size_type str_count = npos)
+    STR_CONSTEXPR Derived &insert(size_type index, const StringLike &str, size_type str_index = 0, size_type str_count = npos)
     {
         auto tup = getdata_(str);
         auto str_size = std::get<1>(tup);
-        assert_range_(index, 0, str_size, "'str_index' was out of range[0, str.size()] for 'str'");
+        assert_range_(str_index, 0, str_size, "'str_index' was out of range[0, str.size()] for 'str'");
 
         if (str_count == npos || str_count > str_size - str_index)
         {
@@ -327,7 +492,7 @@ public:
         }
 
         insert_(index, std::get<0>(tup) + str_index, str_count);
-        return *this;
+        return derived();
     }
 
     /// Inserts character ch before the character pointed by pos.
@@ -390,67 +555,34 @@ public:
     }
 
 protected:
-    STR_CONSTEXPR_VFUNC void insert_(size_type index, size_type count)
-    {
-        assert_length_(index, "'index' was out of 'max_length'");
-        assert_length_(count, "'count' was out of 'max_length'");
-        assert_range_(index, "'index' was out of range");
-
-        auto len = size();
-        reserve(len + count);
-
-        assert_space_(count);
-        auto ptr = data();
-
-        // pos of new null character
-        size_type i = len + count - 1;
-
-        // write null character
-        ptr[i--] = '\0';
-
-        // move characters back
-        for (; i >= index + count; i--)
-            ptr[i] = ptr[i - count];
-
-        set_size_(len + count);
-    }
-
     STR_CONSTEXPR void insert_(size_type index, value_type ch, size_type count)
     {
-        insert_(index, count);
-
-        /// write character
-        auto ptr = data() + index;
-        for (size_type i = 0; i < count; i++)
-        {
-            ptr[i] = ch;
-        }
+        replace_(index, 0, ch, count);
     }
 
     STR_CONSTEXPR void insert_(size_type index, const value_type *s, size_type count)
     {
         assert_null_(s, "cannot insert null string");
-        insert_(index, count);
-
-        /// write string
-        auto ptr = data() + index;
-        for (size_type i = 0; i < count; i++)
-        {
-            ptr[i] = s[i];
-        }
+        replace_(index, 0, s, count);
     }
 
     template <typename It>
     STR_CONSTEXPR void insert_(size_type index, It it, size_type count)
     {
-        insert_(index, count);
-
-        /// write string
-        auto ptr = data() + index;
-        for (size_type i = 0; i < count; i++)
+        if constexpr (std::is_convertible_v<It, const_iterator>)
         {
-            ptr[i] = *it;
-            it++;
+            // contiguous, it may point into this string
+            replace_(index, 0, const_iterator(it).operator->(), count);
+        }
+        else
+        {
+            /// write string
+            auto ptr = replace_(index, 0, count);
+            for (size_type i = 0; i < count; i++)
+            {
+                ptr[i] = *it;
+                it++;
+            }
         }
     }
 
@@ -460,17 +592,17 @@ public:
     //////////////////////////////////////////////////////////////////////
 
     /// Removes the character at index
-    STR_CONSTEXPR basic_str &erase(size_type index)
+    STR_CONSTEXPR Derived &erase(size_type index)
     {
         erase_(index, 1);
-        return *this;
+        return derived();
     }
 
     /// Removes the characters in the range [index, index+count)
-    STR_CONSTEXPR basic_str &erase(size_type index, size_type count)
+    STR_CONSTEXPR Derived &erase(size_type index, size_type count)
     {
         erase_(index, count);
-        return *this;
+        return derived();
     }
 
     /// Removes the character at position
@@ -494,26 +626,274 @@ public:
     {
         auto i = toindex(first);
         auto count = static_cast<size_type>(std::distance(first, last));
-        return erase(i, count);
-        return it(1);
+        erase(i, count);
+        return it(i);
+    }
+
+protected:
+    STR_CONSTEXPR void erase_(size_type index, size_type count)
+    {
+        replace_(index, count, 0);
+    }
+
+public:
+    //////////////////////////////////////////////////////////////////////
+    /// replace
+    //////////////////////////////////////////////////////////////////////
+
+    /// Replaces the characters in the range [index, index+count) with count2 copies of character ch
+    STR_CONSTEXPR Derived &replace(size_type index, size_type count, value_type ch, size_type count2)
+    {
+        replace_(index, count, ch, count2);
+        return derived();
+    }
+
+    /// Replaces the characters in the range [index, index+count) with the null-terminated character string s
+    STR_CONSTEXPR Derived &replace(size_type index, size_type count, const value_type *s)
+    {
+        assert_null_(s, "cannot replace with null string");
+        replace_(index, count, s, traits_type::length(s));
+        return derived();
+    }
+
+    /// Replaces the characters in the range [index, index+count) with the characters in the range [s, s+count2)
+    STR_CONSTEXPR Derived &replace(size_type index, size_type count, const value_type *s, size_type count2)
+    {
+        assert_null_(s, "cannot replace with null string");
+        replace_(index, count, s, count2);
+        return derived();
+    }
+
+    /// Replaces the characters in the range [index, index+count) with the initializer list ilist
+    STR_CONSTEXPR Derived &replace(size_type index, size_type count, std::initializer_list<value_type> ilist)
+    {
+        replace_(index, count, ilist.begin(), static_cast<size_type>(ilist.size()));
+        return derived();
+    }
+
+    /// Replaces the characters in the range [index, index+count) with the substring [str_index, str_index+str_count) of str
+    template <typename StringLike>
+    STR_CONSTEXPR Derived &replace(size_type index, size_type count, const StringLike &str, size_type str_index = 0, size_type str_count = npos)
+    {
+        auto tup = getdata_(str);
+        auto str_size = std::get<1>(tup);
+        assert_range_(str_index, 0, str_size, "'str_index' was out of range[0, str.size()] for 'str'");
+
+        if (str_count == npos || str_count > str_size - str_index)
+        {
+            str_count = str_size - str_index;
+        }
+
+        replace_(index, count, std::get<0>(tup) + str_index, str_count);
+        return derived();
+    }
+
+    /// Replaces the characters in the range [first, last) with count2 copies of character ch
+    STR_CONSTEXPR Derived &replace(const_iterator first, const_iterator last, value_type ch, size_type count2)
+    {
+        return replace(toindex(first), static_cast<size_type>(std::distance(first, last)), ch, count2);
+    }
+
+    /// Replaces the characters in the range [first, last) with the null-terminated character string s
+    STR_CONSTEXPR Derived &replace(const_iterator first, const_iterator last, const value_type *s)
+    {
+        return replace(toindex(first), static_cast<size_type>(std::distance(first, last)), s);
+    }
+
+    /// Replaces the characters in the range [first, last) with the characters in the range [s, s+count2)
+    STR_CONSTEXPR Derived &replace(const_iterator first, const_iterator last, const value_type *s, size_type count2)
+    {
+        return replace(toindex(first), static_cast<size_type>(std::distance(first, last)), s, count2);
+    }
+
+    /// Replaces the characters in the range [first, last) with the initializer list ilist
+    STR_CONSTEXPR Derived &replace(const_iterator first, const_iterator last, std::initializer_list<value_type> ilist)
+    {
+        return replace(toindex(first), static_cast<size_type>(std::distance(first, last)), ilist);
+    }
+
+    /// Replaces the characters in the range [first, last) with str
+    template <typename StringLike>
+    STR_CONSTEXPR Derived &replace(const_iterator first, const_iterator last, const StringLike &str)
+    {
+        return replace(toindex(first), static_cast<size_type>(std::distance(first, last)), str);
     }
 
 protected:
-    STR_CONSTEXPR_VFUNC void erase_(size_type index, size_type count)
+    /// Resizes the range [index, index+count) to count2 characters,
+    /// the tail is moved with a single traits_type::move.
+    /// @return pointer to the resized range, its content is unspecified.
+    STR_CONSTEXPR pointer replace_(size_type index, size_type count, size_type count2)
     {
         assert_range_(index);
-        count = std::min(size() - index, count);
+
+        auto len = size();
+        count = std::min(len - index, count);
+        if (count == 0 && count2 == 0)
+            return data() + index;
+
+        assert_<std::length_error>(count2 <= max_size() - (len - count), "'max_length' reached");
+
+        auto new_len = len - count + count2;
+        reserve(new_len);
+        assert_<std::length_error>(new_len <= capacity(), "not enough space");
+
+        auto ptr = data();
+
+        // move the tail, [index + count, len) to [index + count2, new_len)
+        if (count != count2)
+            traits_type::move(ptr + index + count2, ptr + index + count, len - index - count);
+
+#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
+        // write null character
+        ptr[new_len] = '\0';
+#endif
+
+        set_size_(new_len);
+        return ptr + index;
+    }
+
+    STR_CONSTEXPR void replace_(size_type index, size_type count, value_type ch, size_type count2)
+    {
+        traits_type::assign(replace_(index, count, count2), count2, ch);
+    }
+
+    STR_CONSTEXPR void replace_(size_type index, size_type count, const value_type *s, size_type count2)
+    {
+        // the string is only read here, so shared buffers are not copied
+        auto first = std::as_const(derived()).data();
+        auto len = size();
+
+        if (!(std::less_equal<const value_type *>()(first, s) && std::less<const value_type *>()(s, first + len)))
+        {
+            traits_type::copy(replace_(index, count, count2), s, count2);
+            return;
+        }
+
+        // s points into this string, it is found again after the buffer is
+        // reallocated and shifted with the tail when it lies behind the range
+        auto offset = static_cast<size_type>(s - first);
+
+        assert_range_(index);
+        count = std::min(len - index, count);
+
+        if (count2 <= count)
+        {
+            // the tail is not moved yet, s is still in place
+            auto ptr = data();
+            traits_type::move(ptr + index, ptr + offset, count2);
+            replace_(index, count, count2);
+            return;
+        }
+
+        auto dest = replace_(index, count, count2);
+        auto src = data() + offset;
+        auto end = dest + count;
+
+        if (src + count2 <= end)
+        {
+            // before the end of the range, not moved
+            traits_type::move(dest, src, count2);
+        }
+        else if (src >= end)
+        {
+            // in the tail, moved by count2 - count
+            traits_type::copy(dest, src + (count2 - count), count2);
+        }
+        else
+        {
+            // split by the end of the range
+            auto left = static_cast<size_type>(end - src);
+            traits_type::move(dest, src, left);
+            traits_type::copy(dest + left, dest + count2, count2 - left);
+        }
+    }
+
+public:
+    //////////////////////////////////////////////////////////////////////
+    /// apply
+    //////////////////////////////////////////////////////////////////////
+
+    /// Applies a batch of edits recorded against the offsets of this string.
+    /// The string is reserved once and every kept character is moved once,
+    /// instead of shifting the tail on every edit.
+    /// std::out_of_range is thrown if the edits overlap or are out of range.
+    STR_CONSTEXPR Derived &apply(const basic_stredit<value_type, traits_type> &edits)
+    {
+        auto len = size();
+
+        // validate and compute the new size
+        size_type pos = 0;
+        size_type erased = 0;
+        size_type inserted = 0;
+        for (auto &edit : edits)
+        {
+            assert_range_(edit.offset, pos, len, "edit overlaps the previous edit or is out of range");
+
+            auto count = std::min(len - edit.offset, edit.erase);
+            assert_<std::length_error>(edit.data_size <= max_size() - inserted, "'max_length' reached");
+
+            pos = edit.offset + count;
+            erased += count;
+            inserted += edit.data_size;
+        }
+
+        assert_<std::length_error>(inserted <= max_size() - (len - erased), "'max_length' reached");
+
+        auto new_len = len - erased + inserted;
+        reserve(new_len);
+        assert_<std::length_error>(new_len <= capacity(), "not enough space");
 
         auto ptr = data();
 
-        // move characters forward
-        for (size_type i = index; i < index + count; i++)
-            ptr[i] = ptr[i + count];
+        // the kept ranges move by the sum of the edits before them,
+        // ranges moving left are moved left to right and ranges moving right
+        // are moved right to left, so no range overwrites one not moved yet
+        difference_type shift = 0;
+        size_type src = 0;
+        for (auto &edit : edits)
+        {
+            if (shift < 0)
+                traits_type::move(ptr + src + shift, ptr + src, edit.offset - src);
+
+            auto count = std::min(len - edit.offset, edit.erase);
+            shift += static_cast<difference_type>(edit.data_size) - static_cast<difference_type>(count);
+            src = edit.offset + count;
+        }
+
+        if (shift < 0)
+            traits_type::move(ptr + src + shift, ptr + src, len - src);
+
+        auto end = len;
+        for (auto edit = edits.end(); edit != edits.begin();)
+        {
+            --edit;
+
+            auto count = std::min(len - edit->offset, edit->erase);
+            auto first = edit->offset + count;
+
+            if (shift > 0)
+                traits_type::move(ptr + first + shift, ptr + first, end - first);
+
+            shift -= static_cast<difference_type>(edit->data_size) - static_cast<difference_type>(count);
+            end = edit->offset;
+        }
+
+        // write the inserted characters
+        for (auto &edit : edits)
+        {
+            auto count = std::min(len - edit.offset, edit.erase);
+            traits_type::copy(ptr + edit.offset + shift, edits.data(edit), edit.data_size);
+            shift += static_cast<difference_type>(edit.data_size) - static_cast<difference_type>(count);
+        }
 
+#ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
         // write null character
-        ptr[index + count] = '\0';
+        ptr[new_len] = '\0';
+#endif
 
-        set_size_(size() - count);
+        set_size_(new_len);
+        return derived();
     }
 
 public:
@@ -536,7 +916,8 @@ public:
     /// no effect if string is empty
     STR_CONSTEXPR void pop_back()
     {
-        erase(size(), 1);
+        if (!empty())
+            erase(size() - 1, 1);
     }
 
     //////////////////////////////////////////////////////////////////////
@@ -544,70 +925,134 @@ public:
     //////////////////////////////////////////////////////////////////////
 
     /// appends character c
-    STR_CONSTEXPR basic_str &append(value_type c)
+    STR_CONSTEXPR Derived &append(value_type c)
     {
         return insert(size(), c);
     }
 
     /// appends count copies of character c
-    STR_CONSTEXPR basic_str &append(value_type c, size_type count)
+    STR_CONSTEXPR Derived &append(value_type c, size_type count)
     {
         return insert(size(), c, count);
     }
 
     /// appends the null-terminated character string pointed to by s.
-    STR_CONSTEXPR basic_str &append(const value_type *s)
+    STR_CONSTEXPR Derived &append(const value_type *s)
     {
         return insert(size(), s);
     }
 
     /// appends characters in the range [s, s + count).
     /// this range can contain null characters.
-    STR_CONSTEXPR basic_str &append(const value_type *s, size_type count)
+    STR_CONSTEXPR Derived &append(const value_type *s, size_type count)
     {
         return insert(size(), s, count);
     }
 
     /// appends characters in the range [first, last).
     template <typename InputIt>
-    STR_CONSTEXPR basic_str &append(InputIt first, InputIt last)
+    STR_CONSTEXPR Derived &append(InputIt first, InputIt last)
     {
         return insert(size(), first, last);
     }
 
     /// appends characters from the initializer list ilist.
-    STR_CONSTEXPR basic_str &append(std::initializer_list<value_type> ilist)
+    STR_CONSTEXPR Derived &append(std::initializer_list<value_type> ilist)
     {
         return insert(size(), ilist);
     }
 
     template <typename StringLike>
-    STR_CONSTEXPR basic_str &append(const StringLike &str, size_type str_index = 0, size_type str_count = npos)
+    STR_CONSTEXPR Derived &append(const StringLike &str, size_type str_index = 0, size_type str_count = npos)
     {
         return insert(size(), str, str_index, str_count);
     }
 
+    /// appends the concatenation expr made by operator+, its size is computed once
+    /// and every part is written in place.
+    template <typename Lhs, typename Rhs>
+    STR_CONSTEXPR Derived &append(const basic_strconcat<value_type, traits_type, Lhs, Rhs> &expr)
+    {
+        // parts viewing this string are read where replace_ moved its characters
+        auto first = std::as_const(derived()).data();
+        auto len = size();
+
+        auto ptr = replace_(len, 0, expr.size());
+        expr.write(ptr, first, first + len, ptr - len);
+        return derived();
+    }
+
+    template <typename Lhs, typename Rhs>
+    STR_CONSTEXPR Derived &append(const basic_strconcat<value_type, traits_type, Lhs, Rhs> &expr,
+                                  size_type str_index, size_type str_count = npos)
+    {
+        if (str_index == 0 && str_count == npos)
+        {
+            return append(expr);
+        }
+
+        auto expr_size = expr.size();
+        assert_range_(str_index, 0, expr_size, "'str_index' was out of range[0, str.size()] for 'str'");
+
+        if (str_count == npos || str_count > expr_size - str_index)
+        {
+            str_count = expr_size - str_index;
+        }
+
+        auto len = size();
+        append(expr);
+        erase(len + str_index + str_count, expr_size - str_index - str_count);
+        return erase(len, str_index);
+    }
+
+    /// appends the integer value written in base, digits above 9 are lowercase letters.
+    /// the digits are written in place, no temporary string is made.
+    template <typename Int>
+    STR_CONSTEXPR Derived &append_int(Int value, unsigned base = 10)
+    {
+        assert_<std::invalid_argument>(base >= 2 && base <= 36, "'base' was out of range [2, 36]");
+
+        auto count = details::count_num_chars(value, base);
+        details::write_num(replace_(size(), 0, count), count, value, base);
+        return derived();
+    }
+
+    /// appends the floating point value in fmt. without a precision the digits are the
+    /// shortest ones that read back to value, else it is the count of digits after the
+    /// decimal point, or of significant digits for general, like printf.
+    /// the characters are written in place, no temporary string or heap allocation is made.
+    template <typename Float>
+    STR_CONSTEXPR Derived &append_float(Float value, float_format fmt = float_format::general, int precision = -1)
+    {
+        details::float_chars chars;
+        details::to_float_chars(chars, value, fmt, precision);
+
+        auto count = details::write_float_chars<value_type>(nullptr, chars);
+        details::write_float_chars(replace_(size(), 0, count), chars);
+        return derived();
+    }
+
     //////////////////////////////////////////////////////////////////////
     /// operator+=
     //////////////////////////////////////////////////////////////////////
 
-    STR_CONSTEXPR basic_str &operator+=(value_type ch)
+    STR_CONSTEXPR Derived &operator+=(value_type ch)
     {
         return append(ch);
     }
 
-    STR_CONSTEXPR basic_str &operator+=(const value_type *s)
+    STR_CONSTEXPR Derived &operator+=(const value_type *s)
     {
         return append(s);
     }
 
-    STR_CONSTEXPR basic_str &operator+=(std::initializer_list<value_type> ilist)
+    STR_CONSTEXPR Derived &operator+=(std::initializer_list<value_type> ilist)
     {
         return append(ilist);
     }
 
     template <typename StringLike>
-    STR_CONSTEXPR basic_str &operator+=(const StringLike &str)
+    STR_CONSTEXPR Derived &operator+=(const StringLike &str)
     {
         return append(str);
     }
@@ -616,71 +1061,84 @@ public:
     /// Assign
     //////////////////////////////////////////////////////////////////////
 
-    STR_CONSTEXPR basic_str &assign(value_type ch)
+    STR_CONSTEXPR Derived &assign(value_type ch)
     {
         assign_(ch, 1);
-        return *this;
+        return derived();
     }
-    STR_CONSTEXPR basic_str &assign(value_type ch, size_type count)
+    STR_CONSTEXPR Derived &assign(value_type ch, size_type count)
     {
         assign_(ch, count);
-        return *this;
+        return derived();
     }
 
-    STR_CONSTEXPR basic_str &assign(const value_type *s)
+    STR_CONSTEXPR Derived &assign(const value_type *s)
     {
         assign_(s, traits_type::length(s));
-        return *this;
+        return derived();
     }
-    STR_CONSTEXPR basic_str &assign(const value_type *s, size_type count)
+    STR_CONSTEXPR Derived &assign(const value_type *s, size_type count)
     {
         assign_(s, count);
-        return *this;
+        return derived();
     }
 
     template <typename InputIt>
-    STR_CONSTEXPR basic_str &assign(InputIt first, InputIt last)
+    STR_CONSTEXPR Derived &assign(InputIt first, InputIt last)
     {
         assign_(first, std::distance(first, last));
-        return *this;
+        return derived();
     }
-    STR_CONSTEXPR basic_str &assign(std::initializer_list<value_type> ilist)
+    STR_CONSTEXPR Derived &assign(std::initializer_list<value_type> ilist)
     {
         assign_(ilist.begin(), ilist.size());
-        return *this;
+        return derived();
     }
 
     template <typename StringLike>
-    STR_CONSTEXPR basic_str &assign(const StringLike &str)
+    STR_CONSTEXPR Derived &assign(const StringLike &str)
     {
         assign_(getptr_(str), getsize_(str));
-        return *this;
+        return derived();
     }
     template <typename StringLike>
-    STR_CONSTEXPR basic_str &assign(const StringLike &str, size_type pos, size_type count = npos)
+    STR_CONSTEXPR Derived &assign(const StringLike &str, size_type pos, size_type count = npos)
     {
         auto len = getsize_(str);
+        assert_range_(pos, 0, len, "'pos' was out of range[0, str.size()] for 'str'");
+
         if (count == npos || count > len - pos)
         {
-            count = len;
+            count = len - pos;
         }
 
         assign_(getptr_(str) + pos, count);
-        return *this;
+        return derived();
     }
 
-protected:
-    STR_CONSTEXPR void assign_(value_type ch, size_type count)
+    template <typename Lhs, typename Rhs>
+    STR_CONSTEXPR Derived &assign(const basic_strconcat<value_type, traits_type, Lhs, Rhs> &expr)
     {
-        struct it
+        auto first = std::as_const(derived()).data();
+        auto len = size();
+
+        // a part viewing this string must still be there when it is written
+        if (expr.views(first, first + len))
         {
-            value_type ch;
-            operator*() { return ch; }
-            operator++(int) {}
-        };
+            append(expr);
+            return erase(0, len);
+        }
 
-        // pass as iterator
-        assign_<it>(it(ch), count);
+        derived().clear();
+        return append(expr);
+    }
+
+protected:
+    STR_CONSTEXPR void assign_(value_type ch, size_type count)
+    {
+        auto ptr = assign_(count);
+        traits_type::assign(ptr, count, ch);
+        assigned_(count);
     }
 
     STR_CONSTEXPR void assign_(const value_type *s, size_type count)
@@ -692,48 +1150,65 @@ protected:
     template <typename InputIt>
     STR_CONSTEXPR void assign_(InputIt first, size_type count)
     {
-        assert_length_(count);
-        if (capacity() < count)
+        if constexpr (std::is_convertible_v<InputIt, const_iterator>)
         {
-            reserve(count);
+            // contiguous, it may point into this string
+            replace_(0, npos, const_iterator(first).operator->(), count);
+            return;
         }
 
-        assert_space_(count);
-
         /// write string
-        auto ptr = data();
+        auto ptr = assign_(count);
         for (size_type i = 0; i < count; i++)
         {
-            ptr[i] = *it;
-            it++;
+            ptr[i] = *first;
+            ++first;
         }
 
+        assigned_(count);
+    }
+
+    /// Makes room for count characters, the current content is overwritten.
+    STR_CONSTEXPR pointer assign_(size_type count)
+    {
+        assert_length_(count);
+        reserve(count);
+        assert_<std::length_error>(count <= capacity(), "not enough space");
+
+        return data();
+    }
+
+    STR_CONSTEXPR void assigned_(size_type count) STR_NOEXCEPT
+    {
+        set_size_(count);
+
 #ifdef STR_TWEAKS_ALWAYS_NULLTERMINATE
-        ptr[count] = '\0';
+        data()[count] = '\0';
 #endif
     }
 
+public:
     //////////////////////////////////////////////////////////////////////
     /// Operator =
     //////////////////////////////////////////////////////////////////////
 
-    STR_CONSTEXPR basic_str &operator=(value_type ch)
+    STR_CONSTEXPR Derived &operator=(value_type ch)
     {
         return assign(ch);
     }
 
-    STR_CONSTEXPR basic_str &operator=(const value_type *s)
+    STR_CONSTEXPR Derived &operator=(const value_type *s)
     {
         return assign(s);
     }
 
-    STR_CONSTEXPR basic_str &operator=(std::initializer_list<value_type> ilist)
+    STR_CONSTEXPR Derived &operator=(std::initializer_list<value_type> ilist)
     {
         return assign(ilist);
     }
 
     template <typename StringLike>
-    STR_CONSTEXPR basic_str &operator=(const StringLike &str)
+    STR_CONSTEXPR Derived &operator=(const StringLike &str)
     {
         return assign(str);
     }
@@ -744,7 +1219,7 @@ protected:
 
     STR_CONSTEXPR int compare(const value_type *s) const
     {
-        return compare_(0, size(), s, size());
+        return compare_(0, size(), s, traits_type::length(s));
     }
 
     STR_CONSTEXPR int compare(const value_type *s, size_type count2) const
@@ -754,7 +1229,7 @@ protected:
 
     STR_CONSTEXPR int compare(size_type index1, size_type count1, const value_type *s) const
     {
-        return compare_(index1, count1, s, count1);
+        return compare_(index1, count1, s, traits_type::length(s));
     }
 
     STR_CONSTEXPR int compare(size_type index1, size_type count1, const value_type *s, size_type count2) const
@@ -763,64 +1238,73 @@ protected:
     }
 
     template <typename StringLike>
-    STR_CONSTEXPR int compare(const StringLike &str) const STR_NOEXCEPT
-    {
-        return compare_(0, size(), getptr_(sv), getsize_(sv));
-    }
-
-    template <typename StringLike>
-    STR_CONSTEXPR int compare(const StringLike &str, size_type index2, size_type count2) const
+    STR_CONSTEXPR int compare(const StringLike &str) const
     {
-        return compare_(0, size(), getptr_(sv) + index2, count2);
+        auto tup = getdata_(str);
+        return compare_(0, size(), std::get<0>(tup), std::get<1>(tup));
     }
 
     template <typename StringLike>
     STR_CONSTEXPR int compare(size_type index1, size_type count1, const StringLike &str) const
     {
-        return compare_(index1, count1, getptr_(sv), getsize_(sv));
+        auto tup = getdata_(str);
+        return compare_(index1, count1, std::get<0>(tup), std::get<1>(tup));
     }
 
     template <typename StringLike>
     STR_CONSTEXPR int compare(size_type index1, size_type count1, const StringLike &str, size_type index2, size_type count2 = npos) const
     {
-        return compare_(index1, count1, getptr_(sv) + index2, getsize_(sv));
+        auto tup = getdata_(str);
+        auto len = std::get<1>(tup);
+        assert_range_(index2, 0, len, "'index2' was out of range[0, str.size()] for 'str'");
+
+        return compare_(index1, count1, std::get<0>(tup) + index2, std::min(count2, len - index2));
     }
 
 protected:
     STR_CONSTEXPR int compare_(size_type index1, size_type count1, const value_type *s, size_type count2) const
     {
-        return traits_type::compare(data() + pos1, s, sdt::min(count1, count2));
+        assert_range_(index1);
+        count1 = std::min(count1, size() - index1);
+
+        int result = traits_type::compare(data() + index1, s, std::min(count1, count2));
+        if (result != 0)
+            return result;
+
+        return count1 < count2 ? -1 : (count1 > count2 ? 1 : 0);
     }
 
+public:
     //////////////////////////////////////////////////////////////////////
     /// starts_with
     //////////////////////////////////////////////////////////////////////
 
     STR_CONSTEXPR bool starts_with(value_type c) const STR_NOEXCEPT
     {
-        return front() == c;
+        return !empty() && traits_type::eq(front(), c);
     }
 
     STR_CONSTEXPR bool starts_with(const value_type *s) const
     {
-        return compare(s) == 0;
+        return starts_with(s, static_cast<size_type>(traits_type::length(s)));
     }
 
     STR_CONSTEXPR bool starts_with(const value_type *s, size_type count) const
     {
-        return compare(s, count) == 0;
+        return count <= size() && details::equal<value_type, traits_type>(data(), s, count);
     }
 
     template <typename StringLike>
-    STR_CONSTEXPR bool starts_with(const StringLike &str) const STR_NOEXCEPT
+    STR_CONSTEXPR bool starts_with(const StringLike &str) const
     {
-        return compare(str);
+        auto tup = getdata_(str);
+        return starts_with(std::get<0>(tup), std::get<1>(tup));
     }
 
     template <typename StringLike>
-    STR_CONSTEXPR bool starts_with(const StringLike &str, size_type pos, size_type count) const STR_NOEXCEPT
+    STR_CONSTEXPR bool starts_with(const StringLike &str, size_type pos, size_type count) const
     {
-        return compare(str, pos, count);
+        return starts_with(getptr_(str) + pos, count);
     }
 
     //////////////////////////////////////////////////////////////////////
@@ -829,27 +1313,28 @@ protected:
 
     STR_CONSTEXPR bool ends_with(value_type c) const STR_NOEXCEPT
     {
-        return back() == c;
+        return !empty() && traits_type::eq(back(), c);
     }
 
     STR_CONSTEXPR bool ends_with(const value_type *s) const
     {
-        return ends_with(s, static_cast<size_type>(char_trait_t::length(s)));
+        return ends_with(s, static_cast<size_type>(traits_type::length(s)));
     }
 
     STR_CONSTEXPR bool ends_with(const value_type *s, size_type count) const
     {
-        return compare(size() - count, count, s, count) == 0;
+        return count <= size() && details::equal<value_type, traits_type>(data() + size() - count, s, count);
     }
 
     template <typename StringLike>
-    STR_CONSTEXPR bool ends_with(const StringLike &str) const STR_NOEXCEPT
+    STR_CONSTEXPR bool ends_with(const StringLike &str) const
     {
-        return ends_with(getptr_(str), getsize_(str));
+        auto tup = getdata_(str);
+        return ends_with(std::get<0>(tup), std::get<1>(tup));
     }
 
     template <typename StringLike>
-    STR_CONSTEXPR bool ends_with(const StringLike &str, size_type pos, size_type count) const STR_NOEXCEPT
+    STR_CONSTEXPR bool ends_with(const StringLike &str, size_type pos, size_type count) const
     {
         return ends_with(getptr_(str) + pos, count);
     }
@@ -858,20 +1343,25 @@ protected:
     /// Contains
     //////////////////////////////////////////////////////////////////////
 
-    STR_CONSTEXPR bool contains(value_type c) const STR_NOEXCEPT_IF(find(c))
+    STR_CONSTEXPR bool contains(value_type c) const
     {
         return find(c) != npos;
     }
 
-    STR_CONSTEXPR bool contains(const value_type *s) const STR_NOEXCEPT_IF(find(s))
+    STR_CONSTEXPR bool contains(const value_type *s) const
     {
         return find(s) != npos;
     }
 
+    STR_CONSTEXPR bool contains(const value_type *s, size_type count) const
+    {
+        return find(s, 0, count) != npos;
+    }
+
     template <typename StringLike>
-    STR_CONSTEXPR bool contains(const StringLike &str) const STR_NOEXCEPT_IF(find(sv))
+    STR_CONSTEXPR bool contains(const StringLike &str) const
     {
-        return find(sv) != npos;
+        return find(str) != npos;
     }
 
     //////////////////////////////////////////////////////////////////////
@@ -883,11 +1373,23 @@ protected:
     STR_CONSTEXPR size_type copy(value_type *dest, size_type count, size_type index = 0) const
     {
         assert_range_(index);
-        count = std::min(size() - index + count, count);
-        traits_type::copy(dest, data() + pos, count);
+        count = std::min(size() - index, count);
+        traits_type::copy(dest, data() + index, count);
         return count;
     }
 
+    //////////////////////////////////////////////////////////////////////
+    /// Substr_view
+    //////////////////////////////////////////////////////////////////////
+
+    /// Returns a view of the substring [index, index+count), nothing is copied.
+    /// @note the view is invalidated when the string is modified.
+    STR_CONSTEXPR basic_strview<value_type, traits_type> substr_view(size_type index = 0, size_type count = npos) const
+    {
+        assert_range_(index);
+        return { data() + index, std::min(size() - index, count) };
+    }
+
     //////////////////////////////////////////////////////////////////////
     /// Resize
     //////////////////////////////////////////////////////////////////////
@@ -897,14 +1399,57 @@ protected:
         resize(count, '\0');
     }
 
-    STR_CONSTEXPR_VFUNC void resize(size_type count, value_type c) = 0;
+    STR_CONSTEXPR void resize(size_type count, value_type c)
+    {
+        derived().resize(count, c);
+    }
 
     //////////////////////////////////////////////////////////////////////
     /// Resize_and_overwrite
     //////////////////////////////////////////////////////////////////////
 
+    /// Resizes the string to count characters without initializing the new ones,
+    /// op(data(), count) writes them and returns the size the string is left with.
+    /// Like std::basic_string::resize_and_overwrite, for filling a string from a socket
+    /// or a decompressor without zeroing the space first.
+    /// @throw std::length_error if count exceeds the capacity the string can reach
+    /// @throw std::out_of_range if op returns more than count
     template <typename Operation>
-    STR_CONSTEXPR void resize_and_overwrite(size_type count, Operation op);
+    STR_CONSTEXPR void resize_and_overwrite(size_type count, Operation op)
+    {
+        assert_length_(count);
+
+        if (capacity() < count)
+        {
+            derived().reserve_(count);
+        }
+
+        assert_<std::length_error>(count <= capacity(), "not enough space");
+
+        auto size = static_cast<size_type>(std::move(op)(data(), count));
+        assert_<std::out_of_range>(size <= count, "operation returned more than count");
+
+        commit_size_(size);
+    }
+
+    //////////////////////////////////////////////////////////////////////
+    /// Append_uninitialized
+    //////////////////////////////////////////////////////////////////////
+
+    /// Reserves count characters after the end of the string and returns them
+    /// uninitialized. The producer writes into them, then commit(written) appends
+    /// the written characters; nothing is appended until then.
+    /// @note the span is invalidated when the string is modified before the commit.
+    STR_CONSTEXPR append_span append_uninitialized(size_type count)
+    {
+        auto len = size();
+        assert_<std::length_error>(count <= max_size() - len, "'max_length' reached");
+
+        reserve(len + count);
+        assert_<std::length_error>(len + count <= capacity(), "not enough space");
+
+        return append_span(*this, data() + len, count);
+    }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// SEARCH
@@ -929,16 +1474,18 @@ protected:
         return find_(s, index, count);
     }
 
+    /// Finds the first [0, count) characters of str.
     template <typename StringLike>
-    STR_CONSTEXPR size_type find(const StringLike &str, size_type index = 0, size_type count = npos) const STR_NOEXCEPT
+    STR_CONSTEXPR size_type find(const StringLike &str, size_type index = 0, size_type count = npos) const
     {
-        auto len = getsize_(str);
-        if (count == npos || count > len - index)
+        auto tup = getdata_(str);
+        auto len = std::get<1>(tup);
+        if (count == npos || count > len)
         {
             count = len;
         }
 
-        return find_(getptr_(str), index, count);
+        return find_(std::get<0>(tup), index, count);
     }
 
 protected:
@@ -946,43 +1493,16 @@ protected:
     {
         assert_range_(index);
 
-        auto ptr = data();
-        auto len = size();
-        for (size_type i = index; i < len; i++)
-        {
-            if (traits_type::eq(ptr[i], ch))
-                return i;
-        }
-
-        return npos;
+        auto result = details::find_char<value_type, traits_type>(data() + index, size() - index, ch);
+        return result == details::search_npos ? npos : index + static_cast<size_type>(result);
     }
 
     STR_CONSTEXPR size_type find_(const value_type *s, size_type index, size_type count) const
     {
         assert_range_(index);
 
-        auto ptr = data();
-        auto len = size();
-
-        for (; index < len - count, index++)
-        {
-            // find first character
-            for (size_type i = index; i < len; i++)
-            {
-                if (traits_type::eq(ptr[i], ch))
-                    return i;
-            }
-
-            // fail if even the first character was not found
-            if (ptr == nullptr)
-                return npos;
-
-            // if found compare the string
-            if (traits_type::compare(ptr, s, count) == 0)
-                return index;
-        }
-
-        return npos;
+        auto result = details::search<value_type, traits_type>(data() + index, size() - index, s, count);
+        return result == details::search_npos ? npos : index + static_cast<size_type>(result);
     }
 
 public:
@@ -1005,64 +1525,43 @@ public:
         return rfind_(s, index, count);
     }
 
+    /// Finds the last [0, count) characters of str.
     template <typename StringLike>
-    STR_CONSTEXPR size_type rfind(const StringLike &str, size_type index = npos, size_type count = npos) const STR_NOEXCEPT
+    STR_CONSTEXPR size_type rfind(const StringLike &str, size_type index = npos, size_type count = npos) const
     {
-        index = std::min(count, getsize_(str) - 1);
-
-        auto len = getsize_(str);
-        if (count == npos || count > len - index)
+        auto tup = getdata_(str);
+        auto len = std::get<1>(tup);
+        if (count == npos || count > len)
         {
             count = len;
         }
 
-        return rfind_(getptr_(str), index, count);
+        return rfind_(std::get<0>(tup), index, count);
     }
 
 protected:
+    /// Searches [0, index], index is clamped to the last character.
     STR_CONSTEXPR size_type rfind_(const value_type ch, size_type index) const
     {
-        assert_range_(index);
-
-        auto ptr = data();
-        for (size_type i = index; i >= 0; i--)
-        {
-            if (traits_type::eq(ptr[i], ch))
-                return i;
-        }
+        auto len = size();
+        if (len == 0)
+            return npos;
 
-        return npos;
+        auto count = std::min(index, len - 1) + 1;
+        auto result = details::rfind_char<value_type, traits_type>(data(), count, ch);
+        return result == details::search_npos ? npos : static_cast<size_type>(result);
     }
 
+    /// Searches for matches starting in [0, index], index is clamped to size() - count.
     STR_CONSTEXPR size_type rfind_(const value_type *s, size_type index, size_type count) const
     {
-        assert_range_(index);
-
-        auto ptr = data();
         auto len = size();
+        if (count > len)
+            return npos;
 
-        for (; index > count; index--)
-        {
-            // find first character
-            for (size_type i = len; i >= 0; i--)
-            {
-                if (traits_type::eq(ptr[i], ch))
-                {
-                    index = i;
-                    break;
-                }
-            }
-
-            // fail if even the first character was not found
-            if (index == npos)
-                return npos;
-
-            // if found compare the string
-            if (traits_type::compare(ptr + index, s, count) == 0)
-                return index;
-        }
-
-        return npos;
+        auto last = std::min(index, len - count);
+        auto result = details::rsearch<value_type, traits_type>(data(), last + count, s, count);
+        return result == details::search_npos ? npos : static_cast<size_type>(result);
     }
 
 public:
@@ -1086,47 +1585,60 @@ public:
     }
 
     template <typename StringLike>
-    STR_CONSTEXPR size_type find_first_of(const StringLike &str, size_type index = 0, size_type count = npos) const STR_NOEXCEPT
+    STR_CONSTEXPR size_type find_first_of(const StringLike &str, size_type index = 0, size_type count = npos) const
     {
-        auto len = getsize_(str);
-        if (count == npos || count > len - index)
+        auto tup = getdata_(str);
+        auto len = std::get<1>(tup);
+        if (count == npos || count > len)
         {
             count = len;
         }
 
-        return find_first_of_(getptr_(str), index, count);
+        return find_first_of_(std::get<0>(tup), index, count);
+    }
+
+    /// Finds the first character which is in the prebuilt set.
+    STR_CONSTEXPR size_type find_first_of(const basic_charset<value_type> &set, size_type index = 0) const
+    {
+        return find_first_of_(set, index);
     }
 
 protected:
     STR_CONSTEXPR size_type find_first_of_(const value_type ch, size_type index) const
     {
+        return find_(ch, index);
+    }
+
+    STR_CONSTEXPR size_type find_first_of_(const value_type *s, size_type index, size_type count) const
+    {
+        if (count == 1)
+            return find_(*s, index);
+
+        // building the set is cheaper than scanning it for every character
+        if constexpr (sizeof(value_type) == 1 && details::is_simd_searchable<value_type, traits_type>::value)
+        {
+            return find_first_of_(basic_charset<value_type>(s, count), index);
+        }
+
         assert_range_(index);
 
         auto ptr = data();
         auto len = size();
         for (size_type i = index; i < len; i++)
         {
-            if (traits_type::eq(ptr[i], ch))
+            if (traits_type::find(s, count, ptr[i]) != nullptr)
                 return i;
         }
 
         return npos;
     }
 
-    STR_CONSTEXPR size_type find_first_of_(const value_type *s, size_type index, size_type count) const
+    STR_CONSTEXPR size_type find_first_of_(const basic_charset<value_type> &set, size_type index) const
     {
         assert_range_(index);
 
-        auto ptr = data();
-        auto len = size();
-        for (size_type i = index; i < len; i++)
-            for (size_type j = 0; j < count; j++)
-            {
-                if (traits_type::eq(ptr[i], s[j]))
-                    return i;
-            }
-
-        return npos;
+        auto result = set.template find_in<true>(data() + index, size() - index);
+        return result == details::search_npos ? npos : index + static_cast<size_type>(result);
     }
 
 public:
@@ -1150,56 +1662,56 @@ public:
     }
 
     template <typename StringLike>
-    STR_CONSTEXPR size_type find_first_not_of(const StringLike &str, size_type index = 0, size_type count = npos) const STR_NOEXCEPT
+    STR_CONSTEXPR size_type find_first_not_of(const StringLike &str, size_type index = 0, size_type count = npos) const
     {
-        auto len = getsize_(str);
-        if (count == npos || count > len - index)
+        auto tup = getdata_(str);
+        auto len = std::get<1>(tup);
+        if (count == npos || count > len)
         {
             count = len;
         }
 
-        return find_first_not_of_(getptr_(str), index, count);
+        return find_first_not_of_(std::get<0>(tup), index, count);
+    }
+
+    /// Finds the first character which is not in the prebuilt set.
+    STR_CONSTEXPR size_type find_first_not_of(const basic_charset<value_type> &set, size_type index = 0) const
+    {
+        return find_first_not_of_(set, index);
     }
 
 protected:
     STR_CONSTEXPR size_type find_first_not_of_(const value_type ch, size_type index) const
     {
+        return find_first_not_of_(&ch, index, 1);
+    }
+
+    STR_CONSTEXPR size_type find_first_not_of_(const value_type *s, size_type index, size_type count) const
+    {
+        if constexpr (sizeof(value_type) == 1 && details::is_simd_searchable<value_type, traits_type>::value)
+        {
+            return find_first_not_of_(basic_charset<value_type>(s, count), index);
+        }
+
         assert_range_(index);
 
         auto ptr = data();
         auto len = size();
         for (size_type i = index; i < len; i++)
         {
-            if (traits_type::eq(ptr[i], ch) == false)
+            if (traits_type::find(s, count, ptr[i]) == nullptr)
                 return i;
         }
 
         return npos;
     }
 
-    STR_CONSTEXPR size_type find_first_not_of_(const value_type *s, size_type index, size_type count) const
+    STR_CONSTEXPR size_type find_first_not_of_(const basic_charset<value_type> &set, size_type index) const
     {
         assert_range_(index);
 
-        auto ptr = data();
-        auto len = size();
-        for (size_type i = index; i < len; i++)
-        {
-            bool matched = false;
-            for (size_type j = 0; j < count; j++)
-            {
-                if (traits_type::eq(ptr[i], s[j]))
-                {
-                    matched = true;
-                    break;
-                }
-            }
-
-            if (matched == false)
-                return i;
-        }
-
-        return npos;
+        auto result = set.template find_in<false>(data() + index, size() - index);
+        return result == details::search_npos ? npos : index + static_cast<size_type>(result);
     }
 
 public:
@@ -1223,49 +1735,62 @@ public:
     }
 
     template <typename StringLike>
-    STR_CONSTEXPR size_type find_last_of(const StringLike &str, size_type index = npos, size_type count = npos) const STR_NOEXCEPT
+    STR_CONSTEXPR size_type find_last_of(const StringLike &str, size_type index = npos, size_type count = npos) const
     {
-        index = std::min(index, getsize_(str) - 1);
-
-        auto len = getsize_(str);
-        if (count == npos || count > len - index)
+        auto tup = getdata_(str);
+        auto len = std::get<1>(tup);
+        if (count == npos || count > len)
         {
             count = len;
         }
 
-        return find_last_of_(getptr_(str), index, count);
+        return find_last_of_(std::get<0>(tup), index, count);
+    }
+
+    /// Finds the last character which is in the prebuilt set.
+    STR_CONSTEXPR size_type find_last_of(const basic_charset<value_type> &set, size_type index = npos) const
+    {
+        return find_last_of_(set, index);
     }
 
 protected:
     STR_CONSTEXPR size_type find_last_of_(const value_type ch, size_type index) const
     {
-        assert_range_(index);
+        return rfind_(ch, index);
+    }
+
+    STR_CONSTEXPR size_type find_last_of_(const value_type *s, size_type index, size_type count) const
+    {
+        if (count == 1)
+            return rfind_(*s, index);
+
+        if constexpr (sizeof(value_type) == 1 && details::is_simd_searchable<value_type, traits_type>::value)
+        {
+            return find_last_of_(basic_charset<value_type>(s, count), index);
+        }
 
-        auto ptr = data();
         auto len = size();
-        for (size_type i = index; i >= 0; i--)
+        if (len == 0 || count == 0)
+            return npos;
+
+        auto ptr = data();
+        for (size_type i = std::min(index, len - 1) + 1; i > 0; i--)
         {
-            if (traits_type::eq(ptr[i], ch))
-                return i;
+            if (traits_type::find(s, count, ptr[i - 1]) != nullptr)
+                return i - 1;
         }
 
         return npos;
     }
 
-    STR_CONSTEXPR size_type find_last_of_(const value_type *s, size_type index, size_type count) const
+    STR_CONSTEXPR size_type find_last_of_(const basic_charset<value_type> &set, size_type index) const
     {
-        assert_range_(index);
-
-        auto ptr = data();
         auto len = size();
-        for (size_type i = index; i >= 0; i--)
-            for (size_type j = 0; j < count; j++)
-            {
-                if (traits_type::eq(ptr[i], s[j]))
-                    return i;
-            }
+        if (len == 0)
+            return npos;
 
-        return npos;
+        auto result = set.template rfind_in<true>(data(), std::min(index, len - 1) + 1);
+        return result == details::search_npos ? npos : static_cast<size_type>(result);
     }
 
 public:
@@ -1273,12 +1798,12 @@ public:
     /// find_last_not_of
     //////////////////////////////////////////////////////////////////////
 
-    STR_CONSTEXPR size_type find_last_not_of(value_type ch, size_type index = 0) const STR_NOEXCEPT
+    STR_CONSTEXPR size_type find_last_not_of(value_type ch, size_type index = npos) const STR_NOEXCEPT
     {
         return find_last_not_of_(ch, index);
     }
 
-    STR_CONSTEXPR size_type find_last_not_of(const value_type *s, size_type index = 0) const
+    STR_CONSTEXPR size_type find_last_not_of(const value_type *s, size_type index = npos) const
     {
         return find_last_not_of_(s, index, traits_type::length(s));
     }
@@ -1289,56 +1814,68 @@ public:
     }
 
     template <typename StringLike>
-    STR_CONSTEXPR size_type find_last_not_of(const StringLike &str, size_type index = 0, size_type count = npos) const STR_NOEXCEPT
+    STR_CONSTEXPR size_type find_last_not_of(const StringLike &str, size_type index = npos, size_type count = npos) const
     {
-        auto len = getsize_(str);
-        if (count == npos || count > len - index)
+        auto tup = getdata_(str);
+        auto len = std::get<1>(tup);
+        if (count == npos || count > len)
         {
             count = len;
         }
 
-        return find_last_not_of_(getptr_(str), index, count);
-    }
-
-protected:
-    STR_CONSTEXPR size_type find_last_not_of_(const value_type ch, size_type index) const
-    {
-        assert_range_(index);
+        return find_last_not_of_(std::get<0>(tup), index, count);
+    }
+
+    /// Finds the last character which is not in the prebuilt set.
+    STR_CONSTEXPR size_type find_last_not_of(const basic_charset<value_type> &set, size_type index = npos) const
+    {
+        return find_last_not_of_(set, index);
+    }
+
+protected:
+    STR_CONSTEXPR size_type find_last_not_of_(const value_type ch, size_type index) const
+    {
+        auto len = size();
+        if (len == 0)
+            return npos;
+
+        auto count = std::min(index, len - 1) + 1;
+        auto result = details::rfind_char<value_type, traits_type, false>(data(), count, ch);
+        return result == details::search_npos ? npos : static_cast<size_type>(result);
+    }
+
+    STR_CONSTEXPR size_type find_last_not_of_(const value_type *s, size_type index, size_type count) const
+    {
+        if (count == 1)
+            return find_last_not_of_(*s, index);
+
+        if constexpr (sizeof(value_type) == 1 && details::is_simd_searchable<value_type, traits_type>::value)
+        {
+            return find_last_not_of_(basic_charset<value_type>(s, count), index);
+        }
+
+        auto len = size();
+        if (len == 0)
+            return npos;
 
         auto ptr = data();
-        auto len = size();
-        for (size_type i = index; i >= 0; i--)
+        for (size_type i = std::min(index, len - 1) + 1; i > 0; i--)
         {
-            if (traits_type::eq(ptr[i], ch) == false)
-                return i;
+            if (traits_type::find(s, count, ptr[i - 1]) == nullptr)
+                return i - 1;
         }
 
         return npos;
     }
 
-    STR_CONSTEXPR size_type find_last_not_of_(const value_type *s, size_type index, size_type count) const
+    STR_CONSTEXPR size_type find_last_not_of_(const basic_charset<value_type> &set, size_type index) const
     {
-        assert_range_(index);
-
-        auto ptr = data();
         auto len = size();
-        for (size_type i = index; i >= 0; i--)
-        {
-            bool matched = false;
-            for (size_type j = 0; j < count; j++)
-            {
-                if (traits_type::eq(ptr[i], s[j]))
-                {
-                    matched = true;
-                    break;
-                }
-            }
-
-            if (matched == false)
-                return i;
-        }
+        if (len == 0)
+            return npos;
 
-        return npos;
+        auto result = set.template rfind_in<false>(data(), std::min(index, len - 1) + 1);
+        return result == details::search_npos ? npos : static_cast<size_type>(result);
     }
 
 protected:
@@ -1385,65 +1922,56 @@ protected:
     /////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     template <typename StringLike>
-    const_pointer getptr_(const StringLike &str)
+    const_pointer getptr_(const StringLike &str) const
     {
-        using thistraits = strtraits<basic_str<Char, CharTraits, Allocator>>;
+        using thistraits = strtraits<basic_str_core>;
         using othertraits = strtraits<StringLike>;
 
-        static_assert(std::is_same_v<thistraits::char_type, othertraits::char_type>,
+        static_assert(std::is_same_v<typename thistraits::char_type, typename othertraits::char_type>,
                       "char_type must be same for both string types");
 
-        static_assert(std::is_same_v<thistraits::char_traits, othertraits::char_traits>,
+        static_assert(std::is_same_v<typename thistraits::char_traits, typename othertraits::char_traits>,
                       "char_traits must be same for both string types");
 
-        static_assert(std::is_same_v<thistraits::allocator_type, othertraits::allocator_type>,
-                      "allocator_type must be same for both string types");
-
         return othertraits::data(str);
     }
 
     template <typename StringLike>
-    size_type getsize_(const StringLike &str)
+    size_type getsize_(const StringLike &str) const
     {
-        using thistraits = strtraits<basic_str<Char, CharTraits, Allocator>>;
+        using thistraits = strtraits<basic_str_core>;
         using othertraits = strtraits<StringLike>;
 
-        static_assert(std::is_same_v<thistraits::char_type, othertraits::char_type>,
+        static_assert(std::is_same_v<typename thistraits::char_type, typename othertraits::char_type>,
                       "char_type must be same for both string types");
 
-        static_assert(std::is_same_v<thistraits::char_traits, othertraits::char_traits>,
+        static_assert(std::is_same_v<typename thistraits::char_traits, typename othertraits::char_traits>,
                       "char_traits must be same for both string types");
 
-        static_assert(std::is_same_v<thistraits::allocator_type, othertraits::allocator_type>,
-                      "allocator_type must be same for both string types");
-
         return othertraits::size(str);
     }
 
     template <typename StringLike>
-    std::tuple<const_pointer, size_type> getdata_(const StringLike &str)
+    std::tuple<const_pointer, size_type> getdata_(const StringLike &str) const
     {
-        using thistraits = strtraits<basic_str<Char, CharTraits, Allocator>>;
+        using thistraits = strtraits<basic_str_core>;
         using othertraits = strtraits<StringLike>;
 
-        static_assert(std::is_same_v<thistraits::char_type, othertraits::char_type>,
+        static_assert(std::is_same_v<typename thistraits::char_type, typename othertraits::char_type>,
                       "char_type must be same for both string types");
 
-        static_assert(std::is_same_v<thistraits::char_traits, othertraits::char_traits>,
+        static_assert(std::is_same_v<typename thistraits::char_traits, typename othertraits::char_traits>,
                       "char_traits must be same for both string types");
 
-        static_assert(std::is_same_v<thistraits::allocator_type, othertraits::allocator_type>,
-                      "allocator_type must be same for both string types");
-
         return { othertraits::data(str), othertraits::size(str) };
     }
 };
 
-template <typename Char, typename CharTraits, typename Allocator>
-class basic_str<Char, CharTraits, Allocator>::const_iterator
+template <typename Derived, typename Char, typename CharTraits, typename Allocator>
+class basic_str_core<Derived, Char, CharTraits, Allocator>::const_iterator
 {
     using this_t = const_iterator;
-    using source_t = basic_str<Char, CharTraits, Allocator>;
+    using source_t = basic_str_core<Derived, Char, CharTraits, Allocator>;
 
 public:
     using iterator_category = std::random_access_iterator_tag;
@@ -1563,12 +2091,12 @@ protected:
     const value_type *ptr_ = nullptr;
 };
 
-template <typename Char, typename CharTraits, typename Allocator>
-class basic_str<Char, CharTraits, Allocator>::iterator : public const_iterator
+template <typename Derived, typename Char, typename CharTraits, typename Allocator>
+class basic_str_core<Derived, Char, CharTraits, Allocator>::iterator : public const_iterator
 {
     using this_t = iterator;
     using base_t = const_iterator;
-    using source_t = basic_str<Char, CharTraits, Allocator>;
+    using source_t = basic_str_core<Derived, Char, CharTraits, Allocator>;
 
 public:
     using iterator_category = typename base_t::iterator_category;
@@ -1654,7 +2182,7 @@ public:
 
     STR_NODISCARD STR_CONSTEXPR reference operator[](const difference_type offset) const STR_NOEXCEPT
     {
-        return const_cast<reference>(base_t::operator[offset]);
+        return const_cast<reference>(base_t::operator[](offset));
     }
 
     STR_NODISCARD STR_CONSTEXPR bool operator==(const this_t &right) const STR_NOEXCEPT
@@ -1691,50 +2219,491 @@ public:
 #endif
 };
 
+/// Uninitialized characters at the end of a string, returned by append_uninitialized().
+template <typename Derived, typename Char, typename CharTraits, typename Allocator>
+class basic_str_core<Derived, Char, CharTraits, Allocator>::append_span
+{
+    using source_t = basic_str_core<Derived, Char, CharTraits, Allocator>;
+
+public:
+    using value_type = typename source_t::value_type;
+    using size_type = typename source_t::size_type;
+    using pointer = typename source_t::pointer;
+    using reference = typename source_t::reference;
+
+public:
+    STR_CONSTEXPR append_span(source_t &str, pointer data, size_type size) STR_NOEXCEPT
+        : str_{&str}, data_{data}, size_{size} {}
+
+    STR_CONSTEXPR pointer data() const STR_NOEXCEPT
+    {
+        return data_;
+    }
+
+    STR_CONSTEXPR size_type size() const STR_NOEXCEPT
+    {
+        return size_;
+    }
+
+    STR_CONSTEXPR pointer begin() const STR_NOEXCEPT
+    {
+        return data_;
+    }
+
+    STR_CONSTEXPR pointer end() const STR_NOEXCEPT
+    {
+        return data_ + size_;
+    }
+
+    STR_CONSTEXPR reference operator[](size_type index) const STR_NOEXCEPT
+    {
+        return data_[index];
+    }
+
+    /// Appends the first count characters of the span to the string.
+    /// @throw std::out_of_range if count exceeds size()
+    STR_CONSTEXPR void commit(size_type count)
+    {
+        str_->template assert_<std::out_of_range>(count <= size_, "count exceeds the span");
+        str_->commit_size_(static_cast<size_type>(data_ - str_->data()) + count);
+    }
+
+protected:
+    source_t *str_;
+    pointer data_;
+    size_type size_;
+};
+
+//////////////////////////////////////////////////////////////////////
+// Polymorphic Interface
+//////////////////////////////////////////////////////////////////////
+
+/// Type-erased string, the storage primitives are virtual.
+/// Used where a single non-template function has to accept any string type,
+/// concrete strings are passed through adapt(). Every primitive is an indirect call.
+template <typename Char, typename CharTraits = std::char_traits<Char>, typename Allocator = std::allocator<Char>>
+class basic_str : public basic_str_core<basic_str<Char, CharTraits, Allocator>, Char, CharTraits, Allocator>
+{
+    using this_t = basic_str<Char, CharTraits, Allocator>;
+
+public:
+    using base_t = basic_str_core<this_t, Char, CharTraits, Allocator>;
+    using value_type = typename base_t::value_type;
+    using allocator_type = typename base_t::allocator_type;
+    using size_type = typename base_t::size_type;
+    using pointer = typename base_t::pointer;
+    using const_pointer = typename base_t::const_pointer;
+
+    using base_t::npos;
+    using base_t::operator=;
+    using base_t::resize;
+
+    friend base_t;
+
+public:
+    STR_CONSTEXPR_VFUNC ~basic_str() STR_NOEXCEPT = default;
+
+    /// Assigns the content, the strings are not rebound.
+    STR_CONSTEXPR basic_str &operator=(const basic_str &str)
+    {
+        return this->assign(str);
+    }
+
+    STR_CONSTEXPR_VFUNC pointer data() STR_NOEXCEPT = 0;
+    STR_CONSTEXPR_VFUNC const_pointer data() const STR_NOEXCEPT = 0;
+    STR_CONSTEXPR_VFUNC size_type size() const STR_NOEXCEPT = 0;
+    STR_CONSTEXPR_VFUNC size_type max_size() const STR_NOEXCEPT = 0;
+    STR_CONSTEXPR_VFUNC size_type capacity() const STR_NOEXCEPT = 0;
+    STR_CONSTEXPR_VFUNC void resize(size_type count, value_type c) = 0;
+    STR_CONSTEXPR_VFUNC allocator_type get_allocator() const STR_NOEXCEPT = 0;
+
+protected:
+    STR_CONSTEXPR basic_str() STR_NOEXCEPT = default;
+    STR_CONSTEXPR basic_str(const basic_str &) STR_NOEXCEPT = default;
+
+    STR_CONSTEXPR_VFUNC void set_size_(size_type size) STR_NOEXCEPT = 0;
+
+    STR_CONSTEXPR_VFUNC size_type recommend_(size_type required) const STR_NOEXCEPT
+    {
+        return required;
+    }
+
+    STR_CONSTEXPR_VFUNC void reserve_(size_type cap)
+    {
+        resize(cap);
+    }
+};
+
+/// Exposes a concrete string through the basic_str interface.
+/// The adapter refers to the string and must not outlive it.
+template <typename String>
+class basic_str_adapter : public basic_str<typename String::value_type, typename String::traits_type,
+                                           typename String::allocator_type>
+{
+    using this_t = basic_str_adapter<String>;
+
+public:
+    using base_t = basic_str<typename String::value_type, typename String::traits_type,
+                             typename String::allocator_type>;
+    using value_type = typename base_t::value_type;
+    using allocator_type = typename base_t::allocator_type;
+    using size_type = typename base_t::size_type;
+    using pointer = typename base_t::pointer;
+    using const_pointer = typename base_t::const_pointer;
+
+    using base_t::operator=;
+    using base_t::resize;
+
+public:
+    STR_CONSTEXPR basic_str_adapter(String &str) STR_NOEXCEPT
+        : str_{&str} {}
+
+    STR_CONSTEXPR basic_str_adapter(const basic_str_adapter &other) STR_NOEXCEPT = default;
+
+    STR_CONSTEXPR basic_str_adapter &operator=(const basic_str_adapter &other)
+    {
+        this->assign(other);
+        return *this;
+    }
+
+    /// Returns the adapted string.
+    STR_CONSTEXPR String &get() const STR_NOEXCEPT
+    {
+        return *str_;
+    }
+
+    STR_CONSTEXPR pointer data() STR_NOEXCEPT override
+    {
+        return str_->data();
+    }
+
+    STR_CONSTEXPR const_pointer data() const STR_NOEXCEPT override
+    {
+        return str_->data();
+    }
+
+    STR_CONSTEXPR size_type size() const STR_NOEXCEPT override
+    {
+        return str_->size();
+    }
+
+    STR_CONSTEXPR size_type max_size() const STR_NOEXCEPT override
+    {
+        return str_->max_size();
+    }
+
+    STR_CONSTEXPR size_type capacity() const STR_NOEXCEPT override
+    {
+        return str_->capacity();
+    }
+
+    STR_CONSTEXPR void resize(size_type count, value_type c) override
+    {
+        str_->resize(count, c);
+    }
+
+    STR_CONSTEXPR allocator_type get_allocator() const STR_NOEXCEPT override
+    {
+        return str_->get_allocator();
+    }
+
+protected:
+    STR_CONSTEXPR void set_size_(size_type size) STR_NOEXCEPT override
+    {
+        str_->set_size_(size);
+    }
+
+    STR_CONSTEXPR size_type recommend_(size_type required) const STR_NOEXCEPT override
+    {
+        return str_->recommend_(required);
+    }
+
+    STR_CONSTEXPR void reserve_(size_type cap) override
+    {
+        str_->reserve_(cap);
+    }
+
+protected:
+    String *str_;
+};
+
+/// Wraps str in the basic_str interface.
+template <typename String>
+STR_CONSTEXPR basic_str_adapter<String> adapt(String &str) STR_NOEXCEPT
+{
+    return basic_str_adapter<String>(str);
+}
+
 //////////////////////////////////////////////////////////////////////
 // OStream Operator
 //////////////////////////////////////////////////////////////////////
 
-template <typename Char, typename CharTraits, typename Allocator>
+STR_NAMESPACE_DETAILS_BEGIN
+
+/// Writes count fill characters of os in blocks.
+template <typename Char, typename CharTraits>
+bool ostream_fill(std::basic_ostream<Char, CharTraits> &os, std::streamsize count)
+{
+    Char block[64];
+    CharTraits::assign(block, 64, os.fill());
+
+    while (count > 0)
+    {
+        auto chunk = std::min<std::streamsize>(count, 64);
+        if (os.rdbuf()->sputn(block, chunk) != chunk)
+            return false;
+
+        count -= chunk;
+    }
+
+    return true;
+}
+
+/// Formatted output of count characters with a single sputn, padded to
+/// the width of os with its fill character like std::string is.
+template <typename Char, typename CharTraits>
 std::basic_ostream<Char, CharTraits> &
-operator<<(std::basic_ostream<Char, CharTraits> &os,
-           const basic_str<Char, CharTraits, Allocator> &str)
+ostream_insert(std::basic_ostream<Char, CharTraits> &os, const Char *ptr, std::size_t count)
 {
-    using size_type = basic_str<Char, CharTraits, Allocator>::size_type;
+    typename std::basic_ostream<Char, CharTraits>::sentry sentry(os);
+    if (!sentry)
+        return os;
+
+    auto size = static_cast<std::streamsize>(count);
+    auto pad = os.width() > size ? os.width() - size : 0;
+    auto left = (os.flags() & std::ios_base::adjustfield) == std::ios_base::left;
 
-    size_type size = str.size();
-    auto ptr = str.data();
+    try
+    {
+        bool ok = left || ostream_fill(os, pad);
+        ok = ok && os.rdbuf()->sputn(ptr, size) == size;
+        ok = ok && (!left || ostream_fill(os, pad));
 
-    for (size_type i = 0; i < size; i++)
+        if (!ok)
+        {
+            os.setstate(std::ios_base::badbit);
+        }
+    }
+    catch (...)
     {
-        os << ptr[i];
+        os.setstate(std::ios_base::badbit);
     }
 
+    os.width(0);
     return os;
 }
 
+STR_NAMESPACE_DETAILS_END
+
+template <typename Derived, typename Char, typename CharTraits, typename Allocator>
+std::basic_ostream<Char, CharTraits> &
+operator<<(std::basic_ostream<Char, CharTraits> &os,
+           const basic_str_core<Derived, Char, CharTraits, Allocator> &str)
+{
+    return details::ostream_insert(os, str.data(), str.size());
+}
+
 //////////////////////////////////////////////////////////////////////
 // IStream Operator
 //////////////////////////////////////////////////////////////////////
 
-template <typename Char, typename CharTraits, typename Allocator>
+STR_NAMESPACE_DETAILS_BEGIN
+
+/// Characters copied at once from the get area of a stream buffer. Those read
+/// past the end of a word or line are put back one at a time, so a larger block
+/// costs more after short words and a smaller one more virtual calls to sgetn().
+inline constexpr std::streamsize istream_block = 64;
+
+/// Gives back the last count characters taken from buf. They were just read
+/// from its get area so this only moves its position back, but a buffer whose
+/// in_avail() counts characters outside of its get area may refuse.
+template <typename Char, typename CharTraits>
+bool streambuf_unget(std::basic_streambuf<Char, CharTraits> *buf, std::streamsize count)
+{
+    for (; count > 0; count--)
+    {
+        if (CharTraits::eq_int_type(buf->sungetc(), CharTraits::eof()))
+            return false;
+    }
+
+    return true;
+}
+
+STR_NAMESPACE_DETAILS_END
+
+/// Reads a word like std::string does: leading whitespace is skipped, then
+/// characters are appended until whitespace, the end of the stream or width()
+/// characters. Only the public stream buffer API is used: the characters it
+/// holds, told by in_avail(), are copied by blocks with sgetn(), scanned and
+/// appended at once, and those past the word are put back.
+template <typename Derived, typename Char, typename CharTraits, typename Allocator>
 std::basic_istream<Char, CharTraits> &
 operator>>(std::basic_istream<Char, CharTraits> &is,
-           basic_str<Char, CharTraits, Allocator> &str)
+           basic_str_core<Derived, Char, CharTraits, Allocator> &str)
+{
+    using size_type = typename basic_str_core<Derived, Char, CharTraits, Allocator>::size_type;
+
+    typename std::basic_istream<Char, CharTraits>::sentry sentry(is);
+    if (!sentry)
+        return is;
+
+    str.clear();
+
+    auto max = is.width() > 0 ? static_cast<size_type>(is.width()) : str.max_size();
+    auto &ctype = std::use_facet<std::ctype<Char>>(is.getloc());
+    auto buf = is.rdbuf();
+    auto state = std::ios_base::goodbit;
+    size_type extracted = 0;
+    Char block[details::istream_block];
+
+    try
+    {
+        while (extracted < max)
+        {
+            // refills the get area of buffered streams
+            auto ch = buf->sgetc();
+            if (CharTraits::eq_int_type(ch, CharTraits::eof()))
+            {
+                state |= std::ios_base::eofbit;
+                break;
+            }
+
+            auto limit = static_cast<std::streamsize>(
+                std::min<size_type>(max - extracted, static_cast<size_type>(details::istream_block)));
+            auto avail = std::min(buf->in_avail(), limit);
+            if (avail <= 0)
+            {
+                // unbuffered streams are read a single character at a time
+                auto c = CharTraits::to_char_type(ch);
+                if (ctype.is(std::ctype_base::space, c))
+                    break;
+
+                str.push_back(c);
+                extracted++;
+                buf->sbumpc();
+                continue;
+            }
+
+            auto end = block + buf->sgetn(block, avail);
+            auto last = ctype.scan_is(std::ctype_base::space, block, end);
+            auto count = static_cast<size_type>(last - block);
+
+            str.append(static_cast<const Char *>(block), count);
+            extracted += count;
+
+            if (last != end)
+            {
+                if (!details::streambuf_unget(buf, end - last))
+                    state |= std::ios_base::badbit;
+                break;
+            }
+        }
+    }
+    catch (...)
+    {
+        state |= std::ios_base::badbit;
+    }
+
+    if (extracted == 0)
+    {
+        state |= std::ios_base::failbit;
+    }
+
+    is.width(0);
+    is.setstate(state);
+    return is;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Getline
+//////////////////////////////////////////////////////////////////////
+
+/// Reads characters until delim like std::getline, the delimiter is extracted
+/// but not stored. The capacity of str is reused, so reading every line of a
+/// stream into the same string stops allocating once it fits the longest line.
+/// Buffered characters are copied by blocks like operator>> and searched for
+/// delim with memchr.
+template <typename Derived, typename Char, typename CharTraits, typename Allocator>
+std::basic_istream<Char, CharTraits> &
+getline(std::basic_istream<Char, CharTraits> &is,
+        basic_str_core<Derived, Char, CharTraits, Allocator> &str, Char delim)
 {
-    using size_type = basic_str<Char, CharTraits, Allocator>::size_type;
+    using size_type = typename basic_str_core<Derived, Char, CharTraits, Allocator>::size_type;
+
+    typename std::basic_istream<Char, CharTraits>::sentry sentry(is, true);
+    if (!sentry)
+        return is;
+
+    str.clear();
+
+    auto buf = is.rdbuf();
+    auto state = std::ios_base::goodbit;
+    size_type extracted = 0;
+    Char block[details::istream_block];
 
-    size_type size = str.size();
-    auto ptr = str.data();
+    try
+    {
+        while (true)
+        {
+            // refills the get area of buffered streams
+            auto ch = buf->sgetc();
+            if (CharTraits::eq_int_type(ch, CharTraits::eof()))
+            {
+                state |= std::ios_base::eofbit;
+                break;
+            }
+
+            auto avail = std::min(buf->in_avail(), details::istream_block);
+            if (avail <= 0)
+            {
+                // unbuffered streams are read a single character at a time
+                buf->sbumpc();
+                extracted++;
+                if (CharTraits::eq(CharTraits::to_char_type(ch), delim))
+                    break;
+
+                str.push_back(CharTraits::to_char_type(ch));
+                continue;
+            }
+
+            auto size = static_cast<std::size_t>(buf->sgetn(block, avail));
+            auto index = details::find_char<Char, CharTraits>(block, size, delim);
+            auto count = index == details::search_npos ? size : index;
+
+            str.append(static_cast<const Char *>(block), static_cast<size_type>(count));
+            extracted += count;
+
+            if (index != details::search_npos)
+            {
+                extracted++;
+                if (!details::streambuf_unget(buf, static_cast<std::streamsize>(size - index - 1)))
+                    state |= std::ios_base::badbit;
+                break;
+            }
+        }
+    }
+    catch (...)
+    {
+        state |= std::ios_base::badbit;
+    }
 
-    for (size_type i = 0; i < size; i++)
+    if (extracted == 0)
     {
-        is >> ptr[i];
+        state |= std::ios_base::failbit;
     }
 
+    is.setstate(state);
     return is;
 }
 
+/// Reads characters until a new line.
+template <typename Derived, typename Char, typename CharTraits, typename Allocator>
+std::basic_istream<Char, CharTraits> &
+getline(std::basic_istream<Char, CharTraits> &is, basic_str_core<Derived, Char, CharTraits, Allocator> &str)
+{
+    return getline(is, str, is.widen('\n'));
+}
+
 //////////////////////////////////////////////////////////////////////
 // TypeDefs
 //////////////////////////////////////////////////////////////////////
@@ -1745,232 +2714,291 @@ using u8str = basic_str<char8_t>;
 using u16str = basic_str<char16_t>;
 using u32str = basic_str<char32_t>;
 
+template <typename String>
+using str_adapter = basic_str_adapter<String>;
+
 //////////////////////////////////////////////////////////////////////
 // Numeric Conversions
 //////////////////////////////////////////////////////////////////////
 
+STR_NAMESPACE_DETAILS_BEGIN
+
+template <typename Derived, typename Allocator>
+using core_str = basic_str_core<Derived, char, std::char_traits<char>, Allocator>;
+
+template <typename Derived, typename Allocator>
+using core_wstr = basic_str_core<Derived, wchar_t, std::char_traits<wchar_t>, Allocator>;
+
+STR_NAMESPACE_DETAILS_END
+
+/// Parses a T in base from the characters in the range [s, s + count), see parse_result.
+/// No null terminator is needed and the locale is not used.
+/// float and double are decimal only and correctly rounded, base must be 10.
+template <typename T, typename Char>
+parse_result<T> parse(const Char *s, size_t count, unsigned base = 10) STR_NOEXCEPT
+{
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        if (base != 10)
+            return { T(), 0, std::errc::invalid_argument };
+
+        return details::convert_str_to_float<T>(s, count);
+    }
+    else
+    {
+        return details::convert_str_to_num<T>(s, count, base);
+    }
+}
+
+/// Parses a T in base from the characters of str.
+template <typename T, typename StringLike, std::enable_if_t<details::is_string_like_v<StringLike>, int> = 0>
+parse_result<T> parse(const StringLike &str, unsigned base = 10) STR_NOEXCEPT
+{
+    using traits = strtraits<StringLike>;
+    return parse<T>(traits::data(str), traits::size(str), base);
+}
+
 // converts a string to a signed integer
-int stoi(const str &str, size_t *pos = nullptr, int base = 10)
+template <typename Derived, typename Allocator>
+int stoi(const details::core_str<Derived, Allocator> &str, size_t *pos = nullptr, int base = 10)
 {
-    str::pointer ptr;
+    char *ptr;
     int result = static_cast<int>(
         std::strtol(str.c_str(), &ptr, base));
 
     if (pos != nullptr)
     {
-        *pos = str.c_str() - ptr;
+        *pos = static_cast<size_t>(ptr - str.c_str());
     }
 
     return result;
 }
-int stoi(const wstr &str, size_t *pos = nullptr, int base = 10)
+template <typename Derived, typename Allocator>
+int stoi(const details::core_wstr<Derived, Allocator> &str, size_t *pos = nullptr, int base = 10)
 {
-    wstr::pointer ptr;
+    wchar_t *ptr;
     int result = static_cast<int>(
         std::wcstol(str.c_str(), &ptr, base));
 
     if (pos != nullptr)
     {
-        *pos = str.c_str() - ptr;
+        *pos = static_cast<size_t>(ptr - str.c_str());
     }
 
     return result;
 }
 
 // converts a string to a signed long
-long stol(const str &str, size_t *pos = nullptr, int base = 10)
+template <typename Derived, typename Allocator>
+long stol(const details::core_str<Derived, Allocator> &str, size_t *pos = nullptr, int base = 10)
 {
-    str::pointer ptr;
+    char *ptr;
     long result = static_cast<long>(
         std::strtol(str.c_str(), &ptr, base));
 
     if (pos != nullptr)
     {
-        *pos = str.c_str() - ptr;
+        *pos = static_cast<size_t>(ptr - str.c_str());
     }
 
     return result;
 }
-long stol(const wstr &str, size_t *pos = nullptr, int base = 10)
+template <typename Derived, typename Allocator>
+long stol(const details::core_wstr<Derived, Allocator> &str, size_t *pos = nullptr, int base = 10)
 {
-    wstr::pointer ptr;
+    wchar_t *ptr;
     long result = static_cast<long>(
         std::wcstol(str.c_str(), &ptr, base));
 
     if (pos != nullptr)
     {
-        *pos = str.c_str() - ptr;
+        *pos = static_cast<size_t>(ptr - str.c_str());
     }
 
     return result;
 }
 
 // converts a string to a signed long long
-long long stoll(const str &str, size_t *pos = nullptr, int base = 10)
+template <typename Derived, typename Allocator>
+long long stoll(const details::core_str<Derived, Allocator> &str, size_t *pos = nullptr, int base = 10)
 {
-    str::pointer ptr;
+    char *ptr;
     long long result = static_cast<long long>(
         std::strtoll(str.c_str(), &ptr, base));
 
     if (pos != nullptr)
     {
-        *pos = str.c_str() - ptr;
+        *pos = static_cast<size_t>(ptr - str.c_str());
     }
 
     return result;
 }
-long long stoll(const wstr &str, size_t *pos = nullptr, int base = 10)
+template <typename Derived, typename Allocator>
+long long stoll(const details::core_wstr<Derived, Allocator> &str, size_t *pos = nullptr, int base = 10)
 {
-    wstr::pointer ptr;
+    wchar_t *ptr;
     long long result = static_cast<long long>(
         std::wcstoll(str.c_str(), &ptr, base));
 
     if (pos != nullptr)
     {
-        *pos = str.c_str() - ptr;
+        *pos = static_cast<size_t>(ptr - str.c_str());
     }
 
     return result;
 }
 
 // converts a string to a unsigned long
-unsigned long stoul(const str &str, size_t *pos = nullptr, int base = 10)
+template <typename Derived, typename Allocator>
+unsigned long stoul(const details::core_str<Derived, Allocator> &str, size_t *pos = nullptr, int base = 10)
 {
-    str::pointer ptr;
+    char *ptr;
     unsigned long result = static_cast<unsigned long>(
         std::strtoul(str.c_str(), &ptr, base));
 
     if (pos != nullptr)
     {
-        *pos = str.c_str() - ptr;
+        *pos = static_cast<size_t>(ptr - str.c_str());
     }
 
     return result;
 }
-unsigned long stoul(const wstr &str, size_t *pos = nullptr, int base = 10)
+template <typename Derived, typename Allocator>
+unsigned long stoul(const details::core_wstr<Derived, Allocator> &str, size_t *pos = nullptr, int base = 10)
 {
-    wstr::pointer ptr;
+    wchar_t *ptr;
     unsigned long result = static_cast<unsigned long>(
         std::wcstoul(str.c_str(), &ptr, base));
 
     if (pos != nullptr)
     {
-        *pos = str.c_str() - ptr;
+        *pos = static_cast<size_t>(ptr - str.c_str());
     }
 
     return result;
 }
 
 // converts a string to a unsigned long long
-unsigned long long stoull(const str &str, size_t *pos = nullptr, int base = 10)
+template <typename Derived, typename Allocator>
+unsigned long long stoull(const details::core_str<Derived, Allocator> &str, size_t *pos = nullptr, int base = 10)
 {
-    str::pointer ptr;
+    char *ptr;
     unsigned long long result = static_cast<unsigned long long>(
         std::strtoull(str.c_str(), &ptr, base));
 
     if (pos != nullptr)
     {
-        *pos = str.c_str() - ptr;
+        *pos = static_cast<size_t>(ptr - str.c_str());
     }
 
     return result;
 }
-unsigned long long stoull(const wstr &str, size_t *pos = nullptr, int base = 10)
+template <typename Derived, typename Allocator>
+unsigned long long stoull(const details::core_wstr<Derived, Allocator> &str, size_t *pos = nullptr, int base = 10)
 {
-    wstr::pointer ptr;
+    wchar_t *ptr;
     unsigned long long result = static_cast<unsigned long long>(
         std::wcstoull(str.c_str(), &ptr, base));
 
     if (pos != nullptr)
     {
-        *pos = str.c_str() - ptr;
+        *pos = static_cast<size_t>(ptr - str.c_str());
     }
 
     return result;
 }
 
-// converts a string to a signed integer
-float stof(const str &str, size_t *pos = nullptr)
+// converts a string to a float
+template <typename Derived, typename Allocator>
+float stof(const details::core_str<Derived, Allocator> &str, size_t *pos = nullptr)
 {
-    str::pointer ptr;
+    char *ptr;
     float result = static_cast<float>(
         std::strtof(str.c_str(), &ptr));
 
     if (pos != nullptr)
     {
-        *pos = str.c_str() - ptr;
+        *pos = static_cast<size_t>(ptr - str.c_str());
     }
 
     return result;
 }
-float stof(const wstr &str, size_t *pos = nullptr)
+template <typename Derived, typename Allocator>
+float stof(const details::core_wstr<Derived, Allocator> &str, size_t *pos = nullptr)
 {
-    wstr::pointer ptr;
+    wchar_t *ptr;
     float result = static_cast<float>(
         std::wcstof(str.c_str(), &ptr));
 
     if (pos != nullptr)
     {
-        *pos = str.c_str() - ptr;
+        *pos = static_cast<size_t>(ptr - str.c_str());
     }
 
     return result;
 }
 
-// converts a string to a signed long
-long stod(const str &str, size_t *pos = nullptr)
+// converts a string to a double
+template <typename Derived, typename Allocator>
+double stod(const details::core_str<Derived, Allocator> &str, size_t *pos = nullptr)
 {
-    str::pointer ptr;
-    long result = static_cast<long>(
-        std::strtof(str.c_str(), &ptr));
+    char *ptr;
+    double result = static_cast<double>(
+        std::strtod(str.c_str(), &ptr));
 
     if (pos != nullptr)
     {
-        *pos = str.c_str() - ptr;
+        *pos = static_cast<size_t>(ptr - str.c_str());
     }
 
     return result;
 }
-long stod(const wstr &str, size_t *pos = nullptr)
+template <typename Derived, typename Allocator>
+double stod(const details::core_wstr<Derived, Allocator> &str, size_t *pos = nullptr)
 {
-    wstr::pointer ptr;
-    long result = static_cast<long>(
-        std::wcstof(str.c_str(), &ptr));
+    wchar_t *ptr;
+    double result = static_cast<double>(
+        std::wcstod(str.c_str(), &ptr));
 
     if (pos != nullptr)
     {
-        *pos = str.c_str() - ptr;
+        *pos = static_cast<size_t>(ptr - str.c_str());
     }
 
     return result;
 }
 
-// converts a string to a signed long long
-long long stold(const str &str, size_t *pos = nullptr)
+// converts a string to a long double
+template <typename Derived, typename Allocator>
+long double stold(const details::core_str<Derived, Allocator> &str, size_t *pos = nullptr)
 {
-    str::pointer ptr;
-    long long result = static_cast<long long>(
+    char *ptr;
+    long double result = static_cast<long double>(
         std::strtold(str.c_str(), &ptr));
 
     if (pos != nullptr)
     {
-        *pos = str.c_str() - ptr;
+        *pos = static_cast<size_t>(ptr - str.c_str());
     }
 
     return result;
 }
-long long stold(const wstr &str, size_t *pos = nullptr)
+template <typename Derived, typename Allocator>
+long double stold(const details::core_wstr<Derived, Allocator> &str, size_t *pos = nullptr)
 {
-    wstr::pointer ptr;
-    long long result = static_cast<long long>(
+    wchar_t *ptr;
+    long double result = static_cast<long double>(
         std::wcstold(str.c_str(), &ptr));
 
     if (pos != nullptr)
     {
-        *pos = str.c_str() - ptr;
+        *pos = static_cast<size_t>(ptr - str.c_str());
     }
 
     return result;
 }
 
-STR_NAMESPACE_MAIN_END
\ No newline at end of file
+STR_NAMESPACE_MAIN_END
+
+#include "strview.hpp"
+#include "strconcat.hpp"
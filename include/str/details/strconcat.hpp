@@ -0,0 +1,213 @@
+#pragma once
+#include "str.hpp"
+
+STR_NAMESPACE_MAIN_BEGIN
+
+STR_NAMESPACE_DETAILS_BEGIN
+
+template <typename T>
+struct is_strconcat : std::false_type
+{
+};
+
+template <typename Char, typename CharTraits, typename Lhs, typename Rhs>
+struct is_strconcat<basic_strconcat<Char, CharTraits, Lhs, Rhs>> : std::true_type
+{
+};
+
+template <typename T>
+inline constexpr bool is_strconcat_v = is_strconcat<T>::value;
+
+/// Checks whether T is a string of Char described by strtraits.
+template <typename T, typename Char, typename = void>
+struct is_concat_string : std::false_type
+{
+};
+
+template <typename T, typename Char>
+struct is_concat_string<T, Char, std::void_t<typename T::value_type>>
+    : std::bool_constant<std::is_same_v<typename T::value_type, Char>>
+{
+};
+
+/// Checks whether T can be an operand of a concatenation of Char strings:
+/// a character, a null-terminated string or a string described by strtraits.
+template <typename T, typename Char>
+inline constexpr bool is_concat_part_v = std::is_same_v<T, Char> ||
+                                         std::is_convertible_v<const T &, const Char *> ||
+                                         is_concat_string<T, Char>::value;
+
+/// Type an operand is held as: characters by value, strings as views.
+template <typename T, typename Char, typename CharTraits>
+using concat_part_t = std::conditional_t<std::is_same_v<T, Char> || is_strconcat_v<T>, T,
+                                         basic_strview<Char, CharTraits>>;
+
+STR_NAMESPACE_DETAILS_END
+
+/// Concatenation of two operands made by operator+, nested for longer chains.
+/// Nothing is copied until it is appended or assigned to a string, which then
+/// computes the final size once and writes every part into a single allocation.
+/// @note it views its operands, so it must not outlive them: store it in a string,
+/// not in an auto variable.
+template <typename Char, typename CharTraits, typename Lhs, typename Rhs>
+class basic_strconcat
+{
+public:
+    using value_type = Char;
+    using traits_type = CharTraits;
+    using size_type = std::size_t;
+    using lhs_type = Lhs;
+    using rhs_type = Rhs;
+
+public:
+    STR_CONSTEXPR basic_strconcat(const Lhs &lhs, const Rhs &rhs) STR_NOEXCEPT
+        : lhs_{lhs}, rhs_{rhs} {}
+
+    STR_CONSTEXPR const Lhs &lhs() const STR_NOEXCEPT
+    {
+        return lhs_;
+    }
+
+    STR_CONSTEXPR const Rhs &rhs() const STR_NOEXCEPT
+    {
+        return rhs_;
+    }
+
+    /// Returns the count of characters of the concatenation.
+    STR_CONSTEXPR size_type size() const STR_NOEXCEPT
+    {
+        return size_(lhs_) + size_(rhs_);
+    }
+
+    /// Checks whether a part views characters in the range [first, last).
+    STR_CONSTEXPR bool views(const value_type *first, const value_type *last) const STR_NOEXCEPT
+    {
+        return views_(lhs_, first, last) || views_(rhs_, first, last);
+    }
+
+    /// Writes the characters to out and returns the end of them.
+    /// parts viewing the range [first, last) are read at the same offset from moved,
+    /// where a string appended to itself has moved its characters.
+    STR_CONSTEXPR value_type *write(value_type *out, const value_type *first = nullptr,
+                                    const value_type *last = nullptr, const value_type *moved = nullptr) const STR_NOEXCEPT
+    {
+        out = write_(out, lhs_, first, last, moved);
+        return write_(out, rhs_, first, last, moved);
+    }
+
+private:
+    using view_type = basic_strview<Char, CharTraits>;
+
+    STR_CONSTEXPR static size_type size_(value_type) STR_NOEXCEPT
+    {
+        return 1;
+    }
+
+    STR_CONSTEXPR static size_type size_(const view_type &part) STR_NOEXCEPT
+    {
+        return part.size();
+    }
+
+    template <typename L, typename R>
+    STR_CONSTEXPR static size_type size_(const basic_strconcat<Char, CharTraits, L, R> &part) STR_NOEXCEPT
+    {
+        return part.size();
+    }
+
+    STR_CONSTEXPR static bool views_(value_type, const value_type *, const value_type *) STR_NOEXCEPT
+    {
+        return false;
+    }
+
+    STR_CONSTEXPR static bool views_(const view_type &part, const value_type *first, const value_type *last) STR_NOEXCEPT
+    {
+        return std::less_equal<const value_type *>()(first, part.data()) &&
+               std::less<const value_type *>()(part.data(), last);
+    }
+
+    template <typename L, typename R>
+    STR_CONSTEXPR static bool views_(const basic_strconcat<Char, CharTraits, L, R> &part,
+                                     const value_type *first, const value_type *last) STR_NOEXCEPT
+    {
+        return part.views(first, last);
+    }
+
+    STR_CONSTEXPR static value_type *write_(value_type *out, value_type part,
+                                            const value_type *, const value_type *, const value_type *) STR_NOEXCEPT
+    {
+        traits_type::assign(*out, part);
+        return out + 1;
+    }
+
+    STR_CONSTEXPR static value_type *write_(value_type *out, const view_type &part,
+                                            const value_type *first, const value_type *last, const value_type *moved) STR_NOEXCEPT
+    {
+        auto ptr = part.data();
+        if (views_(part, first, last))
+        {
+            ptr = moved + (ptr - first);
+        }
+
+        if (part.size())
+        {
+            traits_type::copy(out, ptr, part.size());
+        }
+
+        return out + part.size();
+    }
+
+    template <typename L, typename R>
+    STR_CONSTEXPR static value_type *write_(value_type *out, const basic_strconcat<Char, CharTraits, L, R> &part,
+                                            const value_type *first, const value_type *last, const value_type *moved) STR_NOEXCEPT
+    {
+        return part.write(out, first, last, moved);
+    }
+
+protected:
+    Lhs lhs_;
+    Rhs rhs_;
+};
+
+//////////////////////////////////////////////////////////////////////
+// operator +
+//////////////////////////////////////////////////////////////////////
+
+template <typename Char, typename CharTraits, typename Lhs, typename Rhs, typename Part,
+          std::enable_if_t<details::is_concat_part_v<Part, Char> && !details::is_strconcat_v<Part>, int> = 0>
+STR_CONSTEXPR basic_strconcat<Char, CharTraits, basic_strconcat<Char, CharTraits, Lhs, Rhs>,
+                              details::concat_part_t<Part, Char, CharTraits>>
+operator+(const basic_strconcat<Char, CharTraits, Lhs, Rhs> &lhs, const Part &rhs)
+{
+    return { lhs, rhs };
+}
+
+template <typename Char, typename CharTraits, typename Lhs, typename Rhs, typename Part,
+          std::enable_if_t<details::is_concat_part_v<Part, Char> && !details::is_strconcat_v<Part>, int> = 0>
+STR_CONSTEXPR basic_strconcat<Char, CharTraits, details::concat_part_t<Part, Char, CharTraits>,
+                              basic_strconcat<Char, CharTraits, Lhs, Rhs>>
+operator+(const Part &lhs, const basic_strconcat<Char, CharTraits, Lhs, Rhs> &rhs)
+{
+    return { lhs, rhs };
+}
+
+template <typename Char, typename CharTraits, typename Lhs1, typename Rhs1, typename Lhs2, typename Rhs2>
+STR_CONSTEXPR basic_strconcat<Char, CharTraits, basic_strconcat<Char, CharTraits, Lhs1, Rhs1>,
+                              basic_strconcat<Char, CharTraits, Lhs2, Rhs2>>
+operator+(const basic_strconcat<Char, CharTraits, Lhs1, Rhs1> &lhs,
+          const basic_strconcat<Char, CharTraits, Lhs2, Rhs2> &rhs)
+{
+    return { lhs, rhs };
+}
+
+//////////////////////////////////////////////////////////////////////
+// OStream Operator
+//////////////////////////////////////////////////////////////////////
+
+template <typename Char, typename CharTraits, typename Lhs, typename Rhs>
+std::basic_ostream<Char, CharTraits> &
+operator<<(std::basic_ostream<Char, CharTraits> &os, const basic_strconcat<Char, CharTraits, Lhs, Rhs> &expr)
+{
+    return os << expr.lhs() << expr.rhs();
+}
+
+STR_NAMESPACE_MAIN_END
@@ -0,0 +1,181 @@
+#pragma once
+#include "common.hpp"
+#include "strtraits.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+STR_NAMESPACE_MAIN_BEGIN
+
+/// Batch of inserts and erases recorded against the offsets of a string,
+/// applied at once by the apply() member of the strings.
+/// The inserted characters are copied into the batch, so they may come from
+/// the edited string itself. Edits at the same offset apply in recording order,
+/// erased ranges must not overlap each other or the offsets of other edits.
+template <typename Char, typename CharTraits = std::char_traits<Char>>
+class basic_stredit
+{
+public:
+    using value_type = Char;
+    using traits_type = CharTraits;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    /// A single edit, insert data_size characters of the batch starting
+    /// at data_offset in place of [offset, offset+erase) of the string.
+    struct edit_type
+    {
+        size_type offset;
+        size_type erase;
+        size_type data_offset;
+        size_type data_size;
+    };
+
+    using const_iterator = typename std::vector<edit_type>::const_iterator;
+
+public:
+    //////////////////////////////////////////////////////////////////////
+    // CONSTRUCTORS / DESTRUCTOR
+    //////////////////////////////////////////////////////////////////////
+
+    STR_CONSTEXPR basic_stredit() STR_NOEXCEPT = default;
+
+    //////////////////////////////////////////////////////////////////////
+    // RECORDING
+    //////////////////////////////////////////////////////////////////////
+
+    /// Records inserting count copies of character ch at offset.
+    STR_CONSTEXPR basic_stredit &insert(size_type offset, value_type ch, size_type count = 1)
+    {
+        return replace(offset, 0, ch, count);
+    }
+
+    /// Records inserting the null-terminated character string s at offset.
+    STR_CONSTEXPR basic_stredit &insert(size_type offset, const value_type *s)
+    {
+        return replace(offset, 0, s, traits_type::length(s));
+    }
+
+    /// Records inserting the characters in the range [s, s+count) at offset.
+    STR_CONSTEXPR basic_stredit &insert(size_type offset, const value_type *s, size_type count)
+    {
+        return replace(offset, 0, s, count);
+    }
+
+    /// Records inserting the characters of str at offset.
+    template <typename StringLike>
+    STR_CONSTEXPR basic_stredit &insert(size_type offset, const StringLike &str)
+    {
+        return replace(offset, 0, str);
+    }
+
+    /// Records erasing the characters in the range [offset, offset+count).
+    STR_CONSTEXPR basic_stredit &erase(size_type offset, size_type count)
+    {
+        return replace(offset, count, nullptr, 0);
+    }
+
+    /// Records replacing the characters in the range [offset, offset+count) with count2 copies of ch.
+    STR_CONSTEXPR basic_stredit &replace(size_type offset, size_type count, value_type ch, size_type count2)
+    {
+        auto &edit = add_(offset, count);
+        chars_.insert(chars_.end(), count2, ch);
+        edit.data_size = count2;
+        return *this;
+    }
+
+    /// Records replacing the characters in the range [offset, offset+count) with the null-terminated string s.
+    STR_CONSTEXPR basic_stredit &replace(size_type offset, size_type count, const value_type *s)
+    {
+        return replace(offset, count, s, traits_type::length(s));
+    }
+
+    /// Records replacing the characters in the range [offset, offset+count) with the range [s, s+count2).
+    STR_CONSTEXPR basic_stredit &replace(size_type offset, size_type count, const value_type *s, size_type count2)
+    {
+        auto &edit = add_(offset, count);
+        chars_.insert(chars_.end(), s, s + count2);
+        edit.data_size = count2;
+        return *this;
+    }
+
+    /// Records replacing the characters in the range [offset, offset+count) with str.
+    template <typename StringLike>
+    STR_CONSTEXPR basic_stredit &replace(size_type offset, size_type count, const StringLike &str)
+    {
+        using othertraits = strtraits<StringLike>;
+
+        static_assert(std::is_same_v<value_type, typename othertraits::char_type>,
+                      "char_type must be same for both string types");
+
+        return replace(offset, count, othertraits::data(str), othertraits::size(str));
+    }
+
+    /// Removes all the recorded edits.
+    STR_CONSTEXPR void clear() STR_NOEXCEPT
+    {
+        edits_.clear();
+        chars_.clear();
+    }
+
+    //////////////////////////////////////////////////////////////////////
+    // ACCESS
+    //////////////////////////////////////////////////////////////////////
+
+    /// Returns the count of recorded edits.
+    STR_CONSTEXPR size_type size() const STR_NOEXCEPT
+    {
+        return edits_.size();
+    }
+
+    STR_CONSTEXPR bool empty() const STR_NOEXCEPT
+    {
+        return edits_.empty();
+    }
+
+    /// Iterates the edits sorted by offset.
+    STR_CONSTEXPR const_iterator begin() const STR_NOEXCEPT
+    {
+        return edits_.begin();
+    }
+
+    STR_CONSTEXPR const_iterator end() const STR_NOEXCEPT
+    {
+        return edits_.end();
+    }
+
+    /// Returns the inserted characters of edit.
+    STR_CONSTEXPR const value_type *data(const edit_type &edit) const STR_NOEXCEPT
+    {
+        return chars_.data() + edit.data_offset;
+    }
+
+protected:
+    /// Adds an edit after the edits with the same or lower offsets.
+    STR_CONSTEXPR edit_type &add_(size_type offset, size_type count)
+    {
+        auto it = std::upper_bound(edits_.begin(), edits_.end(), offset,
+                                   [](size_type value, const edit_type &edit)
+                                   { return value < edit.offset; });
+
+        return *edits_.insert(it, edit_type{ offset, count, chars_.size(), 0 });
+    }
+
+protected:
+    std::vector<edit_type> edits_;
+    std::vector<value_type> chars_;
+};
+
+//////////////////////////////////////////////////////////////////////
+// TypeDefs
+//////////////////////////////////////////////////////////////////////
+
+using stredit = basic_stredit<char>;
+using wstredit = basic_stredit<wchar_t>;
+using u8stredit = basic_stredit<char8_t>;
+using u16stredit = basic_stredit<char16_t>;
+using u32stredit = basic_stredit<char32_t>;
+
+STR_NAMESPACE_MAIN_END
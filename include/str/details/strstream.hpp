@@ -0,0 +1,141 @@
+#pragma once
+#include "str.hpp"
+#include <ostream>
+#include <streambuf>
+
+STR_NAMESPACE_MAIN_BEGIN
+
+/// Stream buffer appending to a string. The put area is the free capacity of
+/// the string, so std::ostream writes land in its storage directly and nothing
+/// is copied out afterwards, unlike std::ostringstream::str().
+/// The string size catches up on sync(), on growth and on destruction;
+/// call str() or pubsync() before reading the string while the buffer is alive.
+template <typename String>
+class basic_strstreambuf : public std::basic_streambuf<typename String::value_type, typename String::traits_type>
+{
+    using base_t = std::basic_streambuf<typename String::value_type, typename String::traits_type>;
+
+public:
+    using string_type = String;
+    using char_type = typename base_t::char_type;
+    using traits_type = typename base_t::traits_type;
+    using int_type = typename base_t::int_type;
+    using size_type = typename String::size_type;
+
+public:
+    explicit basic_strstreambuf(String &str)
+        : str_{&str}
+    {
+        reset_();
+    }
+
+    basic_strstreambuf(const basic_strstreambuf &) = delete;
+    basic_strstreambuf &operator=(const basic_strstreambuf &) = delete;
+
+    ~basic_strstreambuf() override
+    {
+        commit_();
+    }
+
+    /// Returns the string with every character written so far.
+    String &str()
+    {
+        commit_();
+        reset_();
+        return *str_;
+    }
+
+protected:
+    int sync() override
+    {
+        commit_();
+        reset_();
+        return 0;
+    }
+
+    int_type overflow(int_type ch) override
+    {
+        if (traits_type::eq_int_type(ch, traits_type::eof()))
+            return traits_type::not_eof(ch);
+
+        commit_();
+        str_->reserve(str_->size() + 1);
+        reset_();
+
+        // a fixed capacity string is full
+        if (this->pptr() == this->epptr())
+            return traits_type::eof();
+
+        *this->pptr() = traits_type::to_char_type(ch);
+        this->pbump(1);
+        return ch;
+    }
+
+    std::streamsize xsputn(const char_type *s, std::streamsize count) override
+    {
+        if (count <= this->epptr() - this->pptr())
+        {
+            traits_type::copy(this->pptr(), s, static_cast<std::size_t>(count));
+            this->pbump(static_cast<int>(count));
+            return count;
+        }
+
+        commit_();
+        str_->append(s, static_cast<size_type>(count));
+        reset_();
+        return count;
+    }
+
+protected:
+    /// Appends the characters of the put area to the string.
+    void commit_()
+    {
+        if (this->pbase())
+        {
+            auto span = str_->append_uninitialized(static_cast<size_type>(this->epptr() - this->pbase()));
+            span.commit(static_cast<size_type>(this->pptr() - this->pbase()));
+        }
+
+        this->setp(nullptr, nullptr);
+    }
+
+    /// Makes the free capacity of the string the put area.
+    void reset_()
+    {
+        auto span = str_->append_uninitialized(str_->capacity() - str_->size());
+        this->setp(span.begin(), span.end());
+    }
+
+protected:
+    String *str_;
+};
+
+/// Output stream appending to a string through a basic_strstreambuf.
+template <typename String>
+class basic_strostream : public std::basic_ostream<typename String::value_type, typename String::traits_type>
+{
+    using base_t = std::basic_ostream<typename String::value_type, typename String::traits_type>;
+
+public:
+    explicit basic_strostream(String &str)
+        : base_t{nullptr}, buf_{str}
+    {
+        this->init(&buf_);
+    }
+
+    /// Returns the string with every character written so far.
+    String &str()
+    {
+        return buf_.str();
+    }
+
+    basic_strstreambuf<String> *rdbuf() const
+    {
+        return const_cast<basic_strstreambuf<String> *>(&buf_);
+    }
+
+protected:
+    basic_strstreambuf<String> buf_;
+};
+
+STR_NAMESPACE_MAIN_END
@@ -1,6 +1,8 @@
 #pragma once
 #include "common.hpp"
 #include "tweaks.hpp"
+#include <type_traits>
+#include <utility>
 
 STR_NAMESPACE_MAIN_BEGIN
 
@@ -56,4 +58,25 @@ public:
 
 #endif
 
+STR_NAMESPACE_DETAILS_BEGIN
+
+template <typename T, typename = void>
+struct has_strtraits : std::false_type
+{
+};
+
+template <typename T>
+struct has_strtraits<T, std::void_t<decltype(strtraits<T>::data(std::declval<const T &>())),
+                                    decltype(strtraits<T>::size(std::declval<const T &>()))>> : std::true_type
+{
+};
+
+/// True when T is a string described by strtraits. Pointers, arrays and other
+/// non-class types are rejected before strtraits<T> is instantiated, so that
+/// overloads taking a pointer and a length are chosen for them.
+template <typename T>
+inline constexpr bool is_string_like_v = std::conjunction_v<std::is_class<T>, has_strtraits<T>>;
+
+STR_NAMESPACE_DETAILS_END
+
 STR_NAMESPACE_MAIN_END
\ No newline at end of file
@@ -0,0 +1,324 @@
+#pragma once
+#include "heapstr.hpp"
+#include "stackstr.hpp"
+#include <iterator>
+
+STR_NAMESPACE_MAIN_BEGIN
+
+STR_NAMESPACE_DETAILS_BEGIN
+
+template <typename T>
+inline constexpr bool is_char_type_v = std::is_same_v<T, char> || std::is_same_v<T, wchar_t> ||
+                                       std::is_same_v<T, char8_t> || std::is_same_v<T, char16_t> ||
+                                       std::is_same_v<T, char32_t>;
+
+/// Checks whether T is a number written through append_int() or append_float().
+template <typename T>
+inline constexpr bool is_number_part_v = std::is_floating_point_v<T> ||
+                                         (std::is_integral_v<T> && !std::is_same_v<T, bool> && !is_char_type_v<T>);
+
+/// Marks the size of a part that is only known at run time.
+inline constexpr std::size_t dynamic_part_size = static_cast<std::size_t>(-1);
+
+/// Character type of a part, void for numbers.
+template <typename T, typename = void>
+struct part_char
+{
+    using type = void;
+};
+
+template <typename T>
+struct part_char<T, std::enable_if_t<is_char_type_v<T>>>
+{
+    using type = T;
+};
+
+template <typename T>
+struct part_char<T *, std::enable_if_t<is_char_type_v<std::remove_cv_t<T>>>>
+{
+    using type = std::remove_cv_t<T>;
+};
+
+template <typename T, std::size_t N>
+struct part_char<T[N], std::enable_if_t<is_char_type_v<std::remove_cv_t<T>>>>
+{
+    using type = std::remove_cv_t<T>;
+};
+
+template <typename T>
+struct part_char<T, std::void_t<typename T::value_type>>
+{
+    using type = typename T::value_type;
+};
+
+/// Character type of the first part that has one, char if they are all numbers.
+template <typename... Parts>
+struct parts_char
+{
+    using type = char;
+};
+
+template <typename Part, typename... Parts>
+struct parts_char<Part, Parts...>
+{
+    using type = std::conditional_t<std::is_void_v<typename part_char<Part>::type>,
+                                    typename parts_char<Parts...>::type,
+                                    typename part_char<Part>::type>;
+};
+
+template <typename... Parts>
+using parts_char_t = typename parts_char<Parts...>::type;
+
+/// Maximum count of characters of a part known at compile time, or dynamic_part_size.
+template <typename T, typename = void>
+struct part_max_size : std::integral_constant<std::size_t, dynamic_part_size>
+{
+};
+
+template <typename T>
+struct part_max_size<T, std::enable_if_t<is_char_type_v<T>>> : std::integral_constant<std::size_t, 1>
+{
+};
+
+template <typename T>
+struct part_max_size<T, std::enable_if_t<std::is_integral_v<T> && is_number_part_v<T>>>
+    : std::integral_constant<std::size_t, max_num_chars<T>>
+{
+};
+
+// the shortest form of any double, -2.2250738585072014e-308
+template <typename T>
+struct part_max_size<T, std::enable_if_t<std::is_floating_point_v<T>>> : std::integral_constant<std::size_t, 24>
+{
+};
+
+template <typename T, std::size_t N>
+struct part_max_size<T[N], std::enable_if_t<is_char_type_v<std::remove_cv_t<T>>>>
+    : std::integral_constant<std::size_t, N - 1>
+{
+};
+
+template <std::size_t Size, typename Char, typename CharTraits, typename Allocator>
+struct part_max_size<basic_stackstr<Size, Char, CharTraits, Allocator>> : std::integral_constant<std::size_t, Size>
+{
+};
+
+template <typename... Parts>
+inline constexpr std::size_t parts_max_size =
+    ((part_max_size<Parts>::value == dynamic_part_size) || ...)
+        ? dynamic_part_size
+        : (std::size_t(0) + ... + part_max_size<Parts>::value);
+
+/// A character part.
+template <typename Char>
+struct char_part
+{
+    Char ch;
+
+    STR_CONSTEXPR std::size_t size() const STR_NOEXCEPT
+    {
+        return 1;
+    }
+
+    template <typename String>
+    STR_CONSTEXPR void append_to(String &str) const
+    {
+        str.append(ch);
+    }
+};
+
+/// A string part, viewed.
+template <typename Char, typename CharTraits>
+struct string_part
+{
+    basic_strview<Char, CharTraits> view;
+
+    STR_CONSTEXPR std::size_t size() const STR_NOEXCEPT
+    {
+        return view.size();
+    }
+
+    template <typename String>
+    STR_CONSTEXPR void append_to(String &str) const
+    {
+        str.append(view.data(), view.size());
+    }
+};
+
+/// A concatenation expression made by operator+.
+template <typename Expr>
+struct expr_part
+{
+    const Expr &expr;
+
+    STR_CONSTEXPR std::size_t size() const STR_NOEXCEPT
+    {
+        return expr.size();
+    }
+
+    template <typename String>
+    STR_CONSTEXPR void append_to(String &str) const
+    {
+        str.append(expr);
+    }
+};
+
+/// An integer part, written in base 10.
+template <typename Int>
+struct int_part
+{
+    Int value;
+
+    STR_CONSTEXPR std::size_t size() const STR_NOEXCEPT
+    {
+        return count_num_chars(value);
+    }
+
+    template <typename String>
+    STR_CONSTEXPR void append_to(String &str) const
+    {
+        str.append_int(value);
+    }
+};
+
+/// A floating point part, in its shortest form.
+/// The digits are computed once when the part is made, then measured and written.
+template <typename Float>
+struct float_part
+{
+    float_chars chars;
+    std::size_t count;
+
+    explicit float_part(Float value) STR_NOEXCEPT
+    {
+        to_float_chars(chars, value, float_format::general, -1);
+        count = write_float_chars<char>(nullptr, chars);
+    }
+
+    std::size_t size() const STR_NOEXCEPT
+    {
+        return count;
+    }
+
+    template <typename String>
+    void append_to(String &str) const
+    {
+        auto span = str.append_uninitialized(count);
+        write_float_chars(span.data(), chars);
+        span.commit(count);
+    }
+};
+
+/// Wraps value in the part it is measured and appended through.
+template <typename Char, typename CharTraits, typename T>
+STR_CONSTEXPR auto make_part(const T &value)
+{
+    if constexpr (std::is_same_v<T, Char>)
+    {
+        return char_part<Char>{ value };
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        return float_part<T>(value);
+    }
+    else if constexpr (is_number_part_v<T>)
+    {
+        return int_part<T>{ value };
+    }
+    else if constexpr (is_strconcat_v<T>)
+    {
+        return expr_part<T>{ value };
+    }
+    else
+    {
+        static_assert(is_concat_part_v<T, Char>, "part must be a number, a character or a string of the same character type");
+        return string_part<Char, CharTraits>{ basic_strview<Char, CharTraits>(value) };
+    }
+}
+
+STR_NAMESPACE_DETAILS_END
+
+/// Concatenates the parts: characters, null-terminated strings, strings described
+/// by strtraits and numbers, written like append_int() and append_float().
+/// The parts are measured first, then appended to a string allocated once.
+/// @return a stackstr of the summed maximum sizes if they are all known at compile time
+/// (characters, arrays, stackstr and numbers), else a heapstr.
+template <typename... Parts>
+auto concat(const Parts &...parts)
+{
+    using char_type = details::parts_char_t<Parts...>;
+    using traits_type = std::char_traits<char_type>;
+    constexpr auto max_size = details::parts_max_size<Parts...>;
+
+    using string_type = std::conditional_t<max_size == details::dynamic_part_size,
+                                           basic_heapstr<char_type, traits_type>,
+                                           basic_stackstr<max_size, char_type, traits_type>>;
+
+    auto wrapped = std::make_tuple(details::make_part<char_type, traits_type>(parts)...);
+    auto size = std::apply([](const auto &...part)
+                           { return (std::size_t(0) + ... + part.size()); },
+                           wrapped);
+
+    string_type str;
+    str.reserve_exact(size);
+    std::apply([&str](const auto &...part)
+               { (part.append_to(str), ...); },
+               wrapped);
+
+    return str;
+}
+
+/// Joins the elements of range separated by sep, each of them a part like in concat().
+/// The elements are measured first, then appended to a heapstr allocated once.
+/// Floating point elements are measured by their maximum size, so that each of
+/// them is formatted once, when it is appended.
+template <typename Range, typename Separator>
+auto join(const Range &range, const Separator &sep)
+{
+    using element_type = std::decay_t<decltype(*std::begin(range))>;
+    using char_type = details::parts_char_t<Separator, element_type>;
+    using traits_type = std::char_traits<char_type>;
+
+    auto separator = details::make_part<char_type, traits_type>(sep);
+
+    std::size_t size = 0;
+    std::size_t count = 0;
+    for (const auto &element : range)
+    {
+        if constexpr (std::is_floating_point_v<element_type>)
+        {
+            size += details::part_max_size<element_type>::value;
+        }
+        else
+        {
+            size += details::make_part<char_type, traits_type>(element).size();
+        }
+
+        count++;
+    }
+
+    if (count > 0)
+    {
+        size += separator.size() * (count - 1);
+    }
+
+    basic_heapstr<char_type, traits_type> str;
+    str.reserve_exact(size);
+
+    bool first = true;
+    for (const auto &element : range)
+    {
+        if (!first)
+        {
+            separator.append_to(str);
+        }
+
+        first = false;
+
+        details::make_part<char_type, traits_type>(element).append_to(str);
+    }
+
+    return str;
+}
+
+STR_NAMESPACE_MAIN_END
@@ -0,0 +1,263 @@
+#pragma once
+#include "str.hpp"
+
+STR_NAMESPACE_MAIN_BEGIN
+
+/// Non-owning view of a character range, a pointer and a length.
+/// It is trivially copyable, so it is passed in registers, and offers the
+/// read-only part of the string API: element access, compare and search.
+/// @note the range is not required to be null-terminated.
+template <typename Char, typename CharTraits>
+class basic_strview : private basic_str_core<basic_strview<Char, CharTraits>, Char, CharTraits, std::allocator<Char>>
+{
+    using this_t = basic_strview<Char, CharTraits>;
+
+public:
+    using base_t = basic_str_core<this_t, Char, CharTraits, std::allocator<Char>>;
+    using value_type = typename base_t::value_type;
+    using traits_type = typename base_t::traits_type;
+    using size_type = typename base_t::size_type;
+    using difference_type = typename base_t::difference_type;
+    using reference = typename base_t::const_reference;
+    using const_reference = typename base_t::const_reference;
+    using pointer = typename base_t::const_pointer;
+    using const_pointer = typename base_t::const_pointer;
+    using iterator = typename base_t::const_iterator;
+    using const_iterator = typename base_t::const_iterator;
+    using reverse_iterator = typename base_t::const_reverse_iterator;
+    using const_reverse_iterator = typename base_t::const_reverse_iterator;
+
+    using base_t::npos;
+
+    using base_t::length;
+    using base_t::empty;
+    using base_t::toindex;
+    using base_t::cit;
+    using base_t::crit;
+    using base_t::compare;
+    using base_t::starts_with;
+    using base_t::ends_with;
+    using base_t::contains;
+    using base_t::copy;
+    using base_t::find;
+    using base_t::rfind;
+    using base_t::find_first_of;
+    using base_t::find_first_not_of;
+    using base_t::find_last_of;
+    using base_t::find_last_not_of;
+
+    friend base_t;
+
+public:
+    //////////////////////////////////////////////////////////////////////
+    // CONSTRUCTORS / DESTRUCTOR
+    //////////////////////////////////////////////////////////////////////
+
+    STR_CONSTEXPR basic_strview() STR_NOEXCEPT = default;
+    STR_CONSTEXPR basic_strview(const basic_strview &) STR_NOEXCEPT = default;
+    STR_CONSTEXPR basic_strview &operator=(const basic_strview &) STR_NOEXCEPT = default;
+
+    /// Views the null-terminated character string pointed to by s.
+    STR_CONSTEXPR basic_strview(const value_type *s)
+        : ptr_{s}, size_{static_cast<size_type>(traits_type::length(s))} {}
+
+    /// Views the characters in the range [s, s + count).
+    STR_CONSTEXPR basic_strview(const value_type *s, size_type count) STR_NOEXCEPT
+        : ptr_{s}, size_{count} {}
+
+    /// Views the characters of str, which is described by strtraits.
+    template <typename StringLike,
+              std::enable_if_t<std::is_same_v<typename StringLike::value_type, Char> &&
+                                   !std::is_same_v<StringLike, basic_strview>,
+                               int> = 0>
+    STR_CONSTEXPR basic_strview(const StringLike &str)
+        : ptr_{this->getptr_(str)}, size_{this->getsize_(str)} {}
+
+    //////////////////////////////////////////////////////////////////////
+    // ELEMENT ACCESS
+    //////////////////////////////////////////////////////////////////////
+
+    /// Accesses the specified character with bounds checking.
+    /// std::out_of_range will be thrown on invalid access.
+    STR_CONSTEXPR const_reference at(size_type index) const
+    {
+        this->template assert_<std::out_of_range>(index < size_, "'index' was out of range");
+        return ptr_[index];
+    }
+
+    /// Accesses the specified character.
+    /// @note no bound checking is performed.
+    STR_CONSTEXPR const_reference operator[](size_type pos) const
+    {
+        return ptr_[pos];
+    }
+
+    /// @note The behavior is undefined if empty() == true.
+    STR_CONSTEXPR const_reference front() const
+    {
+        return ptr_[0];
+    }
+
+    /// @note The behavior is undefined if empty() == true.
+    STR_CONSTEXPR const_reference back() const
+    {
+        return ptr_[size_ - 1];
+    }
+
+    /// Returns a pointer to the first character.
+    STR_CONSTEXPR const_pointer data() const STR_NOEXCEPT
+    {
+        return ptr_;
+    }
+
+    //////////////////////////////////////////////////////////////////////
+    // ITERATORS
+    //////////////////////////////////////////////////////////////////////
+
+    STR_CONSTEXPR const_iterator begin() const STR_NOEXCEPT
+    {
+        return ptr_;
+    }
+
+    STR_CONSTEXPR const_iterator cbegin() const STR_NOEXCEPT
+    {
+        return ptr_;
+    }
+
+    STR_CONSTEXPR const_iterator end() const STR_NOEXCEPT
+    {
+        return ptr_ + size_;
+    }
+
+    STR_CONSTEXPR const_iterator cend() const STR_NOEXCEPT
+    {
+        return ptr_ + size_;
+    }
+
+    STR_CONSTEXPR const_reverse_iterator rbegin() const STR_NOEXCEPT
+    {
+        return const_reverse_iterator(end());
+    }
+
+    STR_CONSTEXPR const_reverse_iterator crbegin() const STR_NOEXCEPT
+    {
+        return const_reverse_iterator(end());
+    }
+
+    STR_CONSTEXPR const_reverse_iterator rend() const STR_NOEXCEPT
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    STR_CONSTEXPR const_reverse_iterator crend() const STR_NOEXCEPT
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    //////////////////////////////////////////////////////////////////////
+    // CAPACITY
+    //////////////////////////////////////////////////////////////////////
+
+    STR_CONSTEXPR size_type size() const STR_NOEXCEPT
+    {
+        return size_;
+    }
+
+    STR_CONSTEXPR size_type max_size() const STR_NOEXCEPT
+    {
+        return npos / sizeof(value_type);
+    }
+
+protected:
+    /// A view has no spare storage, it is never written.
+    STR_CONSTEXPR size_type capacity() const STR_NOEXCEPT
+    {
+        return size_;
+    }
+
+public:
+    //////////////////////////////////////////////////////////////////////
+    // OPERATIONS
+    //////////////////////////////////////////////////////////////////////
+
+    /// Shrinks the view by moving its start forward by count characters.
+    /// @note The behavior is undefined if count > size().
+    STR_CONSTEXPR void remove_prefix(size_type count) STR_NOEXCEPT
+    {
+        ptr_ += count;
+        size_ -= count;
+    }
+
+    /// Shrinks the view by moving its end backward by count characters.
+    /// @note The behavior is undefined if count > size().
+    STR_CONSTEXPR void remove_suffix(size_type count) STR_NOEXCEPT
+    {
+        size_ -= count;
+    }
+
+    /// Returns a view of the substring [index, index+count).
+    STR_CONSTEXPR basic_strview substr(size_type index = 0, size_type count = npos) const
+    {
+        this->assert_range_(index);
+        return { ptr_ + index, std::min(size_ - index, count) };
+    }
+
+    STR_CONSTEXPR void swap(basic_strview &other) STR_NOEXCEPT
+    {
+        std::swap(ptr_, other.ptr_);
+        std::swap(size_, other.size_);
+    }
+
+protected:
+    const_pointer ptr_ = nullptr;
+    size_type size_ = 0;
+};
+
+//////////////////////////////////////////////////////////////////////
+// strtraits
+//////////////////////////////////////////////////////////////////////
+
+template <typename Char, typename CharTraits>
+class strtraits<basic_strview<Char, CharTraits>>
+{
+public:
+    using string_type = basic_strview<Char, CharTraits>;
+    using char_type = typename string_type::value_type;
+    using char_traits = typename string_type::traits_type;
+    using size_type = typename string_type::size_type;
+    using const_pointer = typename string_type::const_pointer;
+
+public:
+    STR_CONSTEXPR static size_type size(const string_type &str) STR_NOEXCEPT
+    {
+        return str.size();
+    }
+
+    STR_CONSTEXPR static const_pointer data(const string_type &str) STR_NOEXCEPT
+    {
+        return str.data();
+    }
+};
+
+//////////////////////////////////////////////////////////////////////
+// OStream Operator
+//////////////////////////////////////////////////////////////////////
+
+template <typename Char, typename CharTraits>
+std::basic_ostream<Char, CharTraits> &
+operator<<(std::basic_ostream<Char, CharTraits> &os, basic_strview<Char, CharTraits> str)
+{
+    return details::ostream_insert(os, str.data(), str.size());
+}
+
+//////////////////////////////////////////////////////////////////////
+// TypeDefs
+//////////////////////////////////////////////////////////////////////
+
+using strview = basic_strview<char>;
+using wstrview = basic_strview<wchar_t>;
+using u8strview = basic_strview<char8_t>;
+using u16strview = basic_strview<char16_t>;
+using u32strview = basic_strview<char32_t>;
+
+STR_NAMESPACE_MAIN_END
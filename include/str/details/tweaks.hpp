@@ -1,4 +1,6 @@
 #pragma once
 
 #define STR_TWEAKS_ALWAYS_NULLTERMINATE
-// #define STR_TWEAKS_DISABLE_DEFAULT_STRTRAITS_IMPL
\ No newline at end of file
+// #define STR_TWEAKS_DISABLE_DEFAULT_STRTRAITS_IMPL
+// #define STR_TWEAKS_DISABLE_SIMD
+// #define STR_TWEAKS_DISABLE_MALLOC_USABLE_SIZE
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <str/stackstr>
 #include <str/heapstr>
+#include <cstring>
 
 using str_t = str::basic_str<char>;
 using stackstr_t = str::basic_stackstr<200, char>;
@@ -8,7 +9,9 @@ using heapstr_t = str::basic_heapstr<char>;
 
 TEST(BaseString, ElementAccess)
 {
-    str_t &str = stackstr_t("hello world");
+    stackstr_t storage("hello world");
+    auto adapter = str::adapt(storage);
+    str_t &str = adapter;
 
     ASSERT_NO_THROW(str[50]);                    // does not perform bound checking
     ASSERT_THROW(str.at(50), std::out_of_range); // performs bound checking
@@ -23,7 +26,9 @@ TEST(BaseString, ElementAccess)
 
 TEST(BaseString, Iterators)
 {
-    str_t &str = stackstr_t("hello world");
+    stackstr_t storage("hello world");
+    auto adapter = str::adapt(storage);
+    str_t &str = adapter;
 
     ASSERT_EQ(*str.begin(), 'h');     // iterator to the first element
     ASSERT_EQ(*(str.end() - 1), 'd'); // iterator to the last element
@@ -38,10 +43,14 @@ TEST(BaseString, Iterators)
 
 TEST(BaseString, Capacity)
 {
-    str_t &str1 = heapstr_t();
+    heapstr_t storage1;
+    auto adapter1 = str::adapt(storage1);
+    str_t &str1 = adapter1;
     ASSERT_EQ(str1.empty(), true);
 
-    str_t &str = heapstr_t("hello world");
+    heapstr_t storage("hello world");
+    auto adapter = str::adapt(storage);
+    str_t &str = adapter;
     ASSERT_EQ(str.size(), 11);
     ASSERT_EQ(str.length(), 11);
     ASSERT_EQ(str.capacity(), 11);
@@ -53,10 +62,51 @@ TEST(BaseString, Capacity)
     ASSERT_EQ(str.capacity(), str.size());
 }
 
+TEST(BaseString, Operations_Overwrite)
+{
+    // a producer writes in place, the string keeps what it reports
+    heapstr_t storage("id=");
+    storage.resize_and_overwrite(64, [](char *ptr, size_t)
+                                 {
+                                     std::memcpy(ptr + 3, "12345", 5);
+                                     return 8; });
+    ASSERT_EQ(storage.compare("id=12345"), 0);
+    ASSERT_EQ(storage.c_str()[8], '\0');
+    ASSERT_GE(storage.capacity(), 64);
+    ASSERT_THROW(storage.resize_and_overwrite(4, [](char *, size_t count)
+                                              { return count + 1; }),
+                 std::out_of_range);
+
+    auto adapter = str::adapt(storage);
+    str_t &str = adapter;
+
+    auto span = str.append_uninitialized(16);
+    ASSERT_EQ(span.size(), 16);
+    std::memcpy(span.data(), ";name=x", 7);
+    ASSERT_EQ(str.size(), 8);
+    span.commit(7);
+    ASSERT_EQ(str.compare("id=12345;name=x"), 0);
+    ASSERT_EQ(str.c_str()[str.size()], '\0');
+    ASSERT_THROW(str.append_uninitialized(1).commit(2), std::out_of_range);
+
+    // fixed buffers cannot grow
+    stackstr_t stack("abc");
+    ASSERT_THROW(stack.resize_and_overwrite(201, [](char *, size_t count)
+                                            { return count; }),
+                 std::length_error);
+    stack.resize_and_overwrite(200, [](char *, size_t)
+                               { return 2; });
+    ASSERT_EQ(stack.compare("ab"), 0);
+}
+
 TEST(BaseString, Operations_Insert)
 {
-    str_t &srcstr = stackstr_t("the source string");
-    str_t &str = stackstr_t("12345");
+    stackstr_t srcstorage("the source string");
+    stackstr_t storage("12345");
+    auto srcadapter = str::adapt(srcstorage);
+    auto adapter = str::adapt(storage);
+    str_t &srcstr = srcadapter;
+    str_t &str = adapter;
 
     // using index
     str.insert(4, 'c');
@@ -75,4 +125,180 @@ TEST(BaseString, Operations_Insert)
     str.insert(str.begin() + 4, srcstr.begin(), srcstr.end());
     str.insert(str.begin() + 4, {'t', 'e', 's', 't', ' ', 'i', 'n', 'i', 't', '-', 'l', 'i', 's', 't', ' ', 'i', 'n', 's', 'e', 'r', 't'});
     str.insert(str.begin() + 4, srcstr);
-}
\ No newline at end of file
+}
+
+TEST(BaseString, Adapter)
+{
+    // concrete strings are dispatched statically
+    ASSERT_FALSE(std::is_polymorphic_v<heapstr_t>);
+    ASSERT_FALSE(std::is_polymorphic_v<stackstr_t>);
+
+    // the adapter refers to the string
+    heapstr_t storage("hello");
+    auto adapter = str::adapt(storage);
+    str_t &str = adapter;
+
+    str.append(" world");
+    ASSERT_EQ(storage.size(), 11);
+    ASSERT_EQ(storage.compare("hello world"), 0);
+    ASSERT_EQ(&adapter.get(), &storage);
+
+    // growth policy of the string is used through the adapter
+    str.reserve(12);
+    ASSERT_EQ(str.capacity(), storage.capacity());
+    ASSERT_GE(storage.capacity(), 22);
+}
+
+TEST(BaseString, Search_Find)
+{
+    heapstr_t str("the quick brown fox jumps over the lazy dog");
+
+    ASSERT_EQ(str.find('q'), 4);
+    ASSERT_EQ(str.find('z'), 37);
+    ASSERT_EQ(str.find('!'), str_t::npos);
+
+    ASSERT_EQ(str.find("the"), 0);
+    ASSERT_EQ(str.find("the", 1), 31);
+    ASSERT_EQ(str.find("lazy dog"), 35);
+    ASSERT_EQ(str.find("lazy cat"), str_t::npos);
+    ASSERT_EQ(str.find("dog", 0, 2), 40);
+    ASSERT_EQ(str.find(""), 0);
+
+    // long needles over a long haystack use a different algorithm
+    heapstr_t hay('a', 4096);
+    hay.append("the quick brown fox jumps over the lazy dog");
+    ASSERT_EQ(hay.find(str), 4096);
+    ASSERT_EQ(hay.find("the quick brown fox jumps over the lazy cat"), str_t::npos);
+}
+
+TEST(BaseString, Search_Contains)
+{
+    heapstr_t str("hello world");
+
+    ASSERT_TRUE(str.contains('w'));
+    ASSERT_TRUE(str.contains("lo wo"));
+    ASSERT_FALSE(str.contains("low"));
+
+    ASSERT_TRUE(str.starts_with('h'));
+    ASSERT_TRUE(str.starts_with("hello"));
+    ASSERT_FALSE(str.starts_with("hello world!"));
+
+    ASSERT_TRUE(str.ends_with('d'));
+    ASSERT_TRUE(str.ends_with("world"));
+    ASSERT_FALSE(str.ends_with("worlds"));
+}
+
+TEST(BaseString, Search_RFind)
+{
+    heapstr_t str("/var/log/service/part-00042.log.log");
+
+    ASSERT_EQ(str.rfind('/'), 16);
+    ASSERT_EQ(str.rfind('/', 15), 8);
+    ASSERT_EQ(str.rfind('#'), str_t::npos);
+
+    ASSERT_EQ(str.rfind(".log"), 31);
+    ASSERT_EQ(str.rfind(".log", 30), 27);
+    ASSERT_EQ(str.rfind("/var"), 0);
+    ASSERT_EQ(str.rfind("/usr"), str_t::npos);
+
+    ASSERT_EQ(str.find_last_of('g'), 34);
+    ASSERT_EQ(str.find_last_of("/."), 31);
+    ASSERT_EQ(str.find_last_not_of('g'), 33);
+    ASSERT_EQ(str.find_last_not_of(".log"), 26);
+}
+
+template <typename Char>
+static void check_wide_rfind()
+{
+    using string_t = str::basic_heapstr<Char>;
+    constexpr auto npos = string_t::npos;
+
+    // 103 characters: the vector loops end with a scalar tail of at least
+    // [0, 3), characters differing from 'x' only in their upper bytes must not match
+    const Char decoy = static_cast<Char>(Char('x') | (Char(1) << (8 * sizeof(Char) - 8)));
+    string_t str(Char('a'), 103);
+    str[1] = Char('x');
+    str[2] = Char('b');
+    str[60] = Char('x');
+    str[61] = Char('b');
+    str[90] = decoy;
+
+    ASSERT_EQ(str.rfind(Char('x')), 60);
+    ASSERT_EQ(str.rfind(Char('x'), 59), 1);
+    ASSERT_EQ(str.rfind(Char('x'), 0), npos);
+    ASSERT_EQ(str.rfind(decoy), 90);
+
+    const Char xb[] = {Char('x'), Char('b'), Char()};
+    const Char xa[] = {Char('x'), Char('a'), Char()};
+    const Char decoy_a[] = {decoy, Char('a'), Char()};
+    ASSERT_EQ(str.rfind(static_cast<const Char *>(xb)), 60);
+    ASSERT_EQ(str.rfind(static_cast<const Char *>(xb), 59), 1);
+    ASSERT_EQ(str.rfind(static_cast<const Char *>(xa)), npos);
+    ASSERT_EQ(str.rfind(static_cast<const Char *>(decoy_a)), 90);
+
+    ASSERT_EQ(str.find_last_of(Char('x')), 60);
+    ASSERT_EQ(str.find_last_of(Char('b'), 59), 2);
+    ASSERT_EQ(str.find_last_of(static_cast<const Char *>(xb)), 61);
+    ASSERT_EQ(str.find_last_not_of(Char('a')), 90);
+    ASSERT_EQ(str.find_last_not_of(Char('a'), 59), 2);
+}
+
+TEST(BaseString, Search_RFind_Wide)
+{
+    check_wide_rfind<char16_t>();
+    check_wide_rfind<char32_t>();
+}
+
+TEST(BaseString, Search_Charset)
+{
+    heapstr_t str("key = value; other\t= 42");
+    str::charset delims(" \t=;");
+
+    ASSERT_EQ(str.find_first_of(delims), 3);
+    ASSERT_EQ(str.find_first_of(delims, 4), 4);
+    ASSERT_EQ(str.find_first_not_of(delims, 3), 6);
+    ASSERT_EQ(str.find_last_of(delims), 20);
+    ASSERT_EQ(str.find_last_not_of(delims, 20), 17);
+
+    // the pointer overloads give the same results
+    ASSERT_EQ(str.find_first_of(" \t=;"), 3);
+    ASSERT_EQ(str.find_first_not_of(" \t=;", 3), 6);
+    ASSERT_EQ(str.find_last_of(" \t=;"), 20);
+    ASSERT_EQ(str.find_last_not_of(" \t=;", 20), 17);
+
+    // 100 characters: matches in the 32 byte blocks and in the scalar tail,
+    // bytes sharing a nibble with a member must not match
+    heapstr_t hay('a', 100);
+    hay[1] = '\x80';
+    hay[20] = 'i';
+    hay[40] = '\xE9';
+    hay[60] = '\xD9';
+    hay[97] = ';';
+    str::charset high("\x80\xE9;");
+    str::charset letter("a");
+
+    ASSERT_EQ(hay.find_first_of(high), 1);
+    ASSERT_EQ(hay.find_first_of(high, 2), 40);
+    ASSERT_EQ(hay.find_first_of(high, 41), 97);
+    ASSERT_EQ(hay.find_last_of(high), 97);
+    ASSERT_EQ(hay.find_last_of(high, 96), 40);
+    ASSERT_EQ(hay.find_last_of(high, 39), 1);
+    ASSERT_EQ(hay.find_first_not_of(letter, 2), 20);
+    ASSERT_EQ(hay.find_first_not_of(letter, 61), 97);
+    ASSERT_EQ(hay.find_last_not_of(letter, 96), 60);
+    ASSERT_EQ(hay.find_last_not_of(letter, 19), 1);
+
+    // code units above 255 are kept apart from the byte tables
+    str::u16heapstr wide(u'a', 100);
+    wide[10] = u'\u01E9';
+    wide[30] = u'\u00E9';
+    wide[50] = u'\u20AD';
+    wide[70] = u'\u20AC';
+    str::u16charset currency(u"\u00E9\u20AC");
+
+    ASSERT_EQ(wide.find_first_of(currency), 30);
+    ASSERT_EQ(wide.find_first_of(currency, 31), 70);
+    ASSERT_EQ(wide.find_last_of(currency), 70);
+    ASSERT_EQ(wide.find_last_of(currency, 69), 30);
+    ASSERT_EQ(wide.find_first_not_of(str::u16charset(u"a")), 10);
+}
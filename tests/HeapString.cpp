@@ -1,5 +1,55 @@
 #include <gtest/gtest.h>
+#include <str/arena>
 #include <str/heapstr>
+#include <str/pool>
+#include <str/realloc>
+#include <str/smallstr>
+#include <str/stackstr>
+#include <str/stredit>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <map>
+#include <vector>
+
+namespace
+{
+    /// std::allocator checking that blocks are freed with the count they were allocated with.
+    template <typename T>
+    struct sized_allocator : std::allocator<T>
+    {
+        template <typename U>
+        struct rebind
+        {
+            using other = sized_allocator<U>;
+        };
+
+        static std::map<T *, std::size_t> &blocks()
+        {
+            static std::map<T *, std::size_t> blocks;
+            return blocks;
+        }
+
+        sized_allocator() = default;
+
+        template <typename U>
+        sized_allocator(const sized_allocator<U> &) {}
+
+        T *allocate(std::size_t count)
+        {
+            auto ptr = std::allocator<T>::allocate(count);
+            blocks()[ptr] = count;
+            return ptr;
+        }
+
+        void deallocate(T *ptr, std::size_t count)
+        {
+            EXPECT_EQ(blocks()[ptr], count);
+            blocks().erase(ptr);
+            std::allocator<T>::deallocate(ptr, count);
+        }
+    };
+}
 
 TEST(HeapString, Constructor)
 {
@@ -13,4 +63,389 @@ TEST(HeapString, Constructor)
     heapstr_t str6({ 'h', 'e', 'l', 'l', 'o' });
     heapstr_t str7(str4);
     heapstr_t str8(str4.base());
-}
\ No newline at end of file
+}
+
+TEST(HeapString, Growth)
+{
+    using heapstr_t = str::heapstr;
+
+    // appends grow geometrically
+    heapstr_t str;
+    size_t reallocations = 0;
+    for (size_t i = 0; i < 1000; i++)
+    {
+        auto capacity = str.capacity();
+        str.push_back('x');
+
+        if (str.capacity() != capacity)
+            reallocations++;
+    }
+
+    ASSERT_EQ(str.size(), 1000);
+    ASSERT_LE(reallocations, 11);
+
+    // reserve_exact bypasses the growth policy
+    heapstr_t exact;
+    exact.reserve_exact(100);
+    ASSERT_EQ(exact.capacity(), 100);
+    exact.reserve_exact(101);
+    ASSERT_EQ(exact.capacity(), 101);
+
+    // the whole size class of the allocator is used before reallocating
+    using poolstr_t = str::basic_heapstr<char, std::char_traits<char>, str::pool_allocator<char>>;
+    poolstr_t pooled;
+    pooled.reserve_exact(20);
+    ASSERT_EQ(pooled.capacity(), 31);
+
+    auto ptr = pooled.data();
+    pooled.append('x', 31);
+    ASSERT_EQ(pooled.data(), ptr);
+    ASSERT_EQ(pooled.size(), 31);
+    pooled.push_back('y');
+    ASSERT_EQ(pooled.capacity(), 63);
+}
+
+TEST(HeapString, Edit)
+{
+    using heapstr_t = str::heapstr;
+
+    heapstr_t str("hello world");
+    str.insert(5, ",");
+    str.erase(0, 1);
+    str.replace(0, 3, "J");
+    ASSERT_EQ(str.compare("Jo, world"), 0);
+
+    str.replace(str.begin(), str.begin() + 2, 'x', 3);
+    ASSERT_EQ(str.compare("xxx, world"), 0);
+    str.replace(3, 2, { '-' });
+    ASSERT_EQ(str.compare("xxx-world"), 0);
+    ASSERT_THROW(str.replace(10, 1, "y"), std::out_of_range);
+
+    // the inserted range may point into the string itself
+    heapstr_t self("abcdef");
+    self.insert(2, self.c_str(), 6);
+    ASSERT_EQ(self.compare("ababcdefcdef"), 0);
+
+    self.assign("abcdef");
+    self.insert(1, self.c_str() + 3, 3);
+    ASSERT_EQ(self.compare("adefbcdef"), 0);
+
+    self.assign("abcdef");
+    self.insert(3, self.c_str() + 1, 4);
+    ASSERT_EQ(self.compare("abcbcdedef"), 0);
+
+    self.assign("abcdef");
+    self.append(self);
+    self.insert(self.begin(), self.begin() + 4, self.end());
+    ASSERT_EQ(self.compare("efabcdefabcdefabcdef"), 0);
+
+    // and so may the replacement, shrinking or growing the range
+    self.assign("abcdef");
+    self.replace(0, 4, self.c_str() + 2, 3);
+    ASSERT_EQ(self.compare("cdeef"), 0);
+
+    self.assign("abcdef");
+    self.replace(1, 2, self.c_str() + 2, 4);
+    ASSERT_EQ(self.compare("acdefdef"), 0);
+
+    self.assign("abcdef");
+    self.replace(4, 1, self.c_str(), 6);
+    ASSERT_EQ(self.compare("abcdabcdeff"), 0);
+
+    self.assign("abcdef");
+    self.assign(self.c_str() + 2, 3);
+    ASSERT_EQ(self.compare("cde"), 0);
+    ASSERT_EQ(self.c_str()[3], '\0');
+}
+
+TEST(HeapString, EditBatch)
+{
+    using heapstr_t = str::heapstr;
+
+    // offsets refer to the string before the edits
+    heapstr_t str("GET /index HTTP/1.0");
+    str::stredit edits;
+    edits.insert(19, "\r\n")
+         .replace(16, 3, "1.1")
+         .insert(0, '>', 2)
+         .erase(4, 1)
+         .insert(5, "api/")
+         .insert(5, heapstr_t("v2/"));
+
+    ASSERT_EQ(edits.size(), 6);
+    str.apply(edits);
+    ASSERT_EQ(str.compare(">>GET api/v2/index HTTP/1.1\r\n"), 0);
+    ASSERT_EQ(str.c_str()[str.size()], '\0');
+
+    // shrinking and growing ranges in the same batch
+    heapstr_t mixed("aaaabbbbccccdddd");
+    str::stredit shifts;
+    shifts.erase(0, 3).insert(8, "XXXXXXXX").erase(12, 4).insert(4, "YY");
+    mixed.apply(shifts);
+    ASSERT_EQ(mixed.compare("aYYbbbbXXXXXXXXcccc"), 0);
+
+    // other string types take the same batch
+    str::stackstr<32> stack("aaaabbbbccccdddd");
+    stack.apply(shifts);
+    ASSERT_EQ(stack.compare("aYYbbbbXXXXXXXXcccc"), 0);
+
+    // overlapping edits are rejected before the string is touched
+    str::stredit overlap;
+    overlap.erase(2, 4).insert(3, "x");
+    ASSERT_THROW(mixed.apply(overlap), std::out_of_range);
+    ASSERT_EQ(mixed.compare("aYYbbbbXXXXXXXXcccc"), 0);
+}
+
+TEST(HeapString, Concat)
+{
+    using heapstr_t = str::heapstr;
+    using stackstr_t = str::stackstr<64>;
+
+    heapstr_t scheme("https");
+    heapstr_t host("example.com");
+    str::strview path("/index");
+
+    // the chain is written into one allocation of the final size
+    heapstr_t url = scheme + "://" + host + ':' + stackstr_t("8080") + path;
+    ASSERT_EQ(url.compare("https://example.com:8080/index"), 0);
+    ASSERT_EQ(url.capacity(), url.size());
+    ASSERT_EQ(url.c_str()[url.size()], '\0');
+
+    const char *query = "?q=1";
+    ASSERT_EQ(heapstr_t(url + query).compare("https://example.com:8080/index?q=1"), 0);
+    ASSERT_EQ(heapstr_t('<' + host + '>').compare("<example.com>"), 0);
+    ASSERT_EQ(heapstr_t((scheme + "://") + (host + path)).compare("https://example.com/index"), 0);
+    ASSERT_EQ(heapstr_t(scheme + host, 3, 6).compare("psexam"), 0);
+
+    // other string types take the expression as well
+    stackstr_t stack = host + '.' + scheme;
+    ASSERT_EQ(stack.compare("example.com.https"), 0);
+    stack += "/" + host;
+    ASSERT_EQ(stack.compare("example.com.https/example.com"), 0);
+
+    // the parts may view the string assigned or appended to
+    heapstr_t self("ab");
+    self = self + "-" + self;
+    ASSERT_EQ(self.compare("ab-ab"), 0);
+    self += '[' + self + ']';
+    ASSERT_EQ(self.compare("ab-ab[ab-ab]"), 0);
+    self = "<" + self + ">";
+    ASSERT_EQ(self.compare("<ab-ab[ab-ab]>"), 0);
+
+    // temporaries are appended to in place
+    heapstr_t moved = heapstr_t("a") + host + "b" + 'c';
+    ASSERT_EQ(moved.compare("aexample.combc"), 0);
+    ASSERT_EQ(heapstr_t('x' + heapstr_t("y")).compare("xy"), 0);
+    ASSERT_EQ(heapstr_t(heapstr_t("x") + heapstr_t("y")).compare("xy"), 0);
+}
+
+TEST(HeapString, Allocator)
+{
+    using arenastr_t = str::basic_heapstr<char, std::char_traits<char>, str::arena_allocator<char>>;
+
+    // strings of a request are bump allocated and freed together
+    str::arena request;
+    arenastr_t a("hello", request);
+    arenastr_t b(a);
+    b += " world";
+    ASSERT_EQ(b.get_allocator(), a.get_allocator());
+    ASSERT_EQ(b.compare("hello world"), 0);
+    ASSERT_EQ(a.compare("hello"), 0);
+
+    // the allocator stays with the string, another arena copies the characters
+    str::arena other;
+    arenastr_t c("x", other);
+    c = a;
+    ASSERT_EQ(c.get_allocator().resource(), &other);
+    c = std::move(b);
+    ASSERT_EQ(c.get_allocator().resource(), &other);
+    ASSERT_EQ(c.compare("hello world"), 0);
+
+    // moves within an arena hand the buffer over
+    auto ptr = a.data();
+    arenastr_t d(std::move(a));
+    ASSERT_EQ(d.data(), ptr);
+    ASSERT_TRUE(a.empty());
+
+    auto chunks = request.chunks_size();
+    request.reset();
+    ASSERT_EQ(request.chunks_size(), chunks);
+
+    // std::pmr resources, the arena among them
+    str::pmr::heapstr p1("pmr", &request);
+    str::pmr::heapstr p2(p1);
+    ASSERT_EQ(p1.get_allocator().resource(), &request);
+    ASSERT_EQ(p2.get_allocator().resource(), std::pmr::get_default_resource());
+    str::pmr::heapstr p3("swapped", &request);
+    p3.swap(p1);
+    ASSERT_EQ(p1.compare("swapped"), 0);
+    ASSERT_EQ(p3.compare("pmr"), 0);
+
+    // copies and moves of default strings own their buffers
+    str::heapstr e("abcdefghijklmnopqrstuvwxyz");
+    str::heapstr f(e);
+    ASSERT_NE(f.data(), e.data());
+    f = e;
+    f = std::move(e);
+    ASSERT_TRUE(e.empty());
+    ASSERT_EQ(f.compare("abcdefghijklmnopqrstuvwxyz"), 0);
+    str::adapt(f).append("!");
+    ASSERT_EQ(str::adapt(f).get_allocator(), f.get_allocator());
+
+    // blocks without a reported usable size are freed with the requested count
+    {
+        using sizedstr_t = str::basic_heapstr<char, std::char_traits<char>, sized_allocator<char>>;
+        sizedstr_t g("hello");
+        ASSERT_EQ(g.capacity(), 5);
+        g.append(" world, a longer string");
+        g.shrink_to_fit();
+        g.reserve_exact(100);
+    }
+
+    ASSERT_TRUE(sized_allocator<char>::blocks().empty());
+
+    str::heapstr h("hello");
+    ASSERT_EQ(h.capacity(), 5);
+}
+
+TEST(HeapString, Pool)
+{
+    using poolstr_t = str::basic_heapstr<char, std::char_traits<char>, str::pool_allocator<char>>;
+
+    // freed buffers of a size class are reused by the thread
+    poolstr_t a("hello world");
+    auto ptr = a.data();
+    a = poolstr_t();
+    poolstr_t b("hello pool");
+    ASSERT_EQ(b.data(), ptr);
+
+    // buffers over 4 KB fall through to operator new
+    poolstr_t large('x', 5000);
+    large.append(large);
+    ASSERT_EQ(large.size(), 10000);
+
+    // a thread which only frees does not create a cache of its own
+    poolstr_t kept("freed by a thread which never allocates");
+    auto orphans = str::details::pool_orphanage().head;
+    std::thread releaser([&kept]
+                         { kept = poolstr_t(); });
+    releaser.join();
+    ASSERT_EQ(str::details::pool_orphanage().head, orphans);
+
+    // strings freed by another thread go back to the thread which allocated them
+    std::vector<poolstr_t> strings;
+    for (int i = 0; i < 1000; i++)
+    {
+        strings.emplace_back("string number ");
+        strings.back().append_int(i);
+    }
+
+    std::thread consumer([&strings]
+                         {
+                             for (auto &str : strings)
+                             {
+                                 str.append(" consumed");
+                             }
+                             strings.clear(); });
+    consumer.join();
+
+    for (int i = 0; i < 1000; i++)
+    {
+        strings.emplace_back("again ");
+        strings.back().append_int(i);
+        ASSERT_EQ(strings.back().compare(0, 6, "again "), 0);
+    }
+
+    // threads exchanging strings while allocating their own
+    std::vector<std::thread> threads;
+    std::vector<std::vector<poolstr_t>> outputs(4);
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&outputs, t]
+                             {
+                                 for (int i = 0; i < 2000; i++)
+                                 {
+                                     poolstr_t str('a', static_cast<size_t>(i % 300));
+                                     outputs[t].push_back(std::move(str));
+                                 } });
+    }
+
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (auto &output : outputs)
+    {
+        ASSERT_EQ(output.size(), 2000);
+        ASSERT_EQ(output[299].size(), 299);
+        output.clear();
+    }
+}
+
+TEST(HeapString, Reallocate)
+{
+    // pages from 64 KB on, to cross the threshold in both directions
+    using reallocstr_t = str::basic_heapstr<char, std::char_traits<char>, str::realloc_allocator<char, 64 * 1024>>;
+
+    reallocstr_t str("0123456789");
+    for (int i = 0; i < 16; i++)
+    {
+        str.append(str);
+    }
+
+    ASSERT_EQ(str.size(), 10 << 16);
+    ASSERT_GE(str.capacity(), str.size());
+    ASSERT_EQ(str.compare(0, 10, "0123456789"), 0);
+    ASSERT_EQ(str.compare(str.size() - 10, 10, "0123456789"), 0);
+    ASSERT_EQ(str.c_str()[str.size()], '\0');
+
+    // shrinking goes back to malloc, keeping the characters
+    str.erase(100, reallocstr_t::npos);
+    str.shrink_to_fit();
+    ASSERT_LT(str.capacity(), 1000);
+    ASSERT_EQ(str.compare(90, 10, "0123456789"), 0);
+
+    reallocstr_t copy(str);
+    copy.reserve(1 << 20);
+    ASSERT_EQ(copy.compare(str), 0);
+}
+
+TEST(HeapString, Relocate)
+{
+    using heapstr_t = str::heapstr;
+
+    ASSERT_TRUE(std::is_nothrow_move_constructible_v<heapstr_t>);
+    ASSERT_TRUE(std::is_nothrow_move_assignable_v<heapstr_t>);
+    ASSERT_TRUE(std::is_nothrow_move_constructible_v<str::stackstr<16>>);
+    ASSERT_TRUE(std::is_nothrow_move_constructible_v<str::smallstr>);
+
+    ASSERT_TRUE(str::is_trivially_relocatable_v<heapstr_t>);
+    ASSERT_TRUE(str::is_trivially_relocatable_v<str::pmr::heapstr>);
+    ASSERT_TRUE(str::is_trivially_relocatable_v<str::stackstr<16>>);
+    ASSERT_TRUE(str::is_trivially_relocatable_v<str::smallstr>);
+
+    // a container reallocating its elements copies their bytes
+    std::allocator<heapstr_t> alloc;
+    auto first = alloc.allocate(3);
+    ::new (first) heapstr_t("first string on the heap");
+    ::new (first + 1) heapstr_t();
+    ::new (first + 2) heapstr_t("third");
+    auto ptr = first->data();
+
+    auto dest = alloc.allocate(3);
+    ASSERT_EQ(str::relocate(first, first + 3, dest), dest + 3);
+    alloc.deallocate(first, 3);
+
+    ASSERT_EQ(dest[0].data(), ptr);
+    ASSERT_EQ(dest[0].compare("first string on the heap"), 0);
+    ASSERT_TRUE(dest[1].empty());
+    ASSERT_EQ(dest[2].compare("third"), 0);
+
+    for (int i = 0; i < 3; i++)
+    {
+        dest[i].~heapstr_t();
+    }
+
+    alloc.deallocate(dest, 3);
+}
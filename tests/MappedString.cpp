@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include <str/heapstr>
+#include <str/mmapstr>
+#include <str/strview>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#ifdef STR_HAS_MMAP
+
+TEST(MappedString, Constructor)
+{
+    using mmapstr_t = str::mmapstr;
+
+    std::string content;
+    for (int i = 0; i < 10000; i++)
+    {
+        content += "entry " + std::to_string(i) + ";";
+    }
+
+    auto path = std::string(::testing::TempDir()) + "str_mmapstr.txt";
+    std::ofstream(path, std::ios::binary) << content;
+
+    mmapstr_t empty;
+    ASSERT_TRUE(empty.empty());
+
+    mmapstr_t str(path.c_str(), str::mmap_access::sequential);
+    ASSERT_EQ(str.size(), content.size());
+    ASSERT_EQ(str.compare(content.c_str()), 0);
+    ASSERT_EQ(str.front(), 'e');
+    ASSERT_EQ(str.back(), ';');
+
+    // the mapping moves, views into it stay valid
+    auto data = str.data();
+    mmapstr_t moved(std::move(str));
+    ASSERT_TRUE(str.empty());
+    ASSERT_EQ(moved.data(), data);
+
+    empty = std::move(moved);
+    ASSERT_EQ(empty.data(), data);
+
+    auto path_empty = std::string(::testing::TempDir()) + "str_mmapstr_empty.txt";
+    std::ofstream(path_empty, std::ios::binary).flush();
+    ASSERT_TRUE(mmapstr_t(path_empty.c_str()).empty());
+
+    ASSERT_THROW(mmapstr_t((path + ".missing").c_str()), std::system_error);
+
+    std::remove(path.c_str());
+    std::remove(path_empty.c_str());
+}
+
+TEST(MappedString, Search)
+{
+    std::string content(100000, '.');
+    content.replace(70000, 6, "needle");
+    content.replace(90000, 6, "needle");
+
+    auto path = std::string(::testing::TempDir()) + "str_mmapstr_search.txt";
+    std::ofstream(path, std::ios::binary) << content;
+
+    str::mmapstr str(path.c_str(), str::mmap_access::random);
+    str.prefetch(60000, 20000);
+    str.advise(str::mmap_access::normal);
+
+    ASSERT_EQ(str.find("needle"), 70000);
+    ASSERT_EQ(str.rfind("needle"), 90000);
+    ASSERT_EQ(str.find('n', 80000), 90000);
+    ASSERT_EQ(str.find_first_not_of('.'), 70000);
+    ASSERT_TRUE(str.contains(str::strview("needle")));
+    ASSERT_TRUE(str.starts_with("..."));
+
+    // substrings are views into the mapping
+    auto sub = str.substr(70000, 6);
+    ASSERT_EQ(sub.data(), str.data() + 70000);
+    ASSERT_EQ(sub.compare("needle"), 0);
+
+    str::strview view(str);
+    ASSERT_EQ(view.data(), str.data());
+    ASSERT_EQ(str.view().size(), str.size());
+
+    // other strings take it like any string
+    str::heapstr copy(str.substr(69998, 10));
+    ASSERT_EQ(copy.compare("..needle.."), 0);
+    ASSERT_EQ(copy.find(str.substr(70000, 6)), 2);
+
+    std::remove(path.c_str());
+}
+
+#endif
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <str/sharedstr>
+#include <thread>
+#include <utility>
+#include <vector>
+
+TEST(SharedString, Constructor)
+{
+    using sharedstr_t = str::sharedstr;
+
+    sharedstr_t str1;
+    sharedstr_t str2('b', 25);
+    sharedstr_t str3("hello world\0 hi world");
+    sharedstr_t str4("hello world\0 hi world", 22);
+    sharedstr_t str5(str4.begin(), str4.end());
+    sharedstr_t str6({ 'h', 'e', 'l', 'l', 'o' });
+    sharedstr_t str7(str4);
+    sharedstr_t str8(str4.base());
+    sharedstr_t str9(std::move(str2));
+
+    ASSERT_EQ(str1.use_count(), 0);
+    ASSERT_EQ(str3.size(), 11);
+    ASSERT_EQ(str4.size(), 22);
+    ASSERT_EQ(str7.compare(str4), 0);
+    ASSERT_EQ(str9.size(), 25);
+    ASSERT_TRUE(str2.empty());
+}
+
+TEST(SharedString, Layout)
+{
+    ASSERT_EQ(sizeof(str::sharedstr), 3 * sizeof(void *));
+}
+
+TEST(SharedString, Sharing)
+{
+    using sharedstr_t = str::sharedstr;
+
+    sharedstr_t str("hello world");
+    sharedstr_t copy(str);
+    ASSERT_EQ(copy.use_count(), 2);
+    ASSERT_TRUE(str.is_shared());
+    ASSERT_EQ(std::as_const(copy).data(), std::as_const(str).data());
+
+    // substrings point into the same buffer
+    sharedstr_t slice = str.substr(6, 5);
+    ASSERT_EQ(slice.use_count(), 3);
+    ASSERT_EQ(std::as_const(slice).data(), std::as_const(str).data() + 6);
+    ASSERT_EQ(slice.compare("world"), 0);
+
+    // writing copies the buffer, the other strings keep the old content
+    copy[0] = 'j';
+    ASSERT_FALSE(copy.is_shared());
+    ASSERT_EQ(copy.compare("jello world"), 0);
+    ASSERT_EQ(str.compare("hello world"), 0);
+    ASSERT_EQ(str.use_count(), 2);
+
+    slice.append("s!");
+    ASSERT_EQ(slice.compare("worlds!"), 0);
+    ASSERT_EQ(slice.c_str()[slice.size()], '\0');
+    ASSERT_EQ(str.compare("hello world"), 0);
+    ASSERT_FALSE(str.is_shared());
+
+    // a unique buffer is written in place
+    auto ptr = std::as_const(str).data();
+    str[0] = 'y';
+    ASSERT_EQ(str.data(), ptr);
+
+    // a reference handed out may still be written, copies do not share the buffer
+    char &ref = str[1];
+    sharedstr_t unshared(str);
+    ref = 'a';
+    ASSERT_EQ(unshared.compare("yello world"), 0);
+    ASSERT_EQ(str.compare("yallo world"), 0);
+    ASSERT_EQ(str.use_count(), 1);
+    ASSERT_EQ(str.substr(1, 4).use_count(), 1);
+
+    // changing the size invalidates the references, the buffer is shared again
+    str.pop_back();
+    str.push_back('d');
+
+    // assignments share, clear drops the reference
+    copy = str;
+    ASSERT_EQ(str.use_count(), 2);
+    copy.clear();
+    ASSERT_TRUE(copy.empty());
+    ASSERT_EQ(str.use_count(), 1);
+
+    ASSERT_THROW(str.substr(20), std::out_of_range);
+
+    // a slice ending before the buffer is copied to be terminated
+    sharedstr_t number("12345 hello");
+    const auto digits = number.substr(0, 2);
+    ASSERT_NE(digits.data(), std::as_const(number).data());
+    ASSERT_EQ(std::strlen(digits.c_str()), 2);
+    ASSERT_EQ(str::stoi(number.substr(0, 2)), 12);
+    ASSERT_EQ(number.use_count(), 1);
+
+    // a slice ending with the buffer shares it, c_str() does not write
+    const auto tail = number.substr(6);
+    ASSERT_EQ(number.use_count(), 2);
+    ASSERT_EQ(tail.c_str(), std::as_const(number).data() + 6);
+    ASSERT_EQ(std::strlen(tail.c_str()), 5);
+
+    // no buffer is allocated for empty strings
+    sharedstr_t empty;
+    ASSERT_NE(empty.data(), nullptr);
+    ASSERT_EQ(empty.use_count(), 0);
+}
+
+TEST(SharedString, Threads)
+{
+    using sharedstr_t = str::sharedstr;
+
+    const sharedstr_t str('x', 1000);
+    const sharedstr_t head = str.substr(0, 500);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++)
+    {
+        threads.emplace_back([&str, &head]()
+        {
+            for (int j = 0; j < 1000; j++)
+            {
+                sharedstr_t copy(str);
+                copy.push_back('y');
+                ASSERT_EQ(copy.size(), 1001);
+
+                // c_str() on a const slice does not write to it
+                ASSERT_EQ(std::strlen(head.c_str()), 500);
+            }
+        });
+    }
+
+    for (auto &thread : threads)
+        thread.join();
+
+    ASSERT_EQ(str.use_count(), 1);
+}
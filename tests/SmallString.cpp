@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <str/smallstr>
+
+TEST(SmallString, Constructor)
+{
+    using smallstr_t = str::smallstr;
+
+    smallstr_t str1;
+    smallstr_t str2('b', 25);
+    smallstr_t str3("hello world\0 hi world");
+    smallstr_t str4("hello world\0 hi world", 22);
+    smallstr_t str5(str4.begin(), str4.end());
+    smallstr_t str6({ 'h', 'e', 'l', 'l', 'o' });
+    smallstr_t str7(str4);
+    smallstr_t str8(str4.base());
+    smallstr_t str9(std::move(str2));
+
+    ASSERT_EQ(str3.size(), 11);
+    ASSERT_EQ(str4.size(), 22);
+    ASSERT_EQ(str7.compare(str4), 0);
+    ASSERT_EQ(str9.size(), 25);
+    ASSERT_TRUE(str2.empty());
+}
+
+TEST(SmallString, Layout)
+{
+    ASSERT_EQ(sizeof(str::smallstr), 3 * sizeof(void *));
+    ASSERT_EQ(sizeof(str::u16smallstr), 3 * sizeof(void *));
+    ASSERT_EQ(sizeof(str::u32smallstr), 3 * sizeof(void *));
+    ASSERT_EQ(str::smallstr::small_capacity, 3 * sizeof(void *) - 1);
+}
+
+TEST(SmallString, Storage)
+{
+    using smallstr_t = str::smallstr;
+
+    // a full inline buffer is still null-terminated
+    smallstr_t str;
+    for (size_t i = 0; i < smallstr_t::small_capacity; i++)
+    {
+        str.push_back('a' + i % 26);
+        ASSERT_TRUE(str.is_small());
+        ASSERT_EQ(str.size(), i + 1);
+        ASSERT_EQ(str.c_str()[i + 1], '\0');
+    }
+
+    ASSERT_EQ(str.capacity(), smallstr_t::small_capacity);
+
+    // moves to the heap once the buffer is full
+    str.push_back('!');
+    ASSERT_TRUE(str.is_heap());
+    ASSERT_EQ(str.size(), smallstr_t::small_capacity + 1);
+    ASSERT_EQ(str.back(), '!');
+    ASSERT_TRUE(str.starts_with("abcdefghij"));
+
+    // and back once it fits again
+    str.erase(5, smallstr_t::npos);
+    str.shrink_to_fit();
+    ASSERT_TRUE(str.is_small());
+    ASSERT_EQ(str.compare("abcde"), 0);
+
+    // copies and moves keep the content
+    smallstr_t heap('x', 100);
+    smallstr_t copy(heap);
+    ASSERT_TRUE(copy.is_heap());
+    ASSERT_NE(copy.data(), heap.data());
+
+    smallstr_t moved;
+    moved = std::move(copy);
+    ASSERT_EQ(moved.size(), 100);
+    ASSERT_TRUE(copy.empty());
+
+    moved = str;
+    ASSERT_EQ(moved.compare("abcde"), 0);
+
+    // moved from strings are empty and terminated
+    ASSERT_EQ(std::strlen(copy.c_str()), 0);
+
+    smallstr_t inline_source("hello world");
+    smallstr_t inline_target(std::move(inline_source));
+    ASSERT_EQ(inline_target.compare("hello world"), 0);
+    ASSERT_TRUE(inline_source.empty());
+    ASSERT_EQ(std::strlen(inline_source.c_str()), 0);
+
+    smallstr_t heap_target(std::move(heap));
+    ASSERT_EQ(heap_target.size(), 100);
+    ASSERT_TRUE(heap.empty());
+    ASSERT_EQ(std::strlen(heap.c_str()), 0);
+}
+
+TEST(SmallString, WideStorage)
+{
+    using u16smallstr_t = str::u16smallstr;
+
+    u16smallstr_t str(u"short");
+    ASSERT_TRUE(str.is_small());
+    ASSERT_EQ(str.find(u"or"), 2);
+
+    str.append(u" and then longer");
+    ASSERT_TRUE(str.is_heap());
+    ASSERT_EQ(str.size(), 21);
+    ASSERT_TRUE(str.ends_with(u"longer"));
+}
@@ -1,5 +1,10 @@
 #include <gtest/gtest.h>
 #include <str/stackstr>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
 
 TEST(StackString, Constructor)
 {
@@ -14,4 +19,122 @@ TEST(StackString, Constructor)
     stackstr_t str7({ 'h', 'e', 'l', 'l', 'o' });
     stackstr_t str8(str5);
     stackstr_t str9(str5.base());
-}
\ No newline at end of file
+}
+
+TEST(StackString, CopyMove)
+{
+    using stackstr_t = str::stackstr<64>;
+
+    stackstr_t a("hello");
+    stackstr_t b(a);
+    stackstr_t c(std::move(a));
+    ASSERT_EQ(b.compare("hello"), 0);
+    ASSERT_EQ(c.compare("hello"), 0);
+    ASSERT_EQ(c.c_str()[5], '\0');
+
+    stackstr_t d("a much longer string than hello");
+    d = b;
+    ASSERT_EQ(d.compare("hello"), 0);
+    ASSERT_EQ(d.c_str()[5], '\0');
+    d = stackstr_t("moved");
+    ASSERT_EQ(d.compare("moved"), 0);
+}
+
+TEST(StackString, Numbers)
+{
+    ASSERT_EQ(str::to_stackstr(0).compare("0"), 0);
+    ASSERT_EQ(str::to_stackstr(-7).compare("-7"), 0);
+    ASSERT_EQ(str::to_stackstr(1234567890).compare("1234567890"), 0);
+    ASSERT_EQ(str::to_stackstr(std::numeric_limits<int64_t>::min()).compare("-9223372036854775808"), 0);
+    ASSERT_EQ(str::to_stackstr(std::numeric_limits<uint64_t>::max()).compare("18446744073709551615"), 0);
+    ASSERT_EQ(str::to_stackstr(std::numeric_limits<int8_t>::min()).compare("-128"), 0);
+    ASSERT_EQ(str::to_stackstr(std::numeric_limits<uint16_t>::max()).compare("65535"), 0);
+
+    // every digit count around the powers of ten
+    uint64_t pow10 = 1;
+    for (int digits = 1; digits < 20; digits++)
+    {
+        pow10 *= 10;
+        ASSERT_EQ(str::to_stackstr(pow10 - 1).size(), digits);
+        ASSERT_EQ(str::to_stackstr(pow10).size(), digits + 1);
+    }
+
+    // appended in place, in any base
+    str::stackstr<64> str("id=");
+    str.append_int(42).append(',').append_int(-255, 16).append(',').append_int(5u, 2).append(',').append_int(35, 36);
+    ASSERT_EQ(str.compare("id=42,-ff,101,z"), 0);
+    ASSERT_THROW(str.append_int(1, 37), std::invalid_argument);
+
+    str::u32stackstr<8> wide;
+    wide.append_int(-1234567);
+    ASSERT_EQ(wide.compare(U"-1234567"), 0);
+
+    // the characters do not fit
+    str::stackstr<4> small;
+    ASSERT_THROW(small.append_int(12345), std::length_error);
+}
+
+TEST(StackString, FloatingPoint)
+{
+    ASSERT_EQ(str::to_stackstr(0.0).compare("0"), 0);
+    ASSERT_EQ(str::to_stackstr(-0.0).compare("-0"), 0);
+    ASSERT_EQ(str::to_stackstr(0.1).compare("0.1"), 0);
+    ASSERT_EQ(str::to_stackstr(0.1f).compare("0.1"), 0);
+    ASSERT_EQ(str::to_stackstr(1.0 / 3).compare("0.3333333333333333"), 0);
+    ASSERT_EQ(str::to_stackstr(1e22).compare("1e+22"), 0);
+    ASSERT_EQ(str::to_stackstr(123456.0).compare("123456"), 0);
+    ASSERT_EQ(str::to_stackstr(5e-324).compare("5e-324"), 0);
+    ASSERT_EQ(str::to_stackstr(-2.2250738585072014e-308).compare("-2.2250738585072014e-308"), 0);
+    ASSERT_EQ(str::to_stackstr(std::numeric_limits<double>::max()).compare("1.7976931348623157e+308"), 0);
+    ASSERT_EQ(str::to_stackstr(std::numeric_limits<float>::denorm_min()).compare("1e-45"), 0);
+    ASSERT_EQ(str::to_stackstr(-std::numeric_limits<double>::infinity()).compare("-inf"), 0);
+    ASSERT_EQ(str::to_stackstr(std::numeric_limits<double>::quiet_NaN()).compare("nan"), 0);
+
+    // the shortest digits read back to the same value
+    uint64_t bits = 0x9E3779B97F4A7C15ull;
+    for (int i = 0; i < 10000; i++)
+    {
+        bits = bits * 6364136223846793005ull + 1442695040888963407ull;
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (std::isnan(value) || std::isinf(value))
+            continue;
+
+        ASSERT_EQ(std::strtod(str::to_stackstr(value).c_str(), nullptr), value) << bits;
+    }
+
+    // layouts and precisions, like printf
+    str::stackstr<128> str;
+    str.append_float(1e21, str::float_format::fixed).append(',').append_float(0.00125, str::float_format::scientific);
+    ASSERT_EQ(str.compare("1000000000000000000000,1.25e-03"), 0);
+
+    const double values[] = { 0.0, 0.5, 2.5, 0.125, 1.005, 9.995, 123.456, 1e-7, 6.02214076e23, -1e100 };
+    for (auto value : values)
+    {
+        for (int precision = 0; precision < 20; precision++)
+        {
+            char buffer[128];
+            const char *expected = buffer;
+
+            std::snprintf(buffer, sizeof(buffer), "%.*f", precision, value);
+            str.clear();
+            ASSERT_EQ(str.append_float(value, str::float_format::fixed, precision).compare(expected), 0) << expected;
+
+            std::snprintf(buffer, sizeof(buffer), "%.*e", precision, value);
+            str.clear();
+            ASSERT_EQ(str.append_float(value, str::float_format::scientific, precision).compare(expected), 0) << expected;
+
+            std::snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+            str.clear();
+            ASSERT_EQ(str.append_float(value, str::float_format::general, precision).compare(expected), 0) << expected;
+        }
+    }
+
+    str::u16stackstr<8> wide;
+    wide.append_float(-1.5f);
+    ASSERT_EQ(wide.compare(u"-1.5"), 0);
+
+    // the characters do not fit
+    str::stackstr<4> small;
+    ASSERT_THROW(small.append_float(0.125), std::length_error);
+}
@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+#include <str/arena>
+#include <str/strbuf>
+#include <type_traits>
+#include <utility>
+
+TEST(StringBuffer, CopyMove)
+{
+    using bufstr_t = str::bufstr<8>;
+
+    bufstr_t small("abc");
+    bufstr_t large("abcdefghijklmnop");
+
+    // characters on the stack are copied, the heap buffer is handed over
+    bufstr_t small_copy(small);
+    bufstr_t large_move(std::move(bufstr_t(large)));
+    ASSERT_EQ(small_copy.compare("abc"), 0);
+    ASSERT_EQ(large_move.compare("abcdefghijklmnop"), 0);
+
+    auto ptr = large_move.data();
+    bufstr_t moved(std::move(large_move));
+    ASSERT_EQ(moved.data(), ptr);
+    ASSERT_TRUE(large_move.empty());
+
+    small_copy.swap(moved);
+    ASSERT_EQ(small_copy.compare("abcdefghijklmnop"), 0);
+    ASSERT_EQ(small_copy.data(), ptr);
+    ASSERT_EQ(moved.compare("abc"), 0);
+    ASSERT_EQ(moved.c_str()[3], '\0');
+
+    moved = small_copy;
+    small_copy = std::move(small);
+    ASSERT_EQ(moved.compare("abcdefghijklmnop"), 0);
+    ASSERT_EQ(small_copy.compare("abc"), 0);
+    ASSERT_TRUE(small.empty());
+    ASSERT_EQ(small.c_str()[0], '\0');
+
+    // moves never throw, but the stack buffer is pointed to by the string itself
+    ASSERT_TRUE(std::is_nothrow_move_constructible_v<bufstr_t>);
+    ASSERT_TRUE(std::is_nothrow_move_assignable_v<bufstr_t>);
+    ASSERT_FALSE(str::is_trivially_relocatable_v<bufstr_t>);
+
+    // only the heap buffer comes from the allocator
+    str::arena arena;
+    str::basic_bufstr<8, char, std::char_traits<char>, str::arena_allocator<char>> buf("short", arena);
+    ASSERT_EQ(arena.chunks_size(), 0);
+    buf += " and then longer";
+    ASSERT_GT(arena.chunks_size(), 0);
+    ASSERT_EQ(buf.compare("short and then longer"), 0);
+}
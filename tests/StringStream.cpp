@@ -0,0 +1,260 @@
+#include <gtest/gtest.h>
+#include <str/heapstr>
+#include <str/stackstr>
+#include <str/strbuf>
+#include <str/strstream>
+#include <str/file>
+#include <str/strview>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+namespace
+{
+    /// Stream buffer without a get area, every character goes through uflow().
+    class unbuffered : public std::streambuf
+    {
+    public:
+        explicit unbuffered(const char *text)
+            : text_{text} {}
+
+    protected:
+        int_type underflow() override
+        {
+            return *text_ ? traits_type::to_int_type(*text_) : traits_type::eof();
+        }
+
+        int_type uflow() override
+        {
+            return *text_ ? traits_type::to_int_type(*text_++) : traits_type::eof();
+        }
+
+    private:
+        const char *text_;
+    };
+}
+
+TEST(StringStream, Operators)
+{
+    using heapstr_t = str::heapstr;
+
+    std::ostringstream out;
+    heapstr_t hello("hello");
+    out << hello << ' ' << str::strview("world");
+    ASSERT_EQ(out.str(), "hello world");
+
+    // width, fill and adjustment like std::string
+    out.str("");
+    out << std::setw(8) << hello << '|' << std::left << std::setfill('.') << std::setw(7) << hello << '|' << hello;
+    ASSERT_EQ(out.str(), "   hello|hello..|hello");
+
+    // words are read whole, past the size of the string
+    std::istringstream in("  first second\tthird" + std::string(1000, 'x'));
+    heapstr_t word("previous content");
+    in >> word;
+    ASSERT_EQ(word.compare("first"), 0);
+    in >> word;
+    ASSERT_EQ(word.compare("second"), 0);
+    in >> word;
+    ASSERT_EQ(word.size(), 1005);
+    ASSERT_TRUE(in.eof());
+    ASSERT_FALSE(in.fail());
+
+    in >> word;
+    ASSERT_TRUE(in.fail());
+
+    // characters read past a word are given back to the stream
+    std::istringstream rest("word tail");
+    rest >> word;
+    ASSERT_EQ(word.compare("word"), 0);
+    ASSERT_EQ(rest.get(), ' ');
+    std::string tail;
+    rest >> tail;
+    ASSERT_EQ(tail, "tail");
+
+    std::istringstream limited("abcdefgh");
+    str::stackstr<8> stack;
+    limited >> std::setw(3) >> stack;
+    ASSERT_EQ(stack.compare("abc"), 0);
+    limited >> stack;
+    ASSERT_EQ(stack.compare("defgh"), 0);
+
+    unbuffered ub(" one two");
+    std::istream uin(&ub);
+    uin >> word;
+    ASSERT_EQ(word.compare("one"), 0);
+    uin >> word;
+    ASSERT_EQ(word.compare("two"), 0);
+    ASSERT_TRUE(uin.eof());
+}
+
+TEST(StringStream, StreamBuffer)
+{
+    // an ostream writes into the string storage
+    str::heapstr str("log: ");
+    {
+        str::basic_strostream<str::heapstr> os(str);
+        os << "value=" << 42 << ' ' << 1.5 << ' ' << str::strview("ok");
+        ASSERT_EQ(os.str().compare("log: value=42 1.5 ok"), 0);
+
+        os << std::string(1000, 'y');
+        ASSERT_FALSE(os.fail());
+    }
+
+    ASSERT_EQ(str.size(), 1020);
+    ASSERT_EQ(str.compare(0, 20, "log: value=42 1.5 ok"), 0);
+    ASSERT_EQ(str.c_str()[1020], '\0');
+
+    // the string is usable between writes once synced
+    str::bufstr<16> buf;
+    str::basic_strstreambuf<str::bufstr<16>> sb(buf);
+    std::ostream os(&sb);
+    for (int i = 0; i < 10; i++)
+    {
+        os << i;
+    }
+
+    os.flush();
+    ASSERT_EQ(buf.compare("0123456789"), 0);
+    os << "abcdefghij";
+    ASSERT_EQ(sb.str().compare("0123456789abcdefghij"), 0);
+
+    // fixed capacity strings fail the stream when full
+    str::stackstr<4> stack;
+    str::basic_strostream<str::stackstr<4>> small(stack);
+    small << "abc" << 'd';
+    ASSERT_FALSE(small.fail());
+    small << 'e';
+    ASSERT_TRUE(small.bad());
+    ASSERT_EQ(small.str().compare("abcd"), 0);
+}
+
+TEST(StringStream, Getline)
+{
+    std::istringstream in("first line\n\nthird " + std::string(5000, 'x') + "\nlast");
+    str::heapstr line;
+
+    ASSERT_TRUE(str::getline(in, line));
+    ASSERT_EQ(line.compare("first line"), 0);
+    ASSERT_TRUE(str::getline(in, line));
+    ASSERT_TRUE(line.empty());
+    ASSERT_TRUE(str::getline(in, line));
+    ASSERT_EQ(line.size(), 5006);
+
+    // the capacity is reused for shorter lines
+    auto data = line.data();
+    ASSERT_TRUE(str::getline(in, line));
+    ASSERT_EQ(line.compare("last"), 0);
+    ASSERT_EQ(line.data(), data);
+    ASSERT_TRUE(in.eof());
+
+    // like std::getline, the string is left as is at the end of the stream
+    ASSERT_FALSE(str::getline(in, line));
+    ASSERT_EQ(line.compare("last"), 0);
+
+    std::istringstream csv("a,b,,c");
+    str::stackstr<8> field;
+    std::string fields;
+    while (getline(csv, field, ','))
+    {
+        fields += field.c_str();
+        fields += '|';
+    }
+
+    ASSERT_EQ(fields, "a|b||c|");
+
+    // characters read past the delimiter are given back to the stream
+    std::istringstream mixed("one\ntwo three");
+    ASSERT_TRUE(str::getline(mixed, line));
+    ASSERT_EQ(line.compare("one"), 0);
+    std::string next;
+    mixed >> next;
+    ASSERT_EQ(next, "two");
+
+    unbuffered ub("one\ntwo");
+    std::istream uin(&ub);
+    ASSERT_TRUE(str::getline(uin, line));
+    ASSERT_EQ(line.compare("one"), 0);
+    ASSERT_TRUE(str::getline(uin, line));
+    ASSERT_EQ(line.compare("two"), 0);
+
+    // single pass iterators are read once
+    std::istringstream chars("defghi");
+    str::heapstr word("abcxyz");
+    word.insert(3, std::istreambuf_iterator<char>(chars), std::istreambuf_iterator<char>());
+    ASSERT_EQ(word.compare("abcdefghixyz"), 0);
+}
+
+TEST(StringStream, ReadFile)
+{
+    std::string content;
+    for (int i = 0; i < 20000; i++)
+    {
+        content += "line " + std::to_string(i) + "\n";
+    }
+
+    content += "no new line";
+
+    auto path = std::string(::testing::TempDir()) + "str_read_file.txt";
+    std::ofstream(path, std::ios::binary) << content;
+
+    auto str = str::read_file(path.c_str());
+    ASSERT_EQ(str.size(), content.size());
+    ASSERT_EQ(str.compare(content.c_str()), 0);
+    ASSERT_GE(str.capacity(), content.size());
+
+    auto empty_path = std::string(::testing::TempDir()) + "str_read_file_empty.txt";
+    std::ofstream(empty_path, std::ios::binary).flush();
+    ASSERT_TRUE(str::read_file(empty_path.c_str()).empty());
+
+    ASSERT_THROW(str::read_file((path + ".missing").c_str()), std::system_error);
+
+#ifdef STR_HAS_POSIX_IO
+    // a single allocation of the file size, the growth policy is not applied
+    ASSERT_EQ(str.capacity(), content.size() + 1);
+
+    // appends what is left past the position of the descriptor
+    {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        ASSERT_GE(fd, 0);
+
+        str::heapstr appended("head:");
+        ::lseek(fd, static_cast<off_t>(content.size() - 11), SEEK_SET);
+        str::read_file(fd, appended);
+        ASSERT_EQ(appended.compare("head:no new line"), 0);
+
+        // past the end of the file nothing is left
+        ::lseek(fd, static_cast<off_t>(content.size() + 100), SEEK_SET);
+        str::read_file(fd, appended);
+        ASSERT_EQ(appended.compare("head:no new line"), 0);
+        ::close(fd);
+    }
+#endif
+
+#ifdef STR_HAS_POSIX_IO
+    // a small buffer splits lines across reads
+    str::file_reader reader(path.c_str(), 100);
+    str::heapstr line;
+    int count = 0;
+    while (str::getline(reader, line))
+    {
+        if (count < 20000)
+        {
+            ASSERT_EQ(line.compare(("line " + std::to_string(count)).c_str()), 0);
+        }
+
+        count++;
+    }
+
+    ASSERT_EQ(count, 20001);
+    ASSERT_EQ(line.compare(""), 0);
+
+    str::file_reader empty(empty_path.c_str());
+    ASSERT_FALSE(str::getline(empty, line));
+#endif
+
+    std::remove(path.c_str());
+    std::remove(empty_path.c_str());
+}
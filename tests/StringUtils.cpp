@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include <str/strutils>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+TEST(StringUtils, Concat)
+{
+    using heapstr_t = str::heapstr;
+
+    heapstr_t host("example.com");
+    str::strview path("/index");
+
+    // strings of any type, characters and numbers
+    auto url = str::concat("https://", host, ':', 8080, path, "?v=", 1.5);
+    ASSERT_TRUE((std::is_same_v<decltype(url), heapstr_t>));
+    ASSERT_EQ(url.compare("https://example.com:8080/index?v=1.5"), 0);
+    ASSERT_EQ(url.capacity(), url.size());
+
+    // sizes known at compile time make a stackstr
+    auto key = str::concat("id:", int64_t(-42), '/', str::stackstr<8>("x"), 0.25f);
+    ASSERT_TRUE((std::is_same_v<decltype(key), str::stackstr<3 + 20 + 1 + 8 + 24>>));
+    ASSERT_EQ(key.compare("id:-42/x0.25"), 0);
+
+    ASSERT_EQ(str::concat(uint64_t(18446744073709551615ull), -1e-300).compare("18446744073709551615-1e-300"), 0);
+    ASSERT_EQ(str::concat(host + "/", path).compare("example.com//index"), 0);
+
+    // the character type follows the first string
+    auto wide = str::concat(u"n=", 7, u'!');
+    ASSERT_EQ(wide.compare(u"n=7!"), 0);
+    ASSERT_EQ(str::concat(u"x=", 0.5).compare(u"x=0.5"), 0);
+}
+
+TEST(StringUtils, Join)
+{
+    std::vector<str::strview> segments{ "usr", "local", "", "bin" };
+    auto path = str::join(segments, '/');
+    ASSERT_EQ(path.compare("usr/local//bin"), 0);
+    ASSERT_EQ(path.capacity(), path.size());
+
+    std::vector<int> ids{ 3, -1, 400 };
+    ASSERT_EQ(str::join(ids, ", ").compare("3, -1, 400"), 0);
+
+    const char *keys[] = { "a", "b" };
+    ASSERT_EQ(str::join(keys, str::heapstr("=1&")).compare("a=1&b"), 0);
+
+    // floating point elements are formatted once, when appended
+    std::vector<double> values{ 0.5, -2.5, 100 };
+    auto joined = str::join(values, ',');
+    ASSERT_EQ(joined.compare("0.5,-2.5,100"), 0);
+
+    std::vector<double> empty;
+    ASSERT_TRUE(str::join(empty, ',').empty());
+}
@@ -0,0 +1,219 @@
+#include <gtest/gtest.h>
+#include <str/heapstr>
+#include <str/stackstr>
+#include <str/strview>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+TEST(StringView, Constructor)
+{
+    using strview_t = str::strview;
+    using stackstr_t = str::stackstr<50>;
+
+    stackstr_t storage("hello world");
+
+    strview_t view1;
+    strview_t view2("hello world\0 hi world");
+    strview_t view3("hello world\0 hi world", 22);
+    strview_t view4(storage);
+    strview_t view5(view4);
+
+    ASSERT_TRUE(view1.empty());
+    ASSERT_EQ(view2.size(), 11);
+    ASSERT_EQ(view3.size(), 22);
+    ASSERT_EQ(view4.data(), storage.data());
+    ASSERT_EQ(view5.compare(storage), 0);
+
+    ASSERT_TRUE(std::is_trivially_copyable_v<strview_t>);
+    ASSERT_EQ(sizeof(strview_t), 2 * sizeof(void *));
+}
+
+TEST(StringView, Search)
+{
+    using strview_t = str::strview;
+
+    strview_t view("the quick brown fox jumps over the lazy dog");
+
+    ASSERT_EQ(view.find("the"), 0);
+    ASSERT_EQ(view.find("the", 1), 31);
+    ASSERT_EQ(view.rfind('o'), 41);
+    ASSERT_EQ(view.find_first_of("xyz"), 18);
+    ASSERT_EQ(view.find_first_not_of("the "), 4);
+    ASSERT_EQ(view.find_last_of("aeiou"), 41);
+    ASSERT_EQ(view.find_last_not_of("dog"), 39);
+    ASSERT_EQ(view.find(strview_t("fox")), 16);
+    ASSERT_TRUE(view.starts_with("the quick"));
+    ASSERT_TRUE(view.ends_with(strview_t("lazy dog")));
+    ASSERT_TRUE(view.contains("jumps"));
+    ASSERT_LT(view.compare("the slow"), 0);
+
+    auto word = view.substr(4, 5);
+    ASSERT_EQ(word.compare("quick"), 0);
+    ASSERT_EQ(word.data(), view.data() + 4);
+    ASSERT_EQ(word.find('c'), 3);
+    ASSERT_EQ(word.find("brown"), strview_t::npos);
+    ASSERT_THROW(word.at(5), std::out_of_range);
+
+    word.remove_prefix(1);
+    word.remove_suffix(1);
+    ASSERT_EQ(word.compare("uic"), 0);
+}
+
+TEST(StringView, Strings)
+{
+    using strview_t = str::strview;
+    using heapstr_t = str::heapstr;
+    using stackstr_t = str::stackstr<50>;
+
+    heapstr_t str("hello world");
+
+    // owning strings hand out views without copying
+    strview_t world = str.substr_view(6);
+    ASSERT_EQ(world.data(), str.data() + 6);
+    ASSERT_EQ(world.compare("world"), 0);
+    ASSERT_THROW(str.substr_view(12), std::out_of_range);
+
+    // and accept views wherever they accept strings
+    stackstr_t copy(world);
+    ASSERT_EQ(copy.compare("world"), 0);
+
+    copy.append(strview_t(", hi"));
+    copy.insert(0, str.substr_view(0, 6));
+    ASSERT_EQ(copy.compare("hello world, hi"), 0);
+
+    copy.assign(world, 1, 3);
+    ASSERT_EQ(copy.compare("orl"), 0);
+    ASSERT_EQ(str.find(strview_t("orl")), 7);
+    ASSERT_EQ(str.compare(0, 5, strview_t("hello")), 0);
+}
+
+TEST(StringView, Parse)
+{
+    using strview_t = str::strview;
+
+    // fields of a larger buffer, not null-terminated
+    strview_t line("id=18446744073709551615;n=-42;hex=7fFF;bad=x1");
+
+    auto id = str::parse<uint64_t>(line.substr(3, 20));
+    ASSERT_TRUE(id);
+    ASSERT_EQ(id.value, 18446744073709551615ull);
+    ASSERT_EQ(id.count, 20);
+
+    auto n = str::parse<int>(line.substr(26));
+    ASSERT_EQ(n.value, -42);
+    ASSERT_EQ(n.count, 3);
+    ASSERT_EQ(n.ec, std::errc());
+
+    auto hex = str::parse<short>(line.substr(34, 4), 16);
+    ASSERT_EQ(hex.value, 0x7fff);
+
+    auto bad = str::parse<int>(line.substr(43));
+    ASSERT_FALSE(bad);
+    ASSERT_EQ(bad.ec, std::errc::invalid_argument);
+    ASSERT_EQ(bad.count, 0);
+
+    // every length around the 8 digit chunks, with leading zeros
+    const char *digits = "000000001234567890123456789";
+    for (size_t i = 1; i <= 27; i++)
+    {
+        auto result = str::parse<uint64_t>(digits, i);
+        ASSERT_TRUE(result) << i;
+        ASSERT_EQ(result.count, i);
+        ASSERT_EQ(result.value, std::strtoull(std::string(digits, i).c_str(), nullptr, 10)) << i;
+    }
+
+    // pointers and literals take the pointer and length overload
+    char buffer[] = "12345";
+    char *ptr = buffer;
+    ASSERT_EQ(str::parse<int>(ptr, 3).value, 123);
+    ASSERT_EQ(str::parse<int>("123", 3).value, 123);
+    ASSERT_EQ(str::parse<double>(ptr, 5).value, 12345.0);
+
+    // limits of each width
+    ASSERT_EQ(str::parse<int8_t>(strview_t("-128")).value, -128);
+    ASSERT_EQ(str::parse<int8_t>(strview_t("128")).ec, std::errc::result_out_of_range);
+    ASSERT_EQ(str::parse<int64_t>(strview_t("-9223372036854775808")).value, std::numeric_limits<int64_t>::min());
+    ASSERT_EQ(str::parse<int64_t>(strview_t("9223372036854775808")).ec, std::errc::result_out_of_range);
+    ASSERT_EQ(str::parse<uint64_t>(strview_t("18446744073709551616")).ec, std::errc::result_out_of_range);
+    ASSERT_EQ(str::parse<uint64_t>(strview_t("123456789012345678901234")).count, 24);
+    ASSERT_EQ(str::parse<unsigned>(strview_t("-1")).ec, std::errc::invalid_argument);
+    ASSERT_EQ(str::parse<int>(strview_t("-")).ec, std::errc::invalid_argument);
+    ASSERT_EQ(str::parse<int>(strview_t("101"), 2).value, 5);
+    ASSERT_EQ(str::parse<int>(strview_t("zz"), 36).value, 35 * 36 + 35);
+    ASSERT_EQ(str::parse<int>(strview_t("1"), 37).ec, std::errc::invalid_argument);
+
+    // wide characters
+    ASSERT_EQ(str::parse<int>(str::u16strview(u"-2147483648")).value, std::numeric_limits<int>::min());
+}
+
+TEST(StringView, ParseFloat)
+{
+    using strview_t = str::strview;
+
+    // fields of a CSV line, not null-terminated
+    strview_t line("3.25,-0.1,1e-3,6.02214076e23,.5,7.;x");
+
+    auto a = str::parse<double>(line.substr(0, 4));
+    ASSERT_TRUE(a);
+    ASSERT_EQ(a.value, 3.25);
+    ASSERT_EQ(a.count, 4);
+
+    ASSERT_EQ(str::parse<double>(line.substr(5)).value, -0.1);
+    ASSERT_EQ(str::parse<double>(line.substr(5)).count, 4);
+    ASSERT_EQ(str::parse<double>(line.substr(10)).value, 1e-3);
+    ASSERT_EQ(str::parse<double>(line.substr(15)).value, 6.02214076e23);
+    ASSERT_EQ(str::parse<float>(line.substr(15)).value, 6.02214076e23f);
+    ASSERT_EQ(str::parse<double>(line.substr(29)).value, 0.5);
+    ASSERT_EQ(str::parse<double>(line.substr(32)).count, 2);
+
+    auto bad = str::parse<double>(line.substr(35));
+    ASSERT_FALSE(bad);
+    ASSERT_EQ(bad.ec, std::errc::invalid_argument);
+
+    // correctly rounded, including ties broken by digits past the first 19
+    ASSERT_EQ(str::parse<double>(strview_t("9007199254740993")).value, 9007199254740992.0);
+    ASSERT_EQ(str::parse<double>(strview_t("9007199254740993.000000000000000000001")).value, 9007199254740994.0);
+    ASSERT_EQ(str::parse<double>(strview_t("2.2250738585072011e-308")).value, 2.2250738585072011e-308);
+    ASSERT_EQ(str::parse<double>(strview_t("4.9406564584124654e-324")).value, std::numeric_limits<double>::denorm_min());
+    ASSERT_EQ(str::parse<double>(strview_t("1.7976931348623157e308")).value, std::numeric_limits<double>::max());
+    ASSERT_EQ(str::parse<float>(strview_t("3.4028234663852886e38")).value, std::numeric_limits<float>::max());
+    ASSERT_EQ(str::parse<double>(strview_t("0.000000000000000000000000000000000000000000000000001")).value, 1e-51);
+
+    // the exponent needs digits
+    ASSERT_EQ(str::parse<double>(strview_t("1e+")).count, 1);
+    ASSERT_EQ(str::parse<double>(strview_t("1E-2x")).count, 4);
+
+    ASSERT_EQ(str::parse<double>(strview_t("1e309")).ec, std::errc::result_out_of_range);
+    ASSERT_EQ(str::parse<double>(strview_t("1e-400")).ec, std::errc::result_out_of_range);
+    ASSERT_EQ(str::parse<float>(strview_t("1e39")).ec, std::errc::result_out_of_range);
+    ASSERT_EQ(str::parse<double>(strview_t("1.5"), 16).ec, std::errc::invalid_argument);
+
+    ASSERT_EQ(str::parse<double>(strview_t("-Infinity")).value, -std::numeric_limits<double>::infinity());
+    ASSERT_EQ(str::parse<double>(strview_t("-Infinity")).count, 9);
+    ASSERT_TRUE(std::isnan(str::parse<double>(strview_t("nan(0x1)")).value));
+    ASSERT_EQ(str::parse<double>(strview_t("nan(0x1)")).count, 8);
+
+    // every double written with 17 digits reads back
+    uint64_t bits = 0x9E3779B97F4A7C15ull;
+    for (int i = 0; i < 10000; i++)
+    {
+        bits = bits * 6364136223846793005ull + 1442695040888963407ull;
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (std::isnan(value) || std::isinf(value))
+            continue;
+
+        char buffer[32];
+        auto size = std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+        ASSERT_EQ(str::parse<double>(strview_t(buffer, static_cast<size_t>(size))).value, value) << buffer;
+    }
+
+    // wide characters
+    ASSERT_EQ(str::parse<double>(str::u32strview(U"-1.5e-3")).value, -1.5e-3);
+}